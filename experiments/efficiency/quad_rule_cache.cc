@@ -0,0 +1,42 @@
+/** @file quad_rule_cache.cc
+ *  @brief Compares the cost of building quadrature rules with the cost of
+ *  fetching them from the process-wide cache
+ */
+
+#include <boost/timer/timer.hpp>
+#include <iostream>
+#include "lf/quad/quad.h"
+
+int main(int /*argc*/, const char * /*unused*/ []) {
+  std::cout << "Runtime test for repeated construction of quadrature rules"
+            << std::endl;
+
+  const long int reps = 100000L;
+  for (auto ref_el : {lf::base::RefEl::kSegment(), lf::base::RefEl::kTria(),
+                      lf::base::RefEl::kQuad()}) {
+    for (lf::quad::quadOrder_t order : {2, 6, 12}) {
+      std::cout << ref_el << ", order " << static_cast<int>(order)
+                << std::endl;
+      double s = 0.0;
+      std::cout << "I. make_QuadRule()" << std::endl;
+      {
+        boost::timer::auto_cpu_timer t;
+        for (long int i = 0; i < reps; i++) {
+          const lf::quad::QuadRule qr = lf::quad::make_QuadRule(ref_el, order);
+          s += qr.Weights()[0];
+        }
+      }
+      std::cout << "II. QuadRuleCache()" << std::endl;
+      {
+        boost::timer::auto_cpu_timer t;
+        for (long int i = 0; i < reps; i++) {
+          const lf::quad::QuadRule &qr = lf::quad::QuadRuleCache(ref_el, order);
+          s += qr.Weights()[0];
+        }
+      }
+      std::cout << "(checksum " << s << ")" << std::endl;
+    }
+  }
+
+  return 0;
+}
@@ -45,6 +45,7 @@ constexpr double kPi = 3.14159265358979323846;
 #include "invalid_type_exception.h"
 #include "lf_assert.h"
 #include "lf_exception.h"
+#include "parallel_for.h"
 #include "predicate_true.h"
 #include "random_access_iterator.h"
 #include "random_access_range.h"
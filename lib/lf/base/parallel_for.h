@@ -0,0 +1,103 @@
+/**
+ * @file
+ * @brief Simple static work distribution over a pool of std::threads
+ * @author agent
+ * @date   2026-10-19
+ * @copyright MIT License
+ */
+
+#ifndef __4b0f7d1e9c2a4b6f8e3d5a7c9b1e2f40
+#define __4b0f7d1e9c2a4b6f8e3d5a7c9b1e2f40
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace lf::base {
+
+/**
+ * @brief Number of threads used by ParallelFor() if not specified otherwise.
+ *
+ * Initialized with `std::thread::hardware_concurrency()`; may be changed by
+ * the user, a value of 1 makes ParallelFor() run serially.
+ */
+inline unsigned int& DefaultNumThreads() {
+  static unsigned int num_threads =
+      std::max(1U, std::thread::hardware_concurrency());
+  return num_threads;
+}
+
+/**
+ * @brief Split the index range `[0,n)` into contiguous chunks and process
+ * them concurrently.
+ *
+ * @param n length of the index range
+ * @param f functor with signature `void(std::size_t begin, std::size_t end)`
+ * that processes the indices in `[begin,end)`.
+ * @param min_chunk_size chunks are not made smaller than this, which avoids
+ * starting threads for tiny amounts of work.
+ * @param num_threads maximal number of threads, 0 means
+ * DefaultNumThreads().
+ *
+ * The k-th chunk always covers the same indices for fixed `n` and number of
+ * chunks, so that results that are written per index (or per chunk and
+ * combined in chunk order) are deterministic. The calling thread processes
+ * the first chunk itself. The functor `f` is invoked concurrently and must
+ * only modify data that is private to its chunk.
+ *
+ * If `f` throws an exception for one or several chunks, the remaining chunks
+ * are still processed. After all threads have finished, the exception of the
+ * chunk with the smallest index is rethrown on the calling thread, the
+ * others are discarded. Thus exceptions thrown inside `f`, e.g.
+ * base::LfException, can be caught by the caller as in serial code.
+ *
+ * @return the number of chunks into which `[0,n)` was split
+ */
+template <typename FUNCTOR>
+std::size_t ParallelFor(std::size_t n, FUNCTOR&& f,
+                        std::size_t min_chunk_size = 1024,
+                        unsigned int num_threads = 0) {
+  if (num_threads == 0) {
+    num_threads = DefaultNumThreads();
+  }
+  const std::size_t num_chunks = std::max<std::size_t>(
+      1, std::min<std::size_t>(
+             num_threads, n / std::max<std::size_t>(1, min_chunk_size)));
+  if (num_chunks == 1) {
+    f(std::size_t(0), n);
+    return 1;
+  }
+  // an exception thrown by a chunk is stored and rethrown after all threads
+  // have been joined
+  std::vector<std::exception_ptr> errors(num_chunks);
+  std::vector<std::thread> workers;
+  workers.reserve(num_chunks - 1);
+  for (std::size_t k = 1; k < num_chunks; ++k) {
+    workers.emplace_back([&f, &errors, k, n, num_chunks]() {
+      try {
+        f(k * n / num_chunks, (k + 1) * n / num_chunks);
+      } catch (...) {
+        errors[k] = std::current_exception();
+      }
+    });
+  }
+  try {
+    f(std::size_t(0), n / num_chunks);
+  } catch (...) {
+    errors[0] = std::current_exception();
+  }
+  for (std::thread& w : workers) {
+    w.join();
+  }
+  for (const std::exception_ptr& e : errors) {
+    if (e) {
+      std::rethrow_exception(e);
+    }
+  }
+  return num_chunks;
+}
+
+}  // namespace lf::base
+
+#endif  // __4b0f7d1e9c2a4b6f8e3d5a7c9b1e2f40
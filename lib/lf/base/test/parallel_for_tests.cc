@@ -0,0 +1,66 @@
+/**
+ * @file
+ * @brief Tests for ParallelFor()
+ * @author agent
+ * @date   2026-10-19
+ * @copyright MIT License
+ */
+
+#include <gtest/gtest.h>
+#include <lf/base/base.h>
+#include <stdexcept>
+#include <vector>
+
+namespace lf::base::test {
+
+TEST(ParallelFor, coversRangeOnce) {
+  for (unsigned int num_threads : {1U, 2U, 3U, 8U}) {
+    for (std::size_t n : {0UL, 1UL, 7UL, 1000UL, 12345UL}) {
+      std::vector<int> visited(n, 0);
+      const std::size_t num_chunks = ParallelFor(
+          n,
+          [&visited](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+              visited[i]++;
+            }
+          },
+          10, num_threads);
+      EXPECT_GE(num_chunks, 1);
+      EXPECT_LE(num_chunks, num_threads);
+      for (std::size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(visited[i], 1) << "index " << i;
+      }
+    }
+  }
+}
+
+TEST(ParallelFor, smallRangeIsSerial) {
+  EXPECT_EQ(ParallelFor(
+                100, [](std::size_t /*begin*/, std::size_t /*end*/) {}, 1024,
+                4),
+            1);
+}
+
+// Exceptions of any chunk reach the caller, all other chunks are completed
+TEST(ParallelFor, propagatesExceptions) {
+  for (std::size_t throwing_chunk : {0UL, 2UL}) {
+    std::vector<int> visited(400, 0);
+    EXPECT_THROW(ParallelFor(
+                     visited.size(),
+                     [&](std::size_t begin, std::size_t end) {
+                       if (begin == throwing_chunk * 100) {
+                         throw LfException("chunk failed");
+                       }
+                       for (std::size_t i = begin; i < end; ++i) {
+                         visited[i]++;
+                       }
+                     },
+                     100, 4),
+                 LfException);
+    for (std::size_t i = 0; i < visited.size(); ++i) {
+      EXPECT_EQ(visited[i], i / 100 == throwing_chunk ? 0 : 1);
+    }
+  }
+}
+
+}  // namespace lf::base::test
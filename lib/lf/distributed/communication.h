@@ -0,0 +1,95 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Helper functions for MPI communication patterns
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#ifndef _LF_DISTRIBUTED_COMM_H_
+#define _LF_DISTRIBUTED_COMM_H_
+
+#include <lf/base/base.h>
+#include <mpi.h>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace lf::distributed {
+
+/** @brief rank of the calling process in a communicator */
+inline int CommRank(MPI_Comm comm) {
+  int rank;
+  MPI_Comm_rank(comm, &rank);
+  return rank;
+}
+
+/** @brief number of processes in a communicator */
+inline int CommSize(MPI_Comm comm) {
+  int size;
+  MPI_Comm_size(comm, &size);
+  return size;
+}
+
+/**
+ * @brief Personalized all-to-all exchange of lists of items
+ *
+ * @tparam T trivially copyable type of the items
+ * @param comm the communicator
+ * @param send_lists vector of length `CommSize(comm)`, the r-th entry holds
+ * the items to be sent to rank r
+ * @return vector of length `CommSize(comm)`, whose r-th entry contains the
+ * items received from rank r, in the order in which they were sent.
+ *
+ * This is a collective operation that has to be called by all processes of
+ * the communicator.
+ */
+template <typename T>
+std::vector<std::vector<T>> ExchangeLists(
+    MPI_Comm comm, const std::vector<std::vector<T>>& send_lists) {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "Only trivially copyable types can be exchanged");
+  const int nranks = CommSize(comm);
+  LF_ASSERT_MSG(send_lists.size() == static_cast<std::size_t>(nranks),
+                "Need one send list per rank");
+  // Communicate sizes (in bytes) first
+  std::vector<int> send_cnt(nranks), recv_cnt(nranks);
+  for (int r = 0; r < nranks; ++r) {
+    send_cnt[r] = static_cast<int>(send_lists[r].size() * sizeof(T));
+  }
+  MPI_Alltoall(send_cnt.data(), 1, MPI_INT, recv_cnt.data(), 1, MPI_INT, comm);
+  std::vector<int> send_displ(nranks + 1, 0), recv_displ(nranks + 1, 0);
+  for (int r = 0; r < nranks; ++r) {
+    send_displ[r + 1] = send_displ[r] + send_cnt[r];
+    recv_displ[r + 1] = recv_displ[r] + recv_cnt[r];
+  }
+  // Pack, exchange and unpack
+  std::vector<char> send_buf(send_displ[nranks]);
+  std::vector<char> recv_buf(recv_displ[nranks]);
+  for (int r = 0; r < nranks; ++r) {
+    if (send_cnt[r] > 0) {
+      std::memcpy(&send_buf[send_displ[r]], send_lists[r].data(), send_cnt[r]);
+    }
+  }
+  MPI_Alltoallv(send_buf.data(), send_cnt.data(), send_displ.data(), MPI_BYTE,
+                recv_buf.data(), recv_cnt.data(), recv_displ.data(), MPI_BYTE,
+                comm);
+  std::vector<std::vector<T>> recv_lists(nranks);
+  for (int r = 0; r < nranks; ++r) {
+    recv_lists[r].resize(recv_cnt[r] / sizeof(T));
+    if (recv_cnt[r] > 0) {
+      std::memcpy(recv_lists[r].data(), &recv_buf[recv_displ[r]], recv_cnt[r]);
+    }
+  }
+  return recv_lists;
+}
+
+}  // namespace lf::distributed
+
+#endif
@@ -0,0 +1,25 @@
+/**
+ * @file
+ * @brief Main include file for the lf.distributed module
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#ifndef _LF_DISTRIBUTED_H_
+#define _LF_DISTRIBUTED_H_
+
+#include "communication.h"
+#include "distributed_assembly.h"
+#include "distributed_dofhandler.h"
+#include "distributed_matrix.h"
+
+/**
+ * @brief Finite element computations on meshes partitioned into subdomains
+ * that are distributed over MPI processes
+ *
+ * This module is only built if an MPI installation is found.
+ */
+namespace lf::distributed {}
+
+#endif
@@ -0,0 +1,49 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Non-template functions for distributed assembly
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#include "distributed_assembly.h"
+#include "communication.h"
+
+namespace lf::distributed {
+
+namespace {
+// Vector entry sent to the owner of the dof
+struct VectorEntry {
+  gdof_idx_t dof;
+  double val;
+};
+}  // namespace
+
+Eigen::VectorXd SumToOwners(
+    const DistributedDofHandler &dofh,
+    const std::vector<std::pair<gdof_idx_t, double>> &contributions) {
+  const int nranks = CommSize(dofh.Comm());
+  std::vector<std::vector<VectorEntry>> outgoing(nranks);
+  for (const auto &contrib : contributions) {
+    LF_ASSERT_MSG(contrib.first >= 0, "Contribution to unknown dof");
+    outgoing[dofh.OwnerRank(contrib.first)].push_back(
+        {contrib.first, contrib.second});
+  }
+  const auto incoming{ExchangeLists(dofh.Comm(), outgoing)};
+  const gdof_idx_t first = dofh.FirstOwnedDof();
+  Eigen::VectorXd vec = Eigen::VectorXd::Zero(dofh.NoOwnedDofs());
+  for (const auto &entries : incoming) {
+    for (const VectorEntry &e : entries) {
+      vec[e.dof - first] += e.val;
+    }
+  }
+  return vec;
+}
+
+}  // namespace lf::distributed
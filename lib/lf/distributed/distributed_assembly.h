@@ -0,0 +1,120 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Assembly of distributed Galerkin matrices and right hand side
+ * vectors
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#ifndef _LF_DISTRIBUTED_ASSEMBLY_H_
+#define _LF_DISTRIBUTED_ASSEMBLY_H_
+
+#include <utility>
+#include <vector>
+#include "distributed_dofhandler.h"
+#include "distributed_matrix.h"
+
+namespace lf::distributed {
+
+/**
+ * @brief Wrapper for an element matrix provider restricting assembly to the
+ * cells owned by the calling process
+ *
+ * @tparam ELEM_MAT_COMP type complying with the requirements for the template
+ * argument of lf::assemble::AssembleMatrixLocally()
+ */
+template <class ELEM_MAT_COMP>
+class OwnedCellsMatrixProvider {
+ public:
+  using ElemMat = typename ELEM_MAT_COMP::ElemMat;
+
+  OwnedCellsMatrixProvider(const DistributedDofHandler &dofh,
+                           ELEM_MAT_COMP &assembler)
+      : dofh_(dofh), assembler_(assembler) {}
+
+  bool isActive(const lf::mesh::Entity &cell) {
+    return dofh_.IsOwnedCell(cell) && assembler_.isActive(cell);
+  }
+  ElemMat Eval(const lf::mesh::Entity &cell) { return assembler_.Eval(cell); }
+
+ private:
+  const DistributedDofHandler &dofh_;
+  ELEM_MAT_COMP &assembler_;
+};
+
+/**
+ * @brief Assembly of a distributed Galerkin matrix
+ *
+ * @param dofh distributed dof handler for both trial and test space
+ * @param assembler provider of element matrices, see
+ * lf::assemble::AssembleMatrixLocally()
+ * @return the distributed matrix
+ *
+ * Each process computes the element matrices for the cells it owns. Then
+ * contributions to rows owned by other processes are sent to their owners.
+ * This is a collective operation.
+ */
+template <class ELEM_MAT_COMP>
+DistributedMatrix AssembleDistributedMatrix(const DistributedDofHandler &dofh,
+                                            ELEM_MAT_COMP &assembler) {
+  OwnedCellsMatrixProvider<ELEM_MAT_COMP> owned_assembler(dofh, assembler);
+  lf::assemble::COOMatrix<double> mat(dofh.NoDofs(), dofh.NoDofs());
+  lf::assemble::AssembleMatrixLocally(0, dofh, dofh, owned_assembler, mat);
+  return DistributedMatrix(dofh, mat.triplets());
+}
+
+/**
+ * @brief Sum contributions to the entries of a distributed vector
+ *
+ * @param dofh distributed dof handler
+ * @param contributions pairs (global dof index, value) to be added; the
+ * indices may refer to dofs owned by other processes
+ * @return owned part of the resulting distributed vector
+ *
+ * This is a collective operation.
+ */
+Eigen::VectorXd SumToOwners(
+    const DistributedDofHandler &dofh,
+    const std::vector<std::pair<gdof_idx_t, double>> &contributions);
+
+/**
+ * @brief Assembly of a distributed right hand side vector
+ *
+ * @param dofh distributed dof handler
+ * @param assembler provider of element vectors complying with the
+ * requirements for lf::assemble::AssembleVectorLocally()
+ * @return owned part of the assembled vector
+ *
+ * This is a collective operation.
+ */
+template <class ELEM_VEC_COMP>
+Eigen::VectorXd AssembleDistributedVector(const DistributedDofHandler &dofh,
+                                          ELEM_VEC_COMP &assembler) {
+  using elem_vec_t = typename ELEM_VEC_COMP::ElemVec;
+  std::vector<std::pair<gdof_idx_t, double>> contributions;
+  for (const lf::mesh::Entity &cell : dofh.Mesh()->Entities(0)) {
+    if (dofh.IsOwnedCell(cell) && assembler.isActive(cell)) {
+      const size_type no_loc_dofs = dofh.NoLocalDofs(cell);
+      lf::base::RandomAccessRange<const gdof_idx_t> dof_idx(
+          dofh.GlobalDofIndices(cell));
+      const elem_vec_t elem_vec(assembler.Eval(cell));
+      LF_ASSERT_MSG(elem_vec.size() >= no_loc_dofs,
+                    "Element vector too short");
+      for (size_type i = 0; i < no_loc_dofs; ++i) {
+        contributions.emplace_back(dof_idx[i], elem_vec[i]);
+      }
+    }
+  }
+  return SumToOwners(dofh, contributions);
+}
+
+}  // namespace lf::distributed
+
+#endif
@@ -0,0 +1,209 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Implementation of the distributed dof numbering
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#include "distributed_dofhandler.h"
+#include <algorithm>
+#include "communication.h"
+
+namespace lf::distributed {
+
+namespace {
+// Request for the global index of a dof sent to the owner of an entity
+struct DofRequest {
+  glb_idx_t codim;
+  glb_idx_t entity;  // global index of the entity
+  glb_idx_t pos;     // position of dof in canonical ordering
+};
+}  // namespace
+
+DistributedDofHandler::DistributedDofHandler(
+    MPI_Comm comm, const lf::mesh::utils::SubDomainMesh &sub,
+    dof_map_t dofmap)
+    : comm_(comm),
+      rank_(CommRank(comm)),
+      local_dofh_(sub.mesh, std::move(dofmap)),
+      is_ghost_cell_(sub.is_ghost_cell) {
+  LF_VERIFY_MSG(sub.part == static_cast<size_type>(rank_),
+                "Subdomain " << sub.part << " passed to rank " << rank_);
+  const lf::mesh::Mesh &mesh{*sub.mesh};
+  LF_VERIFY_MSG(mesh.DimMesh() == 2, "Can handle 2D meshes only");
+  const int nranks = CommSize(comm_);
+  const auto my_part = static_cast<size_type>(rank_);
+
+  // Step I: determine owners of entities and flag entities belonging to
+  // owned cells
+  std::array<std::vector<size_type>, 3> owner;
+  std::array<std::vector<bool>, 3> active;
+  for (dim_t codim = 0; codim <= 2; ++codim) {
+    owner[codim].assign(mesh.Size(codim), lf::base::kIdxNil);
+    active[codim].assign(mesh.Size(codim), false);
+  }
+  for (const lf::mesh::Entity &cell : mesh.Entities(0)) {
+    const glb_idx_t cell_idx = mesh.Index(cell);
+    const size_type part = sub.cell_part[cell_idx];
+    for (dim_t codim = 0; codim <= 2; ++codim) {
+      for (const lf::mesh::Entity &e : cell.SubEntities(codim)) {
+        const glb_idx_t idx = mesh.Index(e);
+        owner[codim][idx] = std::min(owner[codim][idx], part);
+        if (!is_ghost_cell_[cell_idx]) {
+          active[codim][idx] = true;
+        }
+      }
+    }
+  }
+  // Edges with several interior dofs: is the local orientation opposite to
+  // the canonical one?
+  auto flipped = [&mesh, &sub](const lf::mesh::Entity &e) -> bool {
+    if (e.Codim() != 1) {
+      return false;
+    }
+    auto endpoints = e.SubEntities(1);
+    return sub.local_to_global[2][mesh.Index(endpoints[0])] >
+           sub.local_to_global[2][mesh.Index(endpoints[1])];
+  };
+
+  // Step II: number owned dofs contiguously
+  const size_type no_loc_dofs = local_dofh_.NoDofs();
+  std::vector<bool> dof_owned(no_loc_dofs, false);
+  for (dim_t codim = 0; codim <= 2; ++codim) {
+    for (const lf::mesh::Entity &e : mesh.Entities(codim)) {
+      const glb_idx_t idx = mesh.Index(e);
+      if (active[codim][idx] && (owner[codim][idx] == my_part)) {
+        for (gdof_idx_t dof : local_dofh_.InteriorGlobalDofIndices(e)) {
+          dof_owned[dof] = true;
+        }
+      }
+    }
+  }
+  unsigned long no_owned =
+      std::count(dof_owned.begin(), dof_owned.end(), true);
+  std::vector<unsigned long> all_no_owned(nranks);
+  MPI_Allgather(&no_owned, 1, MPI_UNSIGNED_LONG, all_no_owned.data(), 1,
+                MPI_UNSIGNED_LONG, comm_);
+  dof_offsets_.assign(nranks + 1, 0);
+  for (int r = 0; r < nranks; ++r) {
+    dof_offsets_[r + 1] = dof_offsets_[r] + all_no_owned[r];
+  }
+  local_to_global_.assign(no_loc_dofs, -1);
+  gdof_idx_t next_dof = dof_offsets_[rank_];
+  for (gdof_idx_t dof = 0; dof < no_loc_dofs; ++dof) {
+    if (dof_owned[dof]) {
+      local_to_global_[dof] = next_dof++;
+    }
+  }
+
+  // Step III: fetch global indices of dofs owned by other processes
+  std::vector<std::vector<DofRequest>> requests(nranks);
+  std::vector<std::vector<gdof_idx_t>> requested_dofs(nranks);
+  for (dim_t codim = 0; codim <= 2; ++codim) {
+    for (const lf::mesh::Entity &e : mesh.Entities(codim)) {
+      const glb_idx_t idx = mesh.Index(e);
+      if (active[codim][idx] && (owner[codim][idx] != my_part)) {
+        auto int_dofs = local_dofh_.InteriorGlobalDofIndices(e);
+        const glb_idx_t n = int_dofs.end() - int_dofs.begin();
+        const bool flip = flipped(e);
+        for (glb_idx_t j = 0; j < n; ++j) {
+          const size_type r = owner[codim][idx];
+          requests[r].push_back(
+              {codim, sub.local_to_global[codim][idx], flip ? n - 1 - j : j});
+          requested_dofs[r].push_back(int_dofs[j]);
+        }
+      }
+    }
+  }
+  const std::vector<std::vector<DofRequest>> incoming{
+      ExchangeLists(comm_, requests)};
+  std::vector<std::vector<gdof_idx_t>> answers(nranks);
+  for (int r = 0; r < nranks; ++r) {
+    for (const DofRequest &req : incoming[r]) {
+      const glb_idx_t idx = sub.global_to_local[req.codim][req.entity];
+      LF_VERIFY_MSG(idx != lf::base::kIdxNil,
+                    "Rank " << rank_ << " does not know entity " << req.entity
+                            << " requested by rank " << r);
+      const lf::mesh::Entity &e{*mesh.EntityByIndex(req.codim, idx)};
+      auto int_dofs = local_dofh_.InteriorGlobalDofIndices(e);
+      const glb_idx_t n = int_dofs.end() - int_dofs.begin();
+      const gdof_idx_t gdof =
+          local_to_global_[int_dofs[flipped(e) ? n - 1 - req.pos : req.pos]];
+      LF_VERIFY_MSG(gdof >= 0, "Requested dof not owned by rank " << rank_);
+      answers[r].push_back(gdof);
+    }
+  }
+  const std::vector<std::vector<gdof_idx_t>> replies{
+      ExchangeLists(comm_, answers)};
+  for (int r = 0; r < nranks; ++r) {
+    for (std::size_t k = 0; k < replies[r].size(); ++k) {
+      local_to_global_[requested_dofs[r][k]] = replies[r][k];
+    }
+  }
+  for (gdof_idx_t dof = 0; dof < no_loc_dofs; ++dof) {
+    if (local_to_global_[dof] >= 0) {
+      global_to_local_[local_to_global_[dof]] = dof;
+    }
+  }
+
+  // Step IV: store global indices for all entities
+  for (dim_t codim = 0; codim <= 2; ++codim) {
+    const size_type no_entities = mesh.Size(codim);
+    offsets_[codim].assign(1, 0);
+    int_offsets_[codim].assign(1, 0);
+    for (glb_idx_t idx = 0; idx < no_entities; ++idx) {
+      const lf::mesh::Entity &e{*mesh.EntityByIndex(codim, idx)};
+      for (gdof_idx_t dof : local_dofh_.GlobalDofIndices(e)) {
+        dofs_[codim].push_back(local_to_global_[dof]);
+      }
+      for (gdof_idx_t dof : local_dofh_.InteriorGlobalDofIndices(e)) {
+        int_dofs_[codim].push_back(local_to_global_[dof]);
+      }
+      offsets_[codim].push_back(dofs_[codim].size());
+      int_offsets_[codim].push_back(int_dofs_[codim].size());
+    }
+  }
+}
+
+lf::base::RandomAccessRange<const gdof_idx_t>
+DistributedDofHandler::GlobalDofIndices(const lf::mesh::Entity &entity) const {
+  const dim_t codim = entity.Codim();
+  const glb_idx_t idx = Mesh()->Index(entity);
+  const gdof_idx_t *base = dofs_[codim].data();
+  return {base + offsets_[codim][idx], base + offsets_[codim][idx + 1]};
+}
+
+lf::base::RandomAccessRange<const gdof_idx_t>
+DistributedDofHandler::InteriorGlobalDofIndices(
+    const lf::mesh::Entity &entity) const {
+  const dim_t codim = entity.Codim();
+  const glb_idx_t idx = Mesh()->Index(entity);
+  const gdof_idx_t *base = int_dofs_[codim].data();
+  return {base + int_offsets_[codim][idx],
+          base + int_offsets_[codim][idx + 1]};
+}
+
+const lf::mesh::Entity &DistributedDofHandler::Entity(gdof_idx_t dofnum) const {
+  auto it = global_to_local_.find(dofnum);
+  LF_VERIFY_MSG(it != global_to_local_.end(),
+                "Dof " << dofnum << " unknown on rank " << rank_);
+  return local_dofh_.Entity(it->second);
+}
+
+int DistributedDofHandler::OwnerRank(gdof_idx_t dofnum) const {
+  LF_ASSERT_MSG((dofnum >= 0) && (dofnum < dof_offsets_.back()),
+                "Dof index " << dofnum << " out of range");
+  return static_cast<int>(std::upper_bound(dof_offsets_.begin(),
+                                           dof_offsets_.end(), dofnum) -
+                          dof_offsets_.begin()) -
+         1;
+}
+
+}  // namespace lf::distributed
@@ -0,0 +1,170 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief DOF handler for finite element spaces on a mesh distributed
+ * over several MPI processes
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#ifndef _LF_DISTRIBUTED_DOFHD_H_
+#define _LF_DISTRIBUTED_DOFHD_H_
+
+#include <lf/assemble/assemble.h>
+#include <lf/mesh/utils/utils.h>
+#include <mpi.h>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace lf::distributed {
+
+using gdof_idx_t = lf::assemble::gdof_idx_t;
+using size_type = lf::base::size_type;
+using glb_idx_t = lf::base::glb_idx_t;
+using dim_t = lf::base::dim_t;
+
+/**
+ * @brief Dof handler for a uniform finite element space on a subdomain mesh,
+ * providing a dof numbering that is consistent across all MPI processes
+ *
+ * Every process of the communicator holds the mesh of one subdomain, see
+ * lf::mesh::utils::ExtractSubDomainMesh(), where the part number must agree
+ * with the rank of the process. The subdomain mesh must contain at least one
+ * layer of ghost cells.
+ *
+ * ### Ownership
+ *
+ * Every mesh entity is owned by the part with the smallest number among the
+ * parts of the cells adjacent to it. The degrees of freedom associated with
+ * an entity are owned by the process owning the entity.
+ *
+ * ### Global dof numbering
+ *
+ * The dofs owned by rank r are numbered contiguously in the range
+ * `[OwnedDofOffsets()[r], OwnedDofOffsets()[r+1])`; within a rank the
+ * ordering follows the dof numbering of a UniformFEDofHandler on the
+ * subdomain mesh. For entities of co-dimension 1 with several interior dofs
+ * the dofs are arranged along the direction from the endpoint with the
+ * smaller global node index to the other endpoint, which is independent of
+ * the orientation of the edge in the subdomain mesh.
+ *
+ * All methods inherited from lf::assemble::DofHandler deal with these
+ * global dof indices. Global indices are known only for the dofs belonging to
+ * entities of cells owned by the process. The indices of the other dofs,
+ * which live on the outer boundary of the ghost layer, are set to -1; thus
+ * assembly must be restricted to owned cells, see IsOwnedCell().
+ *
+ * Construction is a collective operation for all processes of the
+ * communicator.
+ */
+class DistributedDofHandler : public lf::assemble::DofHandler {
+ public:
+  using dof_map_t = lf::assemble::UniformFEDofHandler::dof_map_t;
+
+  /**
+   * @brief Set up the distributed dof numbering
+   *
+   * @param comm MPI communicator
+   * @param sub subdomain mesh of the calling process, `sub.part` must agree
+   * with its rank
+   * @param dofmap map telling number of interior dofs for every type of
+   * entity, see UniformFEDofHandler
+   */
+  DistributedDofHandler(MPI_Comm comm,
+                        const lf::mesh::utils::SubDomainMesh &sub,
+                        dof_map_t dofmap);
+
+  /** @brief total number of dofs over all processes */
+  size_type NoDofs() const override { return dof_offsets_.back(); }
+
+  /** @copydoc DofHandler::NoLocalDofs() */
+  size_type NoLocalDofs(const lf::mesh::Entity &entity) const override {
+    return local_dofh_.NoLocalDofs(entity);
+  }
+
+  /** @copydoc DofHandler::NoInteriorDofs() */
+  size_type NoInteriorDofs(const lf::mesh::Entity &entity) const override {
+    return local_dofh_.NoInteriorDofs(entity);
+  }
+
+  /** @copydoc DofHandler::GlobalDofIndices() */
+  lf::base::RandomAccessRange<const gdof_idx_t> GlobalDofIndices(
+      const lf::mesh::Entity &entity) const override;
+
+  /** @copydoc DofHandler::InteriorGlobalDofIndices() */
+  lf::base::RandomAccessRange<const gdof_idx_t> InteriorGlobalDofIndices(
+      const lf::mesh::Entity &entity) const override;
+
+  /**
+   * @brief Entity to which a global dof belongs
+   *
+   * Only available for dofs whose global index is known to the calling
+   * process.
+   */
+  const lf::mesh::Entity &Entity(gdof_idx_t dofnum) const override;
+
+  /** @brief the subdomain mesh */
+  std::shared_ptr<const lf::mesh::Mesh> Mesh() const override {
+    return local_dofh_.Mesh();
+  }
+
+  /** @name Information about the distribution of dofs */
+  /** @{ */
+  /** @brief the communicator */
+  MPI_Comm Comm() const { return comm_; }
+  /** @brief rank of the calling process */
+  int Rank() const { return rank_; }
+  /** @brief number of dofs owned by the calling process */
+  size_type NoOwnedDofs() const {
+    return dof_offsets_[rank_ + 1] - dof_offsets_[rank_];
+  }
+  /** @brief global index of the first owned dof */
+  gdof_idx_t FirstOwnedDof() const { return dof_offsets_[rank_]; }
+  /** @brief vector of length `nranks+1` with the ranges of owned dofs */
+  const std::vector<gdof_idx_t> &OwnedDofOffsets() const {
+    return dof_offsets_;
+  }
+  /** @brief rank owning a dof with a particular global index */
+  int OwnerRank(gdof_idx_t dofnum) const;
+  /** @brief tells whether a cell of the subdomain mesh belongs to the part */
+  bool IsOwnedCell(const lf::mesh::Entity &cell) const {
+    return !is_ghost_cell_[Mesh()->Index(cell)];
+  }
+  /** @brief dof handler for the subdomain mesh with the local numbering */
+  const lf::assemble::UniformFEDofHandler &LocalDofHandler() const {
+    return local_dofh_;
+  }
+  /** @brief global indices of all local dofs, -1 if not known */
+  const std::vector<gdof_idx_t> &LocalToGlobalDofs() const {
+    return local_to_global_;
+  }
+  /** @} */
+
+ private:
+  MPI_Comm comm_;
+  int rank_;
+  /** local numbering on the subdomain mesh */
+  lf::assemble::UniformFEDofHandler local_dofh_;
+  std::vector<bool> is_ghost_cell_;
+  /** global index for every local dof */
+  std::vector<gdof_idx_t> local_to_global_;
+  /** inverse of local_to_global_ */
+  std::unordered_map<gdof_idx_t, gdof_idx_t> global_to_local_;
+  /** offsets of owned index ranges for all ranks */
+  std::vector<gdof_idx_t> dof_offsets_;
+  /** global indices of covering and interior dofs of entities, flattened */
+  std::array<std::vector<gdof_idx_t>, 3> dofs_, int_dofs_;
+  /** offsets into dofs_ and int_dofs_ for every entity */
+  std::array<std::vector<size_type>, 3> offsets_, int_offsets_;
+};
+
+}  // namespace lf::distributed
+
+#endif
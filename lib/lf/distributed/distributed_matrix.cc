@@ -0,0 +1,170 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Implementation of row-distributed sparse matrices and parallel CG
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#include "distributed_matrix.h"
+#include <algorithm>
+#include <cmath>
+#include "communication.h"
+
+namespace lf::distributed {
+
+namespace {
+// Matrix entry sent to the owner of its row
+struct MatrixEntry {
+  gdof_idx_t row;
+  gdof_idx_t col;
+  double val;
+};
+}  // namespace
+
+DistributedMatrix::DistributedMatrix(
+    const DistributedDofHandler &dofh,
+    const std::vector<Eigen::Triplet<double>> &triplets)
+    : comm_(dofh.Comm()),
+      no_owned_(dofh.NoOwnedDofs()),
+      no_rows_(dofh.NoDofs()) {
+  const int nranks = CommSize(comm_);
+  const gdof_idx_t first = dofh.FirstOwnedDof();
+  const gdof_idx_t last = first + no_owned_;
+
+  // Send every entry to the owner of its row
+  std::vector<std::vector<MatrixEntry>> outgoing(nranks);
+  for (const Eigen::Triplet<double> &t : triplets) {
+    outgoing[dofh.OwnerRank(t.row())].push_back({t.row(), t.col(), t.value()});
+  }
+  const std::vector<std::vector<MatrixEntry>> incoming{
+      ExchangeLists(comm_, outgoing)};
+
+  // Ghost columns in ascending order
+  for (const auto &entries : incoming) {
+    for (const MatrixEntry &e : entries) {
+      if ((e.col < first) || (e.col >= last)) {
+        ghost_dofs_.push_back(e.col);
+      }
+    }
+  }
+  std::sort(ghost_dofs_.begin(), ghost_dofs_.end());
+  ghost_dofs_.erase(std::unique(ghost_dofs_.begin(), ghost_dofs_.end()),
+                    ghost_dofs_.end());
+
+  // Owned rows with local column numbering
+  std::vector<Eigen::Triplet<double>> local_triplets;
+  for (const auto &entries : incoming) {
+    for (const MatrixEntry &e : entries) {
+      gdof_idx_t col = e.col - first;
+      if ((e.col < first) || (e.col >= last)) {
+        col = no_owned_ + (std::lower_bound(ghost_dofs_.begin(),
+                                            ghost_dofs_.end(), e.col) -
+                           ghost_dofs_.begin());
+      }
+      local_triplets.emplace_back(e.row - first, col, e.val);
+    }
+  }
+  local_.resize(no_owned_, no_owned_ + ghost_dofs_.size());
+  local_.setFromTriplets(local_triplets.begin(), local_triplets.end());
+
+  // Communication pattern: ghost dofs owned by a rank are contiguous in
+  // ghost_dofs_, because ranks own contiguous index ranges
+  std::vector<std::vector<gdof_idx_t>> requests(nranks);
+  for (gdof_idx_t dof : ghost_dofs_) {
+    requests[dofh.OwnerRank(dof)].push_back(dof);
+  }
+  recv_cnt_.assign(nranks, 0);
+  recv_displ_.assign(nranks + 1, 0);
+  for (int r = 0; r < nranks; ++r) {
+    recv_cnt_[r] = static_cast<int>(requests[r].size());
+    recv_displ_[r + 1] = recv_displ_[r] + recv_cnt_[r];
+  }
+  const std::vector<std::vector<gdof_idx_t>> requested{
+      ExchangeLists(comm_, requests)};
+  send_cnt_.assign(nranks, 0);
+  send_displ_.assign(nranks + 1, 0);
+  for (int r = 0; r < nranks; ++r) {
+    send_cnt_[r] = static_cast<int>(requested[r].size());
+    send_displ_[r + 1] = send_displ_[r] + send_cnt_[r];
+    for (gdof_idx_t dof : requested[r]) {
+      LF_ASSERT_MSG((dof >= first) && (dof < last),
+                    "Dof " << dof << " requested from non-owner");
+      send_idx_.push_back(dof - first);
+    }
+  }
+}
+
+Eigen::VectorXd DistributedMatrix::GatherGhostValues(
+    const Eigen::VectorXd &x) const {
+  std::vector<double> send_buf(send_idx_.size());
+  for (std::size_t k = 0; k < send_idx_.size(); ++k) {
+    send_buf[k] = x[send_idx_[k]];
+  }
+  Eigen::VectorXd ghost_vals(ghost_dofs_.size());
+  MPI_Alltoallv(send_buf.data(), send_cnt_.data(), send_displ_.data(),
+                MPI_DOUBLE, ghost_vals.data(), recv_cnt_.data(),
+                recv_displ_.data(), MPI_DOUBLE, comm_);
+  return ghost_vals;
+}
+
+Eigen::VectorXd DistributedMatrix::Apply(const Eigen::VectorXd &x) const {
+  LF_ASSERT_MSG(x.size() == no_owned_,
+                "Vector length " << x.size() << " <-> " << no_owned_);
+  Eigen::VectorXd x_ext(local_.cols());
+  x_ext.head(no_owned_) = x;
+  x_ext.tail(ghost_dofs_.size()) = GatherGhostValues(x);
+  return local_ * x_ext;
+}
+
+Eigen::VectorXd DistributedMatrix::Diagonal() const {
+  Eigen::VectorXd diag(no_owned_);
+  for (Eigen::Index k = 0; k < no_owned_; ++k) {
+    diag[k] = local_.coeff(k, k);
+  }
+  return diag;
+}
+
+double Dot(MPI_Comm comm, const Eigen::VectorXd &x, const Eigen::VectorXd &y) {
+  double loc_dot = x.dot(y);
+  double dot;
+  MPI_Allreduce(&loc_dot, &dot, 1, MPI_DOUBLE, MPI_SUM, comm);
+  return dot;
+}
+
+CGResult DistributedCG(const DistributedMatrix &A, const Eigen::VectorXd &b,
+                       Eigen::VectorXd &x, double rtol, unsigned int maxit) {
+  MPI_Comm comm = A.Comm();
+  const Eigen::VectorXd inv_diag = A.Diagonal().cwiseInverse();
+  const double norm_b = std::sqrt(Dot(comm, b, b));
+  if (norm_b == 0.0) {
+    x.setZero();
+    return {true, 0, 0.0, norm_b};
+  }
+  Eigen::VectorXd r = b - A.Apply(x);
+  Eigen::VectorXd z = inv_diag.cwiseProduct(r);
+  Eigen::VectorXd p = z;
+  double rz = Dot(comm, r, z);
+  double norm_r = std::sqrt(Dot(comm, r, r));
+  unsigned int it = 0;
+  for (; it < maxit && norm_r > rtol * norm_b; ++it) {
+    const Eigen::VectorXd q = A.Apply(p);
+    const double alpha = rz / Dot(comm, p, q);
+    x += alpha * p;
+    r -= alpha * q;
+    z = inv_diag.cwiseProduct(r);
+    const double rz_new = Dot(comm, r, z);
+    p = z + (rz_new / rz) * p;
+    rz = rz_new;
+    norm_r = std::sqrt(Dot(comm, r, r));
+  }
+  return {norm_r <= rtol * norm_b, it, norm_r, norm_b};
+}
+
+}  // namespace lf::distributed
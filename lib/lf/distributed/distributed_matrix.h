@@ -0,0 +1,142 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Row-distributed sparse matrices and a parallel conjugate gradient
+ * solver
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#ifndef _LF_DISTRIBUTED_MATRIX_H_
+#define _LF_DISTRIBUTED_MATRIX_H_
+
+#include <Eigen/Sparse>
+#include "distributed_dofhandler.h"
+
+namespace lf::distributed {
+
+/**
+ * @brief Sparse matrix whose rows are distributed over the MPI processes
+ * according to the dof ownership of a DistributedDofHandler
+ *
+ * Distributed vectors are represented by the entries belonging to the owned
+ * dofs, stored in an `Eigen::VectorXd` of length
+ * DistributedDofHandler::NoOwnedDofs(); the k-th entry corresponds to the
+ * global dof `FirstOwnedDof()+k`.
+ *
+ * Internally the owned rows are stored in CRS format with the columns of
+ * owned dofs coming first and the columns of ghost dofs, that is, dofs owned
+ * by other processes, appended in ascending order of global index. The
+ * communication pattern for fetching ghost values is set up once in the
+ * constructor.
+ */
+class DistributedMatrix {
+ public:
+  using Scalar = double;
+  using CRSMatrix = Eigen::SparseMatrix<double, Eigen::RowMajor>;
+
+  /**
+   * @brief Set up a distributed matrix from locally assembled entries
+   *
+   * @param dofh distributed dof handler defining the row and column layout
+   * @param triplets matrix entries with global row and column indices, as
+   * produced, e.g., by AssembleDistributedMatrix(). Entries with equal
+   * indices are summed. Entries in rows owned by other processes are sent to
+   * their owners.
+   *
+   * This is a collective operation.
+   */
+  DistributedMatrix(const DistributedDofHandler &dofh,
+                    const std::vector<Eigen::Triplet<double>> &triplets);
+
+  /** @brief the communicator */
+  MPI_Comm Comm() const { return comm_; }
+  /** @brief number of owned rows */
+  size_type NoOwnedRows() const { return no_owned_; }
+  /** @brief total number of rows (and columns) */
+  size_type NoRows() const { return no_rows_; }
+  /** @brief owned rows with local column numbering, see class description */
+  const CRSMatrix &LocalMatrix() const { return local_; }
+  /** @brief global indices of ghost columns */
+  const std::vector<gdof_idx_t> &GhostDofs() const { return ghost_dofs_; }
+
+  /**
+   * @brief distributed matrix x vector product
+   *
+   * @param x owned part of the argument vector
+   * @return owned part of the product vector
+   *
+   * This is a collective operation.
+   */
+  Eigen::VectorXd Apply(const Eigen::VectorXd &x) const;
+
+  /** @brief owned part of the diagonal of the matrix */
+  Eigen::VectorXd Diagonal() const;
+
+ private:
+  /** @brief fetch values of ghost dofs from their owners */
+  Eigen::VectorXd GatherGhostValues(const Eigen::VectorXd &x) const;
+
+  MPI_Comm comm_;
+  size_type no_owned_, no_rows_;
+  CRSMatrix local_;
+  std::vector<gdof_idx_t> ghost_dofs_;
+  /** positions of the ghost values from each rank in the ghost vector */
+  std::vector<int> recv_cnt_, recv_displ_;
+  /** local indices of owned entries to be sent to each rank */
+  std::vector<int> send_cnt_, send_displ_;
+  std::vector<gdof_idx_t> send_idx_;
+};
+
+/**
+ * @brief Global Euclidean inner product of distributed vectors
+ *
+ * This is a collective operation.
+ */
+double Dot(MPI_Comm comm, const Eigen::VectorXd &x, const Eigen::VectorXd &y);
+
+/**
+ * @brief Outcome of DistributedCG()
+ */
+struct CGResult {
+  /** true if the residual dropped below the requested tolerance */
+  bool converged;
+  /** number of iterations performed */
+  unsigned int iterations;
+  /** Euclidean norm of the final residual b - A*x */
+  double residual;
+  /** Euclidean norm of the right hand side, the reference for the relative
+   * tolerance */
+  double norm_b;
+};
+
+/**
+ * @brief Jacobi-preconditioned conjugate gradient method for a symmetric
+ * positive definite distributed matrix
+ *
+ * @param A distributed s.p.d. matrix
+ * @param b owned part of the right hand side vector
+ * @param x owned part of the initial guess, overwritten with the approximate
+ * solution
+ * @param rtol relative tolerance for the Euclidean norm of the residual
+ * @param maxit maximal number of iterations
+ * @return convergence flag, number of iterations and final residual, see
+ * CGResult. If the tolerance is not met after `maxit` iterations,
+ * `converged` is false and `x` holds the last iterate.
+ *
+ * The iterates are the same on any number of processes up to roundoff.
+ * This is a collective operation.
+ */
+CGResult DistributedCG(const DistributedMatrix &A, const Eigen::VectorXd &b,
+                       Eigen::VectorXd &x, double rtol = 1.0E-10,
+                       unsigned int maxit = 1000);
+
+}  // namespace lf::distributed
+
+#endif
@@ -0,0 +1,215 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Tests for distributed dof numbering, assembly and solution; to be
+ * run with mpirun on any number of processes
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#include <gtest/gtest.h>
+#include <lf/distributed/distributed.h>
+#include <lf/fe/fe.h>
+#include <lf/mesh/hybrid2d/hybrid2d.h>
+#include <lf/mesh/test_utils/test_meshes.h>
+#include <lf/mesh/utils/utils.h>
+#include <Eigen/SparseLU>
+#include <map>
+#include <set>
+#include <tuple>
+
+namespace lf::distributed::test {
+
+std::shared_ptr<lf::mesh::Mesh> TestSquareMesh(size_type n) {
+  lf::mesh::hybrid2d::TPTriagMeshBuilder builder(
+      std::make_shared<lf::mesh::hybrid2d::MeshFactory>(2));
+  builder.setBottomLeftCorner(Eigen::Vector2d{0, 0})
+      .setTopRightCorner(Eigen::Vector2d{1, 1})
+      .setNoXCells(n)
+      .setNoYCells(n);
+  return builder.Build();
+}
+
+// Subdomain of the calling process
+lf::mesh::utils::SubDomainMesh MySubDomain(
+    const std::shared_ptr<const lf::mesh::Mesh> &mesh_p) {
+  const int nranks = CommSize(MPI_COMM_WORLD);
+  const auto cell_part = lf::mesh::utils::PartitionCellsRCB(*mesh_p, nranks);
+  lf::mesh::hybrid2d::MeshFactory factory(2);
+  return lf::mesh::utils::ExtractSubDomainMesh(
+      mesh_p, cell_part, CommRank(MPI_COMM_WORLD), factory);
+}
+
+// Item describing a global dof: codim, global entity index, position of
+// interior dof in canonical ordering, global dof index
+struct DofInfo {
+  glb_idx_t codim;
+  glb_idx_t entity;
+  glb_idx_t pos;
+  gdof_idx_t dof;
+};
+
+void CheckDofNumbering(const std::shared_ptr<lf::mesh::Mesh> &mesh_p,
+                       const DistributedDofHandler::dof_map_t &dofmap) {
+  const auto sub = MySubDomain(mesh_p);
+  const DistributedDofHandler dofh(MPI_COMM_WORLD, sub, dofmap);
+  const lf::assemble::UniformFEDofHandler serial_dofh(mesh_p, dofmap);
+  EXPECT_EQ(dofh.NoDofs(), serial_dofh.NoDofs());
+
+  // Collect information about all dofs of owned cells on rank 0
+  const lf::mesh::Mesh &mesh{*sub.mesh};
+  std::vector<std::vector<DofInfo>> infos(CommSize(MPI_COMM_WORLD));
+  for (const lf::mesh::Entity &cell : mesh.Entities(0)) {
+    if (!dofh.IsOwnedCell(cell)) {
+      continue;
+    }
+    for (dim_t codim = 0; codim <= 2; ++codim) {
+      for (const lf::mesh::Entity &e : cell.SubEntities(codim)) {
+        auto int_dofs = dofh.InteriorGlobalDofIndices(e);
+        const glb_idx_t n = int_dofs.end() - int_dofs.begin();
+        bool flip = false;
+        if (codim == 1) {
+          auto ep = e.SubEntities(1);
+          flip = sub.local_to_global[2][mesh.Index(ep[0])] >
+                 sub.local_to_global[2][mesh.Index(ep[1])];
+        }
+        for (glb_idx_t j = 0; j < n; ++j) {
+          EXPECT_GE(int_dofs[j], 0);
+          EXPECT_EQ(&dofh.Entity(int_dofs[j]), &e);
+          infos[0].push_back({codim, sub.local_to_global[codim][mesh.Index(e)],
+                              flip ? n - 1 - j : j, int_dofs[j]});
+        }
+      }
+    }
+  }
+  const auto all_infos = ExchangeLists(MPI_COMM_WORLD, infos);
+  if (CommRank(MPI_COMM_WORLD) == 0) {
+    std::map<std::tuple<glb_idx_t, glb_idx_t, glb_idx_t>, gdof_idx_t> key2dof;
+    std::map<gdof_idx_t, std::tuple<glb_idx_t, glb_idx_t, glb_idx_t>> dof2key;
+    for (const auto &rank_infos : all_infos) {
+      for (const DofInfo &info : rank_infos) {
+        const auto key = std::make_tuple(info.codim, info.entity, info.pos);
+        auto [it_k, new_k] = key2dof.insert({key, info.dof});
+        EXPECT_EQ(it_k->second, info.dof) << "Inconsistent dof numbering";
+        auto [it_d, new_d] = dof2key.insert({info.dof, key});
+        EXPECT_TRUE(it_d->second == key) << "Dof " << info.dof << " not unique";
+      }
+    }
+    ASSERT_EQ(dof2key.size(), dofh.NoDofs());
+    EXPECT_EQ(dof2key.begin()->first, 0);
+    EXPECT_EQ(dof2key.rbegin()->first, dofh.NoDofs() - 1);
+  }
+}
+
+TEST(lf_distributed, dof_numbering_linear) {
+  const DistributedDofHandler::dof_map_t dofmap{
+      {lf::base::RefEl::kPoint(), 1}};
+  CheckDofNumbering(TestSquareMesh(6), dofmap);
+  CheckDofNumbering(lf::mesh::test_utils::GenerateHybrid2DTestMesh(0), dofmap);
+}
+
+TEST(lf_distributed, dof_numbering_higher_order) {
+  const DistributedDofHandler::dof_map_t dofmap{
+      {lf::base::RefEl::kPoint(), 1},
+      {lf::base::RefEl::kSegment(), 2},
+      {lf::base::RefEl::kTria(), 1},
+      {lf::base::RefEl::kQuad(), 4}};
+  CheckDofNumbering(TestSquareMesh(6), dofmap);
+  CheckDofNumbering(lf::mesh::test_utils::GenerateHybrid2DTestMesh(0), dofmap);
+}
+
+// Solve -Delta u + u = f with natural boundary conditions in parallel and
+// compare with the serial solution
+void CheckSolve(const std::shared_ptr<lf::mesh::Mesh> &mesh_p) {
+  const DistributedDofHandler::dof_map_t dofmap{
+      {lf::base::RefEl::kPoint(), 1}};
+  lf::fe::TriaLinearLagrangeFE<double> tlfe{};
+  lf::fe::QuadLinearLagrangeFE<double> qlfe{};
+  auto alpha = [](Eigen::Vector2d /*x*/) -> double { return 1.0; };
+  auto gamma = [](Eigen::Vector2d /*x*/) -> double { return 1.0; };
+  auto f = [](Eigen::Vector2d x) -> double { return std::sin(x[0]) + x[1]; };
+  lf::fe::LagrangeFEEllBVPElementMatrix<decltype(alpha), decltype(gamma)>
+      elmat_builder(tlfe, qlfe, alpha, gamma);
+  lf::fe::LinearFELocalLoadVector<double, decltype(f)> elvec_builder(f);
+
+  // Serial reference solution
+  const lf::assemble::UniformFEDofHandler serial_dofh(mesh_p, dofmap);
+  const size_type N = serial_dofh.NoDofs();
+  lf::assemble::COOMatrix<double> A_coo(N, N);
+  lf::assemble::AssembleMatrixLocally(0, serial_dofh, serial_dofh,
+                                      elmat_builder, A_coo);
+  Eigen::VectorXd phi(N);
+  phi.setZero();
+  lf::assemble::AssembleVectorLocally(0, serial_dofh, elvec_builder, phi);
+  Eigen::SparseMatrix<double> A = A_coo.makeSparse();
+  Eigen::SparseLU<Eigen::SparseMatrix<double>> solver;
+  solver.compute(A);
+  const Eigen::VectorXd u_serial = solver.solve(phi);
+
+  // Distributed solution
+  const auto sub = MySubDomain(mesh_p);
+  const DistributedDofHandler dofh(MPI_COMM_WORLD, sub, dofmap);
+  const DistributedMatrix A_dist =
+      AssembleDistributedMatrix(dofh, elmat_builder);
+  const Eigen::VectorXd phi_dist =
+      AssembleDistributedVector(dofh, elvec_builder);
+  Eigen::VectorXd u_dist = Eigen::VectorXd::Zero(dofh.NoOwnedDofs());
+  const CGResult cg = DistributedCG(A_dist, phi_dist, u_dist, 1.0E-12, 1000);
+  EXPECT_TRUE(cg.converged);
+  EXPECT_LT(cg.iterations, 1000);
+  EXPECT_LE(cg.residual, 1.0E-12 * cg.norm_b);
+  // Too few iterations must be reported as failure
+  Eigen::VectorXd u_short = Eigen::VectorXd::Zero(dofh.NoOwnedDofs());
+  const CGResult cg_short =
+      DistributedCG(A_dist, phi_dist, u_short, 1.0E-12, 2);
+  EXPECT_FALSE(cg_short.converged);
+  EXPECT_EQ(cg_short.iterations, 2);
+  EXPECT_GT(cg_short.residual, 1.0E-12 * cg_short.norm_b);
+
+  // Compare values at nodes owned by this process
+  for (size_type k = 0; k < dofh.NoOwnedDofs(); ++k) {
+    const lf::mesh::Entity &node{dofh.Entity(dofh.FirstOwnedDof() + k)};
+    const glb_idx_t glb_node =
+        sub.local_to_global[2][sub.mesh->Index(node)];
+    const lf::mesh::Entity &serial_node{*mesh_p->EntityByIndex(2, glb_node)};
+    const gdof_idx_t serial_dof =
+        serial_dofh.InteriorGlobalDofIndices(serial_node)[0];
+    EXPECT_NEAR(u_dist[k], u_serial[serial_dof], 1.0E-9);
+    EXPECT_NEAR(phi_dist[k], phi[serial_dof], 1.0E-12);
+  }
+  // The residual of the distributed matrix must agree with the serial one
+  const Eigen::VectorXd res = A_dist.Apply(u_dist) - phi_dist;
+  EXPECT_LT(std::sqrt(Dot(MPI_COMM_WORLD, res, res)), 1.0E-10);
+}
+
+TEST(lf_distributed, solve_tria) { CheckSolve(TestSquareMesh(8)); }
+
+TEST(lf_distributed, solve_hybrid) {
+  CheckSolve(lf::mesh::test_utils::GenerateHybrid2DTestMesh(0));
+  CheckSolve(lf::mesh::test_utils::GenerateHybrid2DTestMesh(1));
+}
+
+}  // namespace lf::distributed::test
+
+int main(int argc, char **argv) {
+  MPI_Init(&argc, &argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  // Only rank 0 reports
+  if (lf::distributed::CommRank(MPI_COMM_WORLD) != 0) {
+    ::testing::TestEventListeners &listeners =
+        ::testing::UnitTest::GetInstance()->listeners();
+    delete listeners.Release(listeners.default_result_printer());
+  }
+  const int result = RUN_ALL_TESTS();
+  // Failure on any rank lets the whole test fail
+  int global_result;
+  MPI_Allreduce(&result, &global_result, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+  MPI_Finalize();
+  return global_result;
+}
@@ -0,0 +1,157 @@
+#ifndef LF_FE_COEFFICIENT_EVAL
+#define LF_FE_COEFFICIENT_EVAL
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Evaluation of coefficient functors at many points at once and
+ * coefficients whose properties are known at compile time
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace lf::fe {
+
+/**
+ * @brief Type of the value of a coefficient functor at a single point
+ *
+ * @tparam COEFF object with an evaluation operator of signature
+ * `T(const Eigen::Vector2d &)`, `T` usually being `double` or a 2x2 matrix
+ */
+template <typename COEFF>
+using coeff_value_t = std::decay_t<decltype(
+    std::declval<COEFF &>()(std::declval<const Eigen::Vector2d &>()))>;
+
+/**
+ * @brief Tells whether a coefficient functor supports evaluation at many
+ * points through one call
+ *
+ * This is the case, if `COEFF` has a method
+ * @code
+ * void EvalBatch(const Eigen::MatrixXd &pts,
+ *                std::vector<coeff_value_t<COEFF>> &vals);
+ * @endcode
+ * which stores the value of the coefficient at the point `pts.col(k)` in
+ * `vals[k]`. When `EvalBatch()` is called, `vals` already has size
+ * `pts.cols()`.
+ */
+template <typename COEFF, typename = void>
+struct HasEvalBatch : std::false_type {};
+
+template <typename COEFF>
+struct HasEvalBatch<
+    COEFF, std::void_t<decltype(std::declval<COEFF &>().EvalBatch(
+               std::declval<const Eigen::MatrixXd &>(),
+               std::declval<std::vector<coeff_value_t<COEFF>> &>()))>>
+    : std::true_type {};
+
+/**
+ * @brief Evaluate a coefficient functor at a set of points
+ *
+ * @param f coefficient functor, see coeff_value_t
+ * @param pts points as the columns of a `2 x n` matrix. They may belong to
+ * a single cell or to several cells.
+ * @param vals values at the points, resized to `n`
+ *
+ * If `f` supports the batched protocol described with HasEvalBatch, then
+ * `f.EvalBatch()` is called once. Otherwise `f` is called for every point.
+ * The batched protocol is meant for coefficients that are cheaper to
+ * evaluate at many points together, for instance vectorized closed-form
+ * expressions or coefficients interpolated from data on a mesh. For scalar
+ * coefficients `vals.data()` can be wrapped into an `Eigen::Map` and filled
+ * by array operations.
+ *
+ * The element matrix and vector providers in this module fetch all
+ * coefficient values of a cell through this function.
+ */
+template <typename COEFF>
+void EvalCoefficient(COEFF &f, const Eigen::MatrixXd &pts,
+                     std::vector<coeff_value_t<COEFF>> &vals) {
+  vals.resize(pts.cols());
+  if constexpr (HasEvalBatch<COEFF>::value) {
+    f.EvalBatch(pts, vals);
+  } else {
+    for (Eigen::Index k = 0; k < pts.cols(); ++k) {
+      vals[k] = f(pts.col(k));
+    }
+  }
+}
+
+/**
+ * @brief Coefficient functor that vanishes identically
+ *
+ * Element matrix providers recognize this type at compile time, see
+ * IsZeroCoefficient, and skip the corresponding terms of the bilinear form.
+ * For instance, the element matrices of the Laplacian are obtained from
+ * `LagrangeFEEllBVPElementMatrix<ConstantCoefficient<double>,
+ * ZeroCoefficient>`.
+ */
+struct ZeroCoefficient {
+  /** @brief the value 0 at every point */
+  static constexpr double Value() { return 0.0; }
+  double operator()(const Eigen::Vector2d & /*x*/) const { return 0.0; }
+  void EvalBatch(const Eigen::MatrixXd & /*pts*/,
+                 std::vector<double> &vals) const {
+    std::fill(vals.begin(), vals.end(), 0.0);
+  }
+};
+
+/**
+ * @brief Coefficient functor with the same value at every point
+ *
+ * @tparam T type of the value, e.g. `double` or `Eigen::Matrix2d`
+ *
+ * Element matrix providers recognize this type at compile time, see
+ * IsConstantCoefficient, and evaluate it only once per cell or not at all.
+ */
+template <typename T>
+class ConstantCoefficient {
+ public:
+  /** @brief Constructor taking the value of the coefficient */
+  explicit ConstantCoefficient(T value) : value_(std::move(value)) {}
+  /** @brief the value of the coefficient */
+  const T &Value() const { return value_; }
+  T operator()(const Eigen::Vector2d & /*x*/) const { return value_; }
+  void EvalBatch(const Eigen::MatrixXd & /*pts*/, std::vector<T> &vals) const {
+    std::fill(vals.begin(), vals.end(), value_);
+  }
+
+ private:
+  T value_;
+};
+
+/** @brief Tells whether `COEFF` is a ZeroCoefficient */
+template <typename COEFF>
+struct IsZeroCoefficient
+    : std::is_same<std::remove_cv_t<COEFF>, ZeroCoefficient> {};
+
+/**
+ * @brief Tells whether `COEFF` is a ZeroCoefficient or a
+ * ConstantCoefficient
+ *
+ * Objects of these types provide a method `Value()` returning the value of
+ * the coefficient.
+ */
+template <typename COEFF>
+struct IsConstantCoefficient : IsZeroCoefficient<COEFF> {};
+
+template <typename T>
+struct IsConstantCoefficient<ConstantCoefficient<T>> : std::true_type {};
+
+template <typename T>
+struct IsConstantCoefficient<const ConstantCoefficient<T>> : std::true_type {};
+
+}  // namespace lf::fe
+
+#endif
@@ -15,8 +15,15 @@
  * @copyright MIT License
  */
 
+#include "coefficient_eval.h"
+#include "fe_tools.h"
+#include "fixed_lagr_fe.h"
 #include "lagr_fe.h"
 #include "loc_comp_ellbvp.h"
+#include "multigrid.h"
+#include "prolongation.h"
+#include "quad_tensor_fe.h"
+#include "tria_laplace_batch.h"
 
 namespace lf::fe {}  // namespace lf::fe
 
@@ -0,0 +1,36 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Interpolation into Lagrangian finite element spaces and
+ * computation of discretization errors on a whole mesh
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#include "fe_tools.h"
+
+namespace lf::fe::detail {
+
+double CompensatedSum(const std::vector<double> &vals) {
+  double sum = 0.0;
+  double comp = 0.0;
+  for (const double v : vals) {
+    const double t = sum + v;
+    // Recover the low-order bits lost in the addition
+    if (std::abs(sum) >= std::abs(v)) {
+      comp += (sum - t) + v;
+    } else {
+      comp += (v - t) + sum;
+    }
+    sum = t;
+  }
+  return sum + comp;
+}
+
+}  // namespace lf::fe::detail
@@ -0,0 +1,315 @@
+#ifndef LF_FE_FE_TOOLS
+#define LF_FE_FE_TOOLS
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Interpolation into Lagrangian finite element spaces and
+ * computation of discretization errors on a whole mesh
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#include <lf/assemble/assemble.h>
+#include <lf/base/parallel_for.h>
+#include <lf/quad/quad.h>
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+#include "coefficient_eval.h"
+#include "lagr_fe.h"
+
+namespace lf::fe {
+
+namespace detail {
+
+/**
+ * @brief Sum of the entries of a vector by Neumaier's variant of Kahan's
+ * compensated summation
+ *
+ * The entries are added in their order in `vals`, so the result does not
+ * depend on how they were computed.
+ */
+double CompensatedSum(const std::vector<double> &vals);
+
+/**
+ * @brief Finite element for a cell, either `fe_tria` or `fe_quad`
+ */
+inline const ScalarReferenceFiniteElement<double> &SelectFE(
+    const lf::mesh::Entity &cell,
+    const ScalarReferenceFiniteElement<double> &fe_tria,
+    const ScalarReferenceFiniteElement<double> &fe_quad) {
+  LF_ASSERT_MSG((cell.RefEl() == lf::base::RefEl::kTria()) ||
+                    (cell.RefEl() == lf::base::RefEl::kQuad()),
+                "Illegal cell type " << cell.RefEl());
+  return (cell.RefEl() == lf::base::RefEl::kTria()) ? fe_tria : fe_quad;
+}
+
+/**
+ * @brief Compute one number per cell concurrently and add them up
+ *
+ * @param mesh the cells of this mesh are processed
+ * @param cell_fn functor `double(const lf::mesh::Entity &cell, CACHE &)`
+ * @param make_cache functor creating scratch space of type `CACHE` for
+ * `cell_fn`. Every chunk of cells processed by one thread has its own
+ * scratch space.
+ *
+ * The contributions of the cells are stored by cell index and summed up by
+ * CompensatedSum() afterwards. Hence the result does not depend on the
+ * number of threads.
+ */
+template <typename CELL_FN, typename MAKE_CACHE>
+double SumOverCells(const lf::mesh::Mesh &mesh, CELL_FN &&cell_fn,
+                    MAKE_CACHE &&make_cache) {
+  const size_type num_cells = mesh.Size(0);
+  std::vector<double> contrib(num_cells);
+  lf::base::ParallelFor(
+      num_cells,
+      [&](std::size_t first, std::size_t last) {
+        auto cache{make_cache()};
+        for (std::size_t i = first; i < last; ++i) {
+          contrib[i] = cell_fn(*mesh.EntityByIndex(0, i), cache);
+        }
+      },
+      256);
+  return CompensatedSum(contrib);
+}
+
+/**
+ * @brief Order of the quadrature rules used for computing errors
+ */
+inline lf::quad::quadOrder_t ErrorQuadOrder(
+    const ScalarReferenceFiniteElement<double> &fe_tria,
+    const ScalarReferenceFiniteElement<double> &fe_quad,
+    lf::quad::quadOrder_t quad_order) {
+  if (quad_order > 0) {
+    return quad_order;
+  }
+  return 2 * std::max(fe_tria.order(), fe_quad.order()) + 2;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Interpolation of a function into a Lagrangian finite element space
+ *
+ * @param dofh DofHandler for the finite element space, whose local numbering
+ * of the shape functions agrees with that of `fe_tria` and `fe_quad`
+ * @param fe_tria finite element on triangles
+ * @param fe_quad finite element on quadrilaterals
+ * @param u functor `double(const Eigen::Vector2d &)`, which may support the
+ * batched protocol described with HasEvalBatch
+ * @return the vector of degrees of freedom of the interpolant
+ *
+ * On every cell `u` is evaluated at the images of the evaluation nodes of
+ * the finite element and the local degrees of freedom are obtained through
+ * ScalarReferenceFiniteElement::NodalValuesToDofs(). The cells are processed
+ * concurrently, see lf::base::ParallelFor(). A degree of freedom shared by
+ * several cells is set only by the cell with the smallest index, so that the
+ * result is deterministic.
+ *
+ * @note `u` is invoked concurrently and must be safe to call from several
+ * threads.
+ */
+template <typename FUNCTOR>
+Eigen::VectorXd NodalProjection(
+    const lf::assemble::DofHandler &dofh,
+    const ScalarReferenceFiniteElement<double> &fe_tria,
+    const ScalarReferenceFiniteElement<double> &fe_quad, FUNCTOR &&u) {
+  using coeff_t = std::remove_reference_t<FUNCTOR>;
+  const lf::mesh::Mesh &mesh{*dofh.Mesh()};
+  LF_ASSERT_MSG((mesh.DimMesh() == 2) && (mesh.DimWorld() == 2),
+                "For 2D planar meshes only!");
+  const size_type num_cells = mesh.Size(0);
+  const size_type num_dofs = dofh.NoDofs();
+
+  // Index of the first cell to which a global shape function belongs
+  std::vector<size_type> owner(num_dofs, num_cells);
+  for (size_type i = 0; i < num_cells; ++i) {
+    for (const lf::assemble::gdof_idx_t dof :
+         dofh.GlobalDofIndices(*mesh.EntityByIndex(0, i))) {
+      if (owner[dof] == num_cells) {
+        owner[dof] = i;
+      }
+    }
+  }
+
+  const Eigen::MatrixXd nodes_tria{fe_tria.EvaluationNodes()};
+  const Eigen::MatrixXd nodes_quad{fe_quad.EvaluationNodes()};
+  Eigen::VectorXd dofs(num_dofs);
+  lf::base::ParallelFor(
+      num_cells,
+      [&](std::size_t first, std::size_t last) {
+        std::vector<coeff_value_t<coeff_t>> nodvals;
+        for (std::size_t i = first; i < last; ++i) {
+          const lf::mesh::Entity &cell{*mesh.EntityByIndex(0, i)};
+          const ScalarReferenceFiniteElement<double> &fe{
+              detail::SelectFE(cell, fe_tria, fe_quad)};
+          const Eigen::MatrixXd mapped_nodes{cell.Geometry()->Global(
+              (cell.RefEl() == lf::base::RefEl::kTria()) ? nodes_tria
+                                                         : nodes_quad)};
+          EvalCoefficient(u, mapped_nodes, nodvals);
+          const Eigen::Matrix<double, 1, Eigen::Dynamic> locdofs{
+              fe.NodalValuesToDofs(Eigen::Map<const Eigen::RowVectorXd>(
+                  nodvals.data(), nodvals.size()))};
+          const lf::base::RandomAccessRange<const lf::assemble::gdof_idx_t>
+              idx{dofh.GlobalDofIndices(cell)};
+          LF_ASSERT_MSG(dofh.NoLocalDofs(cell) == locdofs.size(),
+                        "#dofs mismatch on " << cell.RefEl());
+          for (Eigen::Index j = 0; j < locdofs.size(); ++j) {
+            if (owner[idx[j]] == i) {
+              dofs[idx[j]] = locdofs[j];
+            }
+          }
+        }
+      },
+      256);
+  return dofs;
+}
+
+/**
+ * @brief \f$L^2\f$-norm of the difference of a function and a finite element
+ * function
+ *
+ * @param dofh DofHandler for the finite element space, whose local numbering
+ * of the shape functions agrees with that of `fe_tria` and `fe_quad`
+ * @param fe_tria finite element on triangles
+ * @param fe_quad finite element on quadrilaterals
+ * @param mu vector of degrees of freedom of the finite element function
+ * @param u functor `double(const Eigen::Vector2d &)`, which may support the
+ * batched protocol described with HasEvalBatch
+ * @param quad_order order of the quadrature rules, 0 means twice the
+ * polynomial degree plus 2
+ *
+ * The integrals over the cells are computed by the quadrature rules of
+ * lf::quad::QuadRuleCache() concurrently and added up by compensated
+ * summation in the order of the cell indices. The result is independent of
+ * the number of threads.
+ *
+ * @note `u` is invoked concurrently and must be safe to call from several
+ * threads.
+ */
+template <typename FUNCTOR>
+double L2Error(const lf::assemble::DofHandler &dofh,
+               const ScalarReferenceFiniteElement<double> &fe_tria,
+               const ScalarReferenceFiniteElement<double> &fe_quad,
+               const Eigen::VectorXd &mu, FUNCTOR &&u,
+               lf::quad::quadOrder_t quad_order = 0) {
+  using coeff_t = std::remove_reference_t<FUNCTOR>;
+  LF_ASSERT_MSG(mu.size() == dofh.NoDofs(), "Vector length mismatch");
+  quad_order = detail::ErrorQuadOrder(fe_tria, fe_quad, quad_order);
+  const lf::quad::QuadRule &qr_tria{
+      lf::quad::QuadRuleCache(lf::base::RefEl::kTria(), quad_order)};
+  const lf::quad::QuadRule &qr_quad{
+      lf::quad::QuadRuleCache(lf::base::RefEl::kQuad(), quad_order)};
+  const auto tab_tria{fe_tria.Tabulation(qr_tria)};
+  const auto tab_quad{fe_quad.Tabulation(qr_quad)};
+
+  const double sum = detail::SumOverCells(
+      *dofh.Mesh(),
+      [&](const lf::mesh::Entity &cell,
+          std::vector<coeff_value_t<coeff_t>> &uvals) -> double {
+        const bool is_tria = (cell.RefEl() == lf::base::RefEl::kTria());
+        LF_ASSERT_MSG(is_tria || (cell.RefEl() == lf::base::RefEl::kQuad()),
+                      "Illegal cell type " << cell.RefEl());
+        const lf::quad::QuadRule &qr{is_tria ? qr_tria : qr_quad};
+        const ShapeFunctionTabulation<double> &tab{is_tria ? *tab_tria
+                                                           : *tab_quad};
+        const lf::geometry::Geometry &geo{*cell.Geometry()};
+        // Local coefficients of the finite element function
+        const lf::base::RandomAccessRange<const lf::assemble::gdof_idx_t> idx{
+            dofh.GlobalDofIndices(cell)};
+        Eigen::VectorXd mu_loc(dofh.NoLocalDofs(cell));
+        for (Eigen::Index j = 0; j < mu_loc.size(); ++j) {
+          mu_loc[j] = mu[idx[j]];
+        }
+        // Values of both functions at the quadrature points
+        const Eigen::VectorXd uh{tab.Values().transpose() * mu_loc};
+        EvalCoefficient(u, geo.Global(qr.Points()), uvals);
+        const Eigen::VectorXd dets{geo.IntegrationElement(qr.Points())};
+        double err = 0.0;
+        for (int k = 0; k < qr.NumPoints(); ++k) {
+          const double diff = uvals[k] - uh[k];
+          err += qr.Weights()[k] * dets[k] * diff * diff;
+        }
+        return err;
+      },
+      [] { return std::vector<coeff_value_t<coeff_t>>(); });
+  return std::sqrt(sum);
+}
+
+/**
+ * @brief \f$H^1\f$-seminorm of the difference of a function and a finite
+ * element function
+ *
+ * @param dofh DofHandler for the finite element space, whose local numbering
+ * of the shape functions agrees with that of `fe_tria` and `fe_quad`
+ * @param fe_tria finite element on triangles
+ * @param fe_quad finite element on quadrilaterals
+ * @param mu vector of degrees of freedom of the finite element function
+ * @param grad_u functor `Eigen::Vector2d(const Eigen::Vector2d &)` returning
+ * the gradient of the function
+ * @param quad_order order of the quadrature rules, 0 means twice the
+ * polynomial degree plus 2
+ *
+ * Concurrency and summation are the same as for L2Error().
+ */
+template <typename GRAD_FUNCTOR>
+double H1SemiError(const lf::assemble::DofHandler &dofh,
+                   const ScalarReferenceFiniteElement<double> &fe_tria,
+                   const ScalarReferenceFiniteElement<double> &fe_quad,
+                   const Eigen::VectorXd &mu, GRAD_FUNCTOR &&grad_u,
+                   lf::quad::quadOrder_t quad_order = 0) {
+  using grad_t = std::remove_reference_t<GRAD_FUNCTOR>;
+  LF_ASSERT_MSG(mu.size() == dofh.NoDofs(), "Vector length mismatch");
+  quad_order = detail::ErrorQuadOrder(fe_tria, fe_quad, quad_order);
+  const lf::quad::QuadRule &qr_tria{
+      lf::quad::QuadRuleCache(lf::base::RefEl::kTria(), quad_order)};
+  const lf::quad::QuadRule &qr_quad{
+      lf::quad::QuadRuleCache(lf::base::RefEl::kQuad(), quad_order)};
+  const auto tab_tria{fe_tria.Tabulation(qr_tria)};
+  const auto tab_quad{fe_quad.Tabulation(qr_quad)};
+
+  const double sum = detail::SumOverCells(
+      *dofh.Mesh(),
+      [&](const lf::mesh::Entity &cell,
+          std::vector<coeff_value_t<grad_t>> &grad_vals) -> double {
+        const bool is_tria = (cell.RefEl() == lf::base::RefEl::kTria());
+        LF_ASSERT_MSG(is_tria || (cell.RefEl() == lf::base::RefEl::kQuad()),
+                      "Illegal cell type " << cell.RefEl());
+        const lf::quad::QuadRule &qr{is_tria ? qr_tria : qr_quad};
+        const ShapeFunctionTabulation<double> &tab{is_tria ? *tab_tria
+                                                           : *tab_quad};
+        const lf::geometry::Geometry &geo{*cell.Geometry()};
+        // Local coefficients of the finite element function
+        const lf::base::RandomAccessRange<const lf::assemble::gdof_idx_t> idx{
+            dofh.GlobalDofIndices(cell)};
+        Eigen::VectorXd mu_loc(dofh.NoLocalDofs(cell));
+        for (Eigen::Index j = 0; j < mu_loc.size(); ++j) {
+          mu_loc[j] = mu[idx[j]];
+        }
+        EvalCoefficient(grad_u, geo.Global(qr.Points()), grad_vals);
+        const Eigen::VectorXd dets{geo.IntegrationElement(qr.Points())};
+        const Eigen::MatrixXd JinvT{geo.JacobianInverseGramian(qr.Points())};
+        double err = 0.0;
+        for (int k = 0; k < qr.NumPoints(); ++k) {
+          const Eigen::Vector2d grad_uh{JinvT.block(0, 2 * k, 2, 2) *
+                                        (tab.Gradients(k) * mu_loc)};
+          err += qr.Weights()[k] * dets[k] *
+                 (Eigen::Vector2d(grad_vals[k]) - grad_uh).squaredNorm();
+        }
+        return err;
+      },
+      [] { return std::vector<coeff_value_t<grad_t>>(); });
+  return std::sqrt(sum);
+}
+
+}  // namespace lf::fe
+
+#endif
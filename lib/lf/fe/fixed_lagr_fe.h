@@ -0,0 +1,382 @@
+#ifndef LF_FE_FIXED_LAGR_FE
+#define LF_FE_FIXED_LAGR_FE
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Lagrangian finite elements of low degree whose number of shape
+ * functions and quadrature points are known at compile time
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#include <lf/quad/quad.h>
+#include <array>
+#include <iostream>
+#include "coefficient_eval.h"
+#include "lagr_fe.h"
+
+namespace lf::fe {
+
+/**
+ * @brief Reference shape functions of Lagrangian finite elements of degree
+ * `DEGREE` with fixed-size return types
+ *
+ * Specializations exist for
+ * - `(kTria, 1)`: linear Lagrangian finite elements on triangles, the same
+ *   as TriaLinearLagrangeFE,
+ * - `(kTria, 2)`: quadratic Lagrangian finite elements on triangles,
+ * - `(kQuad, 1)`: bilinear Lagrangian finite elements, the same as
+ *   QuadLinearLagrangeFE,
+ * - `(kQuad, 2)`: biquadratic Lagrangian finite elements, the same as
+ *   `QuadTensorLagrangeFE<double>(2)`.
+ *
+ * The shape functions are numbered in the order expected by a
+ * lf::assemble::DofHandler: first the vertex functions, then those belonging
+ * to the midpoints of the edges and finally, for `(kQuad, 2)`, the function
+ * belonging to the center of the cell. Every specialization provides
+ * - the number `kNumRefShapeFunctions` of shape functions,
+ * - `Eval(x)`, which returns the values of all shape functions at the point
+ *   `x` of the reference cell as a fixed-size column vector,
+ * - `Gradients(x)`, which returns their gradients as the columns of a
+ *   fixed-size `2 x kNumRefShapeFunctions` matrix,
+ * - `EvaluationNodes()`, the interpolation nodes, whose ordering matches that
+ *   of the shape functions.
+ */
+template <base::RefElType REF_EL, int DEGREE>
+struct FixedLagrangeShapeFunctions;
+
+template <>
+struct FixedLagrangeShapeFunctions<base::RefElType::kTria, 1> {
+  static constexpr int kNumRefShapeFunctions = 3;
+  using vals_t = Eigen::Matrix<double, kNumRefShapeFunctions, 1>;
+  using grads_t = Eigen::Matrix<double, 2, kNumRefShapeFunctions>;
+
+  static vals_t Eval(const Eigen::Vector2d &x) {
+    return vals_t(1.0 - x[0] - x[1], x[0], x[1]);
+  }
+  static grads_t Gradients(const Eigen::Vector2d & /*x*/) {
+    return (grads_t() << -1.0, 1.0, 0.0, -1.0, 0.0, 1.0).finished();
+  }
+  static grads_t EvaluationNodes() {
+    return (grads_t() << 0.0, 1.0, 0.0, 0.0, 0.0, 1.0).finished();
+  }
+};
+
+template <>
+struct FixedLagrangeShapeFunctions<base::RefElType::kTria, 2> {
+  static constexpr int kNumRefShapeFunctions = 6;
+  using vals_t = Eigen::Matrix<double, kNumRefShapeFunctions, 1>;
+  using grads_t = Eigen::Matrix<double, 2, kNumRefShapeFunctions>;
+
+  // In terms of the barycentric coordinates l0, l1, l2 the vertex functions
+  // read li*(2*li-1) and the edge functions 4*li*lj
+  static vals_t Eval(const Eigen::Vector2d &x) {
+    const double l0 = 1.0 - x[0] - x[1];
+    const double l1 = x[0];
+    const double l2 = x[1];
+    vals_t vals;
+    vals << l0 * (2.0 * l0 - 1.0), l1 * (2.0 * l1 - 1.0),
+        l2 * (2.0 * l2 - 1.0), 4.0 * l0 * l1, 4.0 * l1 * l2, 4.0 * l2 * l0;
+    return vals;
+  }
+  static grads_t Gradients(const Eigen::Vector2d &x) {
+    const double l0 = 1.0 - x[0] - x[1];
+    const double l1 = x[0];
+    const double l2 = x[1];
+    grads_t grads;
+    // clang-format off
+    grads << 1.0 - 4.0 * l0, 4.0 * l1 - 1.0, 0.0,
+             4.0 * (l0 - l1), 4.0 * l2, -4.0 * l2,
+             1.0 - 4.0 * l0, 0.0, 4.0 * l2 - 1.0,
+             -4.0 * l1, 4.0 * l1, 4.0 * (l0 - l2);
+    // clang-format on
+    return grads;
+  }
+  static grads_t EvaluationNodes() {
+    grads_t nodes;
+    // clang-format off
+    nodes << 0.0, 1.0, 0.0, 0.5, 0.5, 0.0,
+             0.0, 0.0, 1.0, 0.0, 0.5, 0.5;
+    // clang-format on
+    return nodes;
+  }
+};
+
+template <>
+struct FixedLagrangeShapeFunctions<base::RefElType::kQuad, 1> {
+  static constexpr int kNumRefShapeFunctions = 4;
+  using vals_t = Eigen::Matrix<double, kNumRefShapeFunctions, 1>;
+  using grads_t = Eigen::Matrix<double, 2, kNumRefShapeFunctions>;
+
+  static vals_t Eval(const Eigen::Vector2d &x) {
+    return vals_t((1.0 - x[0]) * (1.0 - x[1]), x[0] * (1.0 - x[1]),
+                  x[0] * x[1], (1.0 - x[0]) * x[1]);
+  }
+  static grads_t Gradients(const Eigen::Vector2d &x) {
+    grads_t grads;
+    // clang-format off
+    grads << x[1] - 1.0, 1.0 - x[1], x[1], -x[1],
+             x[0] - 1.0, -x[0], x[0], 1.0 - x[0];
+    // clang-format on
+    return grads;
+  }
+  static grads_t EvaluationNodes() {
+    return (grads_t() << 0.0, 1.0, 1.0, 0.0, 0.0, 0.0, 1.0, 1.0).finished();
+  }
+};
+
+template <>
+struct FixedLagrangeShapeFunctions<base::RefElType::kQuad, 2> {
+  static constexpr int kNumRefShapeFunctions = 9;
+  using vals_t = Eigen::Matrix<double, kNumRefShapeFunctions, 1>;
+  using grads_t = Eigen::Matrix<double, 2, kNumRefShapeFunctions>;
+
+  // Quadratic 1D Lagrange polynomials for the nodes 0, 1 and 1/2 and their
+  // derivatives
+  static Eigen::Vector3d Eval1D(double t) {
+    return {(1.0 - t) * (1.0 - 2.0 * t), t * (2.0 * t - 1.0),
+            4.0 * t * (1.0 - t)};
+  }
+  static Eigen::Vector3d Derivatives1D(double t) {
+    return {4.0 * t - 3.0, 4.0 * t - 1.0, 4.0 - 8.0 * t};
+  }
+  // Indices of the 1D factors in x- and y-direction for each shape function
+  static constexpr std::array<int, kNumRefShapeFunctions> kIdxX{0, 1, 1, 0, 2,
+                                                                1, 2, 0, 2};
+  static constexpr std::array<int, kNumRefShapeFunctions> kIdxY{0, 0, 1, 1, 0,
+                                                                2, 1, 2, 2};
+
+  static vals_t Eval(const Eigen::Vector2d &x) {
+    const Eigen::Vector3d vx{Eval1D(x[0])};
+    const Eigen::Vector3d vy{Eval1D(x[1])};
+    vals_t vals;
+    for (int i = 0; i < kNumRefShapeFunctions; ++i) {
+      vals[i] = vx[kIdxX[i]] * vy[kIdxY[i]];
+    }
+    return vals;
+  }
+  static grads_t Gradients(const Eigen::Vector2d &x) {
+    const Eigen::Vector3d vx{Eval1D(x[0])};
+    const Eigen::Vector3d vy{Eval1D(x[1])};
+    const Eigen::Vector3d dx{Derivatives1D(x[0])};
+    const Eigen::Vector3d dy{Derivatives1D(x[1])};
+    grads_t grads;
+    for (int i = 0; i < kNumRefShapeFunctions; ++i) {
+      grads(0, i) = dx[kIdxX[i]] * vy[kIdxY[i]];
+      grads(1, i) = vx[kIdxX[i]] * dy[kIdxY[i]];
+    }
+    return grads;
+  }
+  static grads_t EvaluationNodes() {
+    const Eigen::Vector3d nodes_1d(0.0, 1.0, 0.5);
+    grads_t nodes;
+    for (int i = 0; i < kNumRefShapeFunctions; ++i) {
+      nodes(0, i) = nodes_1d[kIdxX[i]];
+      nodes(1, i) = nodes_1d[kIdxY[i]];
+    }
+    return nodes;
+  }
+};
+
+/**
+ * @brief Element matrices for the scalar second-order elliptic bilinear form
+ * with diffusion coefficient \f$\alpha\f$ and reaction coefficient
+ * \f$\gamma\f$ for low-degree Lagrangian finite elements, with all sizes
+ * fixed at compile time
+ *
+ * @tparam REF_EL type of the cells, `kTria` or `kQuad`
+ * @tparam DEGREE polynomial degree, see FixedLagrangeShapeFunctions for the
+ * supported combinations
+ * @tparam QUAD_ORDER order of the lf::quad::FixedQuadRule to be used
+ * @tparam DIFF_COEFF functor for the diffusion coefficient, returning a
+ * scalar or a 2x2 matrix
+ * @tparam REACTION_COEFF functor for the reaction coefficient
+ *
+ * This class computes the same element matrices as
+ * LagrangeFEEllBVPElementMatrix for the corresponding finite elements and
+ * the same quadrature rule. However, the element matrix, the tabulated shape
+ * functions and all temporaries in the quadrature loop are fixed-size Eigen
+ * objects. Thus `Eval()` performs no allocations apart from those inside
+ * lf::geometry::Geometry, and the compiler can unroll and vectorize the loops
+ * over quadrature points and shape functions.
+ *
+ * Only cells of type `REF_EL` are considered active. On hybrid meshes the
+ * element matrices for the other type of cell have to be assembled by
+ * a second call of lf::assemble::AssembleMatrixLocally() with another
+ * object.
+ *
+ * This class complies with the requirements for the type `ELEM_MAT_COMP`
+ * given as a template parameter to define an incarnation of the function
+ * AssembleMatrixLocally().
+ *
+ * #### Usage
+ * @code
+ * auto alpha = [](Eigen::Vector2d x) -> double { return 1.0; };
+ * auto gamma = [](Eigen::Vector2d x) -> double { return 0.0; };
+ * lf::fe::FixedLagrangeFEEllBVPElementMatrix<lf::base::RefEl::kTria(), 2, 4,
+ *     decltype(alpha), decltype(gamma)> elmat(alpha, gamma);
+ * @endcode
+ */
+template <base::RefElType REF_EL, int DEGREE, int QUAD_ORDER,
+          typename DIFF_COEFF, typename REACTION_COEFF>
+class FixedLagrangeFEEllBVPElementMatrix {
+ public:
+  /** @brief reference shape functions */
+  using rsf_t = FixedLagrangeShapeFunctions<REF_EL, DEGREE>;
+  /** @brief quadrature rule */
+  using qr_t = lf::quad::FixedQuadRule<REF_EL, QUAD_ORDER>;
+  /** @brief number of reference shape functions */
+  static constexpr int kNumRefShapeFunctions = rsf_t::kNumRefShapeFunctions;
+  /** @brief number of quadrature points */
+  static constexpr int kNumQuadPoints = qr_t::kNumPoints;
+
+  /**
+   * @brief type of returned element matrix
+   */
+  using elem_mat_t =
+      Eigen::Matrix<double, kNumRefShapeFunctions, kNumRefShapeFunctions>;
+  using ElemMat = const elem_mat_t;
+
+  /**
+   * @brief Constructor: tabulation of the reference shape functions in the
+   * quadrature points
+   */
+  FixedLagrangeFEEllBVPElementMatrix(DIFF_COEFF alpha, REACTION_COEFF gamma);
+  /**
+   * @brief Only cells of type `REF_EL` are active
+   */
+  virtual bool isActive(const lf::mesh::Entity &cell) {
+    return cell.RefEl() == REF_EL;
+  }
+  /*
+   * @brief main routine for the computation of element matrices
+   *
+   * @param cell reference to a cell of type `REF_EL`
+   * @return the fixed-size element matrix
+   */
+  ElemMat Eval(const lf::mesh::Entity &cell);
+
+ private:
+  /**
+   * @brief functors providing coefficient functions
+   */
+  DIFF_COEFF alpha_;
+  REACTION_COEFF gamma_;
+  /**
+   * @brief quadrature points as a dynamic matrix, as required by the
+   * methods of lf::geometry::Geometry
+   */
+  Eigen::MatrixXd ref_qpts_;
+  /**
+   * @brief values of the reference shape functions, one column per
+   * quadrature point
+   */
+  Eigen::Matrix<double, kNumRefShapeFunctions, kNumQuadPoints> rsf_vals_;
+  /**
+   * @brief gradients of the reference shape functions, the columns
+   * `k*kNumRefShapeFunctions ... (k+1)*kNumRefShapeFunctions-1` belong to
+   * quadrature point `k`
+   */
+  Eigen::Matrix<double, 2, kNumRefShapeFunctions * kNumQuadPoints> rsf_grads_;
+  /**
+   * @brief values of the coefficients at the quadrature points of the
+   * current cell, see EvalCoefficient()
+   */
+  std::vector<coeff_value_t<DIFF_COEFF>> alpha_vals_;
+  std::vector<coeff_value_t<REACTION_COEFF>> gamma_vals_;
+
+ public:
+  /** @brief output control variable
+   */
+  static unsigned int ctrl_;
+  static const unsigned int kout_cell = 8;
+  static const unsigned int kout_locmat = 16;
+};
+
+template <base::RefElType REF_EL, int DEGREE, int QUAD_ORDER,
+          typename DIFF_COEFF, typename REACTION_COEFF>
+unsigned int FixedLagrangeFEEllBVPElementMatrix<
+    REF_EL, DEGREE, QUAD_ORDER, DIFF_COEFF, REACTION_COEFF>::ctrl_ = 0;
+
+template <base::RefElType REF_EL, int DEGREE, int QUAD_ORDER,
+          typename DIFF_COEFF, typename REACTION_COEFF>
+FixedLagrangeFEEllBVPElementMatrix<REF_EL, DEGREE, QUAD_ORDER, DIFF_COEFF,
+                                   REACTION_COEFF>::
+    FixedLagrangeFEEllBVPElementMatrix(DIFF_COEFF alpha, REACTION_COEFF gamma)
+    : alpha_(alpha), gamma_(gamma), ref_qpts_(qr_t::Points()) {
+  for (int k = 0; k < kNumQuadPoints; ++k) {
+    rsf_vals_.col(k) = rsf_t::Eval(ref_qpts_.col(k));
+    rsf_grads_.template middleCols<kNumRefShapeFunctions>(
+        k * kNumRefShapeFunctions) = rsf_t::Gradients(ref_qpts_.col(k));
+  }
+}
+
+template <base::RefElType REF_EL, int DEGREE, int QUAD_ORDER,
+          typename DIFF_COEFF, typename REACTION_COEFF>
+typename FixedLagrangeFEEllBVPElementMatrix<
+    REF_EL, DEGREE, QUAD_ORDER, DIFF_COEFF, REACTION_COEFF>::ElemMat
+FixedLagrangeFEEllBVPElementMatrix<REF_EL, DEGREE, QUAD_ORDER, DIFF_COEFF,
+                                   REACTION_COEFF>::Eval(const lf::mesh::Entity
+                                                             &cell) {
+  LF_ASSERT_MSG(cell.RefEl() == REF_EL, "Illegal cell type " << cell.RefEl());
+  // Query the shape of the cell
+  const lf::geometry::Geometry *geo_ptr = cell.Geometry();
+  LF_ASSERT_MSG(geo_ptr != nullptr, "Invalid geometry!");
+  LF_ASSERT_MSG((geo_ptr->DimGlobal() == 2) && (geo_ptr->DimLocal() == 2),
+                "Only 2D implementation available!");
+  SWITCHEDSTATEMENT(ctrl_, kout_cell,
+                    std::cout << cell.RefEl() << ", shape = \n"
+                              << geo_ptr->Global(cell.RefEl().NodeCoords())
+                              << std::endl);
+
+  // Quadrature points in actual cell
+  const Eigen::MatrixXd mapped_qpts(geo_ptr->Global(ref_qpts_));
+  // Obtain the metric factors for the quadrature points
+  const Eigen::Matrix<double, kNumQuadPoints, 1> determinants(
+      geo_ptr->IntegrationElement(ref_qpts_));
+  // Fetch the transformation matrices for the gradients
+  const Eigen::Matrix<double, 2, 2 * kNumQuadPoints> JinvT(
+      geo_ptr->JacobianInverseGramian(ref_qpts_));
+  // Evaluate diffusion and reaction coefficient
+  // at quadrature points in actual cell
+  EvalCoefficient(alpha_, mapped_qpts, alpha_vals_);
+  EvalCoefficient(gamma_, mapped_qpts, gamma_vals_);
+
+  // Element matrix
+  elem_mat_t mat = elem_mat_t::Zero();
+
+  // Loop over quadrature points
+  for (int k = 0; k < kNumQuadPoints; ++k) {
+    const double w = qr_t::Weights()[k] * determinants[k];
+    // Terms with a ZeroCoefficient are skipped
+    if constexpr (!IsZeroCoefficient<DIFF_COEFF>::value) {
+      // Transformed gradients
+      const Eigen::Matrix<double, 2, kNumRefShapeFunctions> trf_grad(
+          JinvT.template block<2, 2>(0, 2 * k) *
+          rsf_grads_.template middleCols<kNumRefShapeFunctions>(
+              k * kNumRefShapeFunctions));
+      // Transformed gradients multiplied with coefficient
+      const Eigen::Matrix<double, 2, kNumRefShapeFunctions> alpha_trf_grad(
+          alpha_vals_[k] * trf_grad);
+      mat.noalias() += w * (alpha_trf_grad.transpose() * trf_grad);
+    }
+    if constexpr (!IsZeroCoefficient<REACTION_COEFF>::value) {
+      mat.noalias() += (w * gamma_vals_[k]) *
+                       (rsf_vals_.col(k) * rsf_vals_.col(k).transpose());
+    }
+  }
+  SWITCHEDSTATEMENT(ctrl_, kout_locmat,
+                    std::cout << "element matrix = \n"
+                              << mat << std::endl);
+  return mat;
+}
+
+}  // namespace lf::fe
+
+#endif
@@ -15,6 +15,9 @@
  */
 
 #include <lf/assemble/dofhandler.h>
+#include <lf/quad/quad_rule.h>
+#include <memory>
+#include <mutex>
 
 namespace lf::fe {
 /** Type for indices into global matrices/vectors */
@@ -30,6 +33,144 @@ using glb_idx_t = lf::assemble::glb_idx_t;
 /** Type for indexing sub-entities */
 using sub_idx_t = lf::base::sub_idx_t;
 
+template <typename SCALAR>
+class ScalarReferenceFiniteElement;
+
+/**
+ * @brief Values and gradients of _all_ reference shape functions of a
+ * ScalarReferenceFiniteElement at a set of points, stored in one contiguous
+ * buffer
+ *
+ * For \f$ M \f$ reference shape functions, \f$ N \f$ points and reference
+ * dimension \f$ d \f$ the buffer has the following layout:
+ * - Positions `0 ... M*N-1` contain the values as a column major `M x N`
+ *   matrix: the value of shape function `i` at point `k` is stored at
+ *   position `i + M*k`.
+ * - Starting at GradientOffset(M,N), which is `M*N` rounded up to a multiple
+ *   of kAlign, the gradients are stored as a column major `d x (M*N)`
+ *   matrix: component `j` of the gradient of shape function `i` at point `k`
+ *   is at position `GradientOffset(M,N) + j + d*(i + M*k)`. Thus the columns
+ *   `M*k ... M*k+M-1` form the `d x M` matrix of all gradients at point `k`.
+ *
+ * Both blocks start at addresses aligned for Eigen's vectorized operations,
+ * provided that the buffer itself is. Objects of this class own such an
+ * aligned buffer; ScalarReferenceFiniteElement::Tabulate() fills buffers
+ * supplied by the caller.
+ */
+template <typename SCALAR>
+class ShapeFunctionTabulation {
+ public:
+  /** @brief Alignment of the blocks in units of `SCALAR` */
+  static constexpr size_type kAlign =
+      (EIGEN_MAX_ALIGN_BYTES > sizeof(SCALAR))
+          ? EIGEN_MAX_ALIGN_BYTES / sizeof(SCALAR)
+          : 1;
+
+  /** @brief Position of the first gradient entry in the buffer */
+  static constexpr size_type GradientOffset(size_type num_rsf,
+                                            size_type num_points) {
+    return ((num_rsf * num_points + kAlign - 1) / kAlign) * kAlign;
+  }
+  /** @brief Required length of a buffer */
+  static constexpr size_type BufferSize(dim_t dim, size_type num_rsf,
+                                        size_type num_points) {
+    return GradientOffset(num_rsf, num_points) + dim * num_rsf * num_points;
+  }
+
+  /**
+   * @brief Tabulate the reference shape functions of a finite element
+   * @param fe the finite element
+   * @param refcoords points passed as columns of a `dim x N` matrix
+   */
+  ShapeFunctionTabulation(const ScalarReferenceFiniteElement<SCALAR>& fe,
+                          const Eigen::MatrixXd& refcoords);
+
+  /** @brief number \f$ M \f$ of reference shape functions */
+  size_type NumRefShapeFunctions() const { return num_rsf_; }
+  /** @brief number \f$ N \f$ of points */
+  size_type NumPoints() const { return num_points_; }
+  /** @brief dimension \f$ d \f$ of the reference element */
+  dim_t Dimension() const { return dim_; }
+  /** @brief the buffer in the layout described above */
+  const SCALAR* data() const { return buffer_.data(); }
+
+  /** @brief `M x N` matrix of all values */
+  Eigen::Map<const Eigen::Matrix<SCALAR, Eigen::Dynamic, Eigen::Dynamic>,
+             Eigen::AlignedMax>
+  Values() const {
+    return {buffer_.data(), num_rsf_, num_points_};
+  }
+  /** @brief `d x (M*N)` matrix of all gradients */
+  Eigen::Map<const Eigen::Matrix<SCALAR, Eigen::Dynamic, Eigen::Dynamic>,
+             Eigen::AlignedMax>
+  Gradients() const {
+    return {buffer_.data() + GradientOffset(num_rsf_, num_points_), dim_,
+            num_rsf_ * num_points_};
+  }
+  /** @brief `d x M` matrix of the gradients at point `k` */
+  Eigen::Map<const Eigen::Matrix<SCALAR, Eigen::Dynamic, Eigen::Dynamic>>
+  Gradients(size_type k) const {
+    return {buffer_.data() + GradientOffset(num_rsf_, num_points_) +
+                dim_ * num_rsf_ * k,
+            dim_, num_rsf_};
+  }
+
+ private:
+  dim_t dim_;
+  size_type num_rsf_, num_points_;
+  std::vector<SCALAR, Eigen::aligned_allocator<SCALAR>> buffer_;
+};
+
+namespace detail {
+/**
+ * @brief Thread-safe store of the tabulations of a finite element for the
+ * point sets of quadrature rules
+ *
+ * Copies of the cache start empty, so that finite element objects remain
+ * copyable.
+ */
+template <typename SCALAR>
+class TabulationCache {
+ public:
+  TabulationCache() = default;
+  TabulationCache(const TabulationCache& /*other*/) {}
+  TabulationCache(TabulationCache&& /*other*/) noexcept {}
+  // NOLINTNEXTLINE
+  TabulationCache& operator=(const TabulationCache& /*other*/) {
+    return *this;
+  }
+  // NOLINTNEXTLINE
+  TabulationCache& operator=(TabulationCache&& /*other*/) noexcept {
+    return *this;
+  }
+  ~TabulationCache() = default;
+
+  /** @brief Fetch the tabulation for the given points, build it if needed */
+  std::shared_ptr<const ShapeFunctionTabulation<SCALAR>> Get(
+      const ScalarReferenceFiniteElement<SCALAR>& fe,
+      const Eigen::MatrixXd& refcoords) const {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& entry : entries_) {
+      if ((entry.first.rows() == refcoords.rows()) &&
+          (entry.first.cols() == refcoords.cols()) &&
+          (entry.first == refcoords)) {
+        return entry.second;
+      }
+    }
+    entries_.emplace_back(
+        refcoords,
+        std::make_shared<const ShapeFunctionTabulation<SCALAR>>(fe, refcoords));
+    return entries_.back().second;
+  }
+
+ private:
+  mutable std::mutex mutex_;
+  mutable std::vector<std::pair<
+      Eigen::MatrixXd, std::shared_ptr<const ShapeFunctionTabulation<SCALAR>>>>
+      entries_;
+};
+}  // namespace detail
+
 /**
  * @brief Interface class for parametric scalar valued finite elements
  *
@@ -166,6 +307,63 @@ class ScalarReferenceFiniteElement {
   virtual std::vector<Eigen::Matrix<SCALAR, Eigen::Dynamic, Eigen::Dynamic>>
   GradientsReferenceShapeFunctions(const Eigen::MatrixXd& refcoords) const = 0;
 
+  /**
+   * @brief Values and gradients of _all_ reference shape functions in a
+   * number of points, written into a single buffer
+   *
+   * @param refcoords coordinates of N points in the reference cell passed as
+   *                  columns of a matrix of size dim x N.
+   * @param buffer caller-provided storage of length
+   *        `ShapeFunctionTabulation<SCALAR>::BufferSize(Dimension(),
+   *        NumRefShapeFunctions(), N)`, which receives the data in the layout
+   *        described for ShapeFunctionTabulation. It should be aligned to
+   *        `EIGEN_MAX_ALIGN_BYTES`, e.g., by allocating it with
+   *        `Eigen::aligned_allocator`.
+   *
+   * The default implementation copies the results of
+   * EvalReferenceShapeFunctions() and GradientsReferenceShapeFunctions().
+   * Finite elements should override it to write into the buffer directly.
+   */
+  virtual void Tabulate(const Eigen::MatrixXd& refcoords,
+                        SCALAR* buffer) const {
+    const size_type n_rsf = NumRefShapeFunctions();
+    const size_type n_pts = refcoords.cols();
+    const dim_t dim = Dimension();
+    Eigen::Map<Eigen::Matrix<SCALAR, Eigen::Dynamic, Eigen::Dynamic>> vals(
+        buffer, n_rsf, n_pts);
+    Eigen::Map<Eigen::Matrix<SCALAR, Eigen::Dynamic, Eigen::Dynamic>> grads(
+        buffer +
+            ShapeFunctionTabulation<SCALAR>::GradientOffset(n_rsf, n_pts),
+        dim, n_rsf * n_pts);
+    const auto rsf_val{EvalReferenceShapeFunctions(refcoords)};
+    const auto rsf_grad{GradientsReferenceShapeFunctions(refcoords)};
+    LF_ASSERT_MSG((rsf_val.size() == n_rsf) && (rsf_grad.size() == n_rsf),
+                  "Mismatch in number of shape functions");
+    for (size_type i = 0; i < n_rsf; ++i) {
+      vals.row(i) = rsf_val[i];
+      for (size_type k = 0; k < n_pts; ++k) {
+        grads.col(i + n_rsf * k) = rsf_grad[i].col(k);
+      }
+    }
+  }
+
+  /**
+   * @brief Tabulation of values and gradients of _all_ reference shape
+   * functions in the points of a quadrature rule
+   *
+   * @param qr quadrature rule on RefEl()
+   * @return shared, immutable tabulation for the points of `qr`
+   *
+   * Tabulations are cached: the first request for a set of points computes
+   * it by Tabulate(), later requests with the same points return the same
+   * object. This method is thread-safe.
+   */
+  std::shared_ptr<const ShapeFunctionTabulation<SCALAR>> Tabulation(
+      const lf::quad::QuadRule& qr) const {
+    LF_ASSERT_MSG(qr.RefEl() == ref_el_, "Quadrature rule on wrong cell type");
+    return tabulation_cache_.Get(*this, qr.Points());
+  }
+
   /**
    * @brief Returns positions of "reference" points for nodal interpolation
    *
@@ -214,8 +412,24 @@ class ScalarReferenceFiniteElement {
   const lf::base::RefEl ref_el_;
   /** polynomial order */
   const unsigned int order_;
+
+ private:
+  /** tabulations returned by Tabulation() */
+  detail::TabulationCache<SCALAR> tabulation_cache_;
 };
 
+template <typename SCALAR>
+ShapeFunctionTabulation<SCALAR>::ShapeFunctionTabulation(
+    const ScalarReferenceFiniteElement<SCALAR>& fe,
+    const Eigen::MatrixXd& refcoords)
+    : dim_(fe.Dimension()),
+      num_rsf_(fe.NumRefShapeFunctions()),
+      num_points_(refcoords.cols()),
+      buffer_(BufferSize(dim_, num_rsf_, num_points_)) {
+  LF_ASSERT_MSG(refcoords.rows() == dim_, "Dimension mismatch");
+  fe.Tabulate(refcoords, buffer_.data());
+}
+
 /**
  * @brief Linear Lagrange finite element on triangular reference element
  *
@@ -284,6 +498,25 @@ class TriaLinearLagrangeFE final : public ScalarReferenceFiniteElement<SCALAR> {
     return ret;
   }
 
+  /** @copydoc ScalarReferenceFiniteElement::Tabulate() */
+  void Tabulate(const Eigen::MatrixXd& refcoords,
+                SCALAR* buffer) const override {
+    LF_ASSERT_MSG(refcoords.rows() == 2,
+                  "Reference coordinates must be 2-vectors");
+    const size_type n_pts(refcoords.cols());
+    Eigen::Map<Eigen::Matrix<SCALAR, 3, Eigen::Dynamic>> vals(buffer, 3,
+                                                              n_pts);
+    vals.row(0) = Eigen::Matrix<SCALAR, 1, Eigen::Dynamic>::Ones(n_pts) -
+                  refcoords.row(0) - refcoords.row(1);
+    vals.bottomRows(2) = refcoords;
+    Eigen::Map<Eigen::Matrix<SCALAR, 6, Eigen::Dynamic>> grads(
+        buffer + ShapeFunctionTabulation<SCALAR>::GradientOffset(3, n_pts), 6,
+        n_pts);
+    grads.colwise() =
+        (Eigen::Matrix<SCALAR, 6, 1>() << -1.0, -1.0, 1.0, 0.0, 0.0, 1.0)
+            .finished();
+  }
+
   /** @brief Evalutation nodes are just the vertices of the triangle
    * @copydoc ScalarReferenceFiniteElement::EvaluationNodes()
    */
@@ -365,6 +598,34 @@ class QuadLinearLagrangeFE final : public ScalarReferenceFiniteElement<SCALAR> {
     return ret;
   }
 
+  /** @copydoc ScalarReferenceFiniteElement::Tabulate() */
+  void Tabulate(const Eigen::MatrixXd& refcoords,
+                SCALAR* buffer) const override {
+    LF_ASSERT_MSG(refcoords.rows() == 2,
+                  "Reference coordinates must be 2-vectors");
+    const size_type n_pts(refcoords.cols());
+    const auto x{refcoords.row(0).array()};
+    const auto y{refcoords.row(1).array()};
+    Eigen::Map<Eigen::Array<SCALAR, 4, Eigen::Dynamic>> vals(buffer, 4,
+                                                             n_pts);
+    vals.row(0) = (1 - x) * (1 - y);
+    vals.row(1) = x * (1 - y);
+    vals.row(2) = x * y;
+    vals.row(3) = (1 - x) * y;
+    // Gradients of the four shape functions stacked into 8-vectors
+    Eigen::Map<Eigen::Array<SCALAR, 8, Eigen::Dynamic>> grads(
+        buffer + ShapeFunctionTabulation<SCALAR>::GradientOffset(4, n_pts), 8,
+        n_pts);
+    grads.row(0) = y - 1.0;
+    grads.row(1) = x - 1.0;
+    grads.row(2) = 1.0 - y;
+    grads.row(3) = -x;
+    grads.row(4) = y;
+    grads.row(5) = x;
+    grads.row(6) = -y;
+    grads.row(7) = 1.0 - x;
+  }
+
   Eigen::MatrixXd EvaluationNodes() const override {
     return ScalarReferenceFiniteElement<SCALAR>::RefEl().NodeCoords();
   }
@@ -16,7 +16,9 @@
  */
 
 #include <lf/quad/quad.h>
+#include <array>
 #include <iostream>
+#include "coefficient_eval.h"
 #include "lagr_fe.h"
 
 namespace lf::fe {
@@ -204,7 +206,18 @@ LinearFELocalLoadVector<SCALAR, FUNCTOR>::Eval(const lf::mesh::Entity &cell) {
  * @brief Class for local quadrature based computations for Lagrangian finite
  * elements
  *
+ * @tparam DIFF_COEFF functor for the diffusion coefficient, returning a
+ * scalar or a 2x2 matrix
+ * @tparam REACTION_COEFF functor for the reaction coefficient
  *
+ * Coefficients of type ZeroCoefficient or ConstantCoefficient are treated
+ * specially:
+ * - terms with a ZeroCoefficient are skipped,
+ * - a ConstantCoefficient is not evaluated at the quadrature points,
+ * - if both coefficients are constant, the element matrix of an affine cell
+ *   is a combination of element matrices of the reference cell, which are
+ *   computed in the constructor, with weights determined by the constant
+ *   Jacobian of the cell.
  */
 template <typename DIFF_COEFF, typename REACTION_COEFF>
 class LagrangeFEEllBVPElementMatrix {
@@ -246,6 +259,28 @@ class LagrangeFEEllBVPElementMatrix {
   ElemMat Eval(const lf::mesh::Entity &cell);
 
  private:
+  static constexpr bool kZeroDiff = IsZeroCoefficient<DIFF_COEFF>::value;
+  static constexpr bool kZeroReac = IsZeroCoefficient<REACTION_COEFF>::value;
+  static constexpr bool kConstCoeffs =
+      IsConstantCoefficient<DIFF_COEFF>::value &&
+      IsConstantCoefficient<REACTION_COEFF>::value;
+
+  /**
+   * @brief Element matrix of a cell, common to all types of cells
+   */
+  elem_mat_t EvalCell(const lf::geometry::Geometry &geo,
+                      const lf::quad::QuadRule &qr,
+                      const ShapeFunctionTabulation<double> &tab,
+                      const std::array<Eigen::MatrixXd, 4> &ref_stiff,
+                      const Eigen::MatrixXd &ref_mass);
+  /**
+   * @brief Computation of the element matrices of the reference cell
+   */
+  static void ReferenceMatrices(const lf::quad::QuadRule &qr,
+                                const ShapeFunctionTabulation<double> &tab,
+                                std::array<Eigen::MatrixXd, 4> &ref_stiff,
+                                Eigen::MatrixXd &ref_mass);
+
   /**
    * @brief functors providing coefficient functions
    */
@@ -269,18 +304,29 @@ class LagrangeFEEllBVPElementMatrix {
    */
   lf::quad::QuadRule qr_tria_, qr_quad_;
   /**
-   * @brief Matrix of values of all reference shape functions at all quadrature
-   * points
+   * @brief Values and gradients of all reference shape functions at all
+   * quadrature points, shared with all other users of the finite elements
    *
-   * The rows correspond to the RSFs, the columns to the quadrature points
+   * See ShapeFunctionTabulation for the layout.
    */
-  Eigen::MatrixXd rsf_quadpoints_tria_, rsf_quadpoints_quad_;
+  std::shared_ptr<const ShapeFunctionTabulation<double>> tab_tria_, tab_quad_;
   /**
-   * @brief array of matrices whose columns contain the gradients of all RFSs in
-   *        a single quadrature point
+   * @brief values of the coefficients at the quadrature points of the
+   * current cell, see EvalCoefficient()
    */
-  std::vector<Eigen::Matrix<double, 2, Eigen::Dynamic>> grad_quadpoint_tria_,
-      grad_quadpoint_quad_;
+  std::vector<coeff_value_t<DIFF_COEFF>> alpha_vals_;
+  std::vector<coeff_value_t<REACTION_COEFF>> gamma_vals_;
+  /**
+   * @brief Element matrices of the reference cells, only computed if both
+   * coefficients are constant
+   *
+   * `ref_stiff_X_[2*a+b]` has the entries \f$ \sum_k\omega_k
+   * \partial_a\hat{b}^i(\hat{x}_k)\partial_b\hat{b}^j(\hat{x}_k) \f$, and
+   * `ref_mass_X_` has the entries \f$ \sum_k\omega_k
+   * \hat{b}^i(\hat{x}_k)\hat{b}^j(\hat{x}_k) \f$.
+   */
+  std::array<Eigen::MatrixXd, 4> ref_stiff_tria_, ref_stiff_quad_;
+  Eigen::MatrixXd ref_mass_tria_, ref_mass_quad_;
 
  public:
   /** @brief output control variable
@@ -336,48 +382,21 @@ LagrangeFEEllBVPElementMatrix<DIFF_COEFF, REACTION_COEFF>::
     SWITCHEDSTATEMENT(ctrl_, kout_qr,
                       std::cout << "LagrEM(Tria): " << qr_tria_ << std::endl);
 
-    // Obtain value of reference shape functions in all quadrature points
-    const std::vector<Eigen::Matrix<double, 1, Eigen::Dynamic>> rsf_val{
-        fe_tria_.EvalReferenceShapeFunctions(qr_tria_.Points())};
-    LF_ASSERT_MSG(Nrsf_tria_ == rsf_val.size(),
-                  "Mismatch in length of value vector " << Nrsf_tria_ << " <-> "
-                                                        << rsf_val.size());
-    // Store the values for reuse for all cells
-    rsf_quadpoints_tria_.resize(Nrsf_tria_, Nqp_tria_);
-
-    for (int i = 0; i < Nrsf_tria_; ++i) {
-      LF_ASSERT_MSG(
-          (rsf_val[i].cols() == Nqp_tria_),
-          "Length mismatch " << rsf_val[i].cols() << " <-> " << Nqp_tria_);
-      for (int j = 0; j < Nqp_tria_; ++j) {
-        rsf_quadpoints_tria_(i, j) = rsf_val[i][j];
-      }
-    }
+    // Values and gradients of reference shape functions in all quadrature
+    // points
+    tab_tria_ = fe_tria_.Tabulation(qr_tria_);
     SWITCHEDSTATEMENT(ctrl_, kout_rsfvals,
                       std::cout << "LagrEM(Tria): values of RSFs\n"
-                                << rsf_quadpoints_tria_ << std::endl);
-
-    // Store the gradients for the reference shape functions
-    std::vector<Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>> rsf_grad{
-        fe_tria_.GradientsReferenceShapeFunctions(qr_tria_.Points())};
-    LF_ASSERT_MSG(Nrsf_tria_ == rsf_grad.size(),
-                  "Mismatch in length of gradient vector"
-                      << Nrsf_tria_ << " <-> " << rsf_grad.size());
-
-    // Store the gradients internally in an array of stacked vectors
-    grad_quadpoint_tria_.resize(
-        Nqp_tria_, Eigen::Matrix<double, 2, Eigen::Dynamic>(2, Nrsf_tria_));
-    for (int i = 0; i < Nqp_tria_; ++i) {
-      for (int j = 0; j < Nrsf_tria_; ++j) {
-        grad_quadpoint_tria_[i].col(j) = rsf_grad[j].col(i);
-      }
-    }
+                                << tab_tria_->Values() << std::endl);
     SWITCHEDSTATEMENT(ctrl_, kout_gradvals,
                       std::cout << "LagrEM(Tria): gradients:" << std::endl;
                       for (int i = 0; i < Nqp_tria_; ++i) {
                         std::cout << "QP " << i << " = \n"
-                                  << grad_quadpoint_tria_[i] << std::endl;
+                                  << tab_tria_->Gradients(i) << std::endl;
                       });
+    if constexpr (kConstCoeffs) {
+      ReferenceMatrices(qr_tria_, *tab_tria_, ref_stiff_tria_, ref_mass_tria_);
+    }
   }
 
   {
@@ -390,60 +409,133 @@ LagrangeFEEllBVPElementMatrix<DIFF_COEFF, REACTION_COEFF>::
     SWITCHEDSTATEMENT(ctrl_, kout_qr,
                       std::cout << "LagrEM(Quad): " << qr_quad_ << std::endl);
 
-    // Obtain value of reference shape functions in all quadrature points
-    const std::vector<Eigen::Matrix<double, 1, Eigen::Dynamic>> rsf_val{
-        fe_quad_.EvalReferenceShapeFunctions(qr_quad_.Points())};
-    LF_ASSERT_MSG(Nrsf_quad_ == rsf_val.size(),
-                  "Mismatch in length of value vector " << Nrsf_quad_ << " <-> "
-                                                        << rsf_val.size());
-    // Store the values for reuse for all cells
-    rsf_quadpoints_quad_.resize(Nrsf_quad_, Nqp_quad_);
-
-    for (int i = 0; i < Nrsf_quad_; ++i) {
-      LF_ASSERT_MSG(
-          (rsf_val[i].cols() == Nqp_quad_),
-          "Length mismatch " << rsf_val[i].cols() << " <-> " << Nqp_quad_);
-      for (int j = 0; j < Nqp_quad_; ++j) {
-        rsf_quadpoints_quad_(i, j) = rsf_val[i][j];
-      }
-    }
+    // Values and gradients of reference shape functions in all quadrature
+    // points
+    tab_quad_ = fe_quad_.Tabulation(qr_quad_);
     SWITCHEDSTATEMENT(ctrl_, kout_rsfvals,
                       std::cout << "LagrEM(Quad): values of RSFs\n"
-                                << rsf_quadpoints_quad_ << std::endl);
-
-    // Store the gradients for the reference shape functions
-    std::vector<Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>> rsf_grad{
-        fe_quad_.GradientsReferenceShapeFunctions(qr_quad_.Points())};
-    LF_ASSERT_MSG(Nrsf_quad_ == rsf_grad.size(),
-                  "Mismatch in length of gradient vector"
-                      << Nrsf_quad_ << " <-> " << rsf_grad.size());
-
-    // Store the gradients internally in an array of stacked vectors
-    grad_quadpoint_quad_.resize(
-        Nqp_quad_, Eigen::Matrix<double, 2, Eigen::Dynamic>(2, Nrsf_quad_));
-    for (int i = 0; i < Nqp_quad_; ++i) {
-      for (int j = 0; j < Nrsf_quad_; ++j) {
-        grad_quadpoint_quad_[i].col(j) = rsf_grad[j].col(i);
-      }
-    }
+                                << tab_quad_->Values() << std::endl);
     SWITCHEDSTATEMENT(ctrl_, kout_gradvals,
                       std::cout << "LagrEM(Quad): gradients:" << std::endl;
                       for (int i = 0; i < Nqp_quad_; ++i) {
                         std::cout << "QP " << i << " = \n"
-                                  << grad_quadpoint_quad_[i] << std::endl;
+                                  << tab_quad_->Gradients(i) << std::endl;
                       });
+    if constexpr (kConstCoeffs) {
+      ReferenceMatrices(qr_quad_, *tab_quad_, ref_stiff_quad_, ref_mass_quad_);
+    }
   }
 }  // end constructor LagrangeFEEllBVPElementMatrix<DIFF_COEFF, REACTION_COEFF>
 
+template <typename DIFF_COEFF, typename REACTION_COEFF>
+void LagrangeFEEllBVPElementMatrix<DIFF_COEFF, REACTION_COEFF>::
+    ReferenceMatrices(const lf::quad::QuadRule &qr,
+                      const ShapeFunctionTabulation<double> &tab,
+                      std::array<Eigen::MatrixXd, 4> &ref_stiff,
+                      Eigen::MatrixXd &ref_mass) {
+  const size_type nrsf = tab.NumRefShapeFunctions();
+  for (auto &m : ref_stiff) {
+    m.setZero(nrsf, nrsf);
+  }
+  ref_mass.setZero(nrsf, nrsf);
+  for (int k = 0; k < qr.NumPoints(); ++k) {
+    const double w = qr.Weights()[k];
+    const auto grad(tab.Gradients(k));
+    for (int a = 0; a < 2; ++a) {
+      for (int b = 0; b < 2; ++b) {
+        ref_stiff[2 * a + b] += w * grad.row(a).transpose() * grad.row(b);
+      }
+    }
+    ref_mass += w * tab.Values().col(k) * tab.Values().col(k).transpose();
+  }
+}
+
+template <typename DIFF_COEFF, typename REACTION_COEFF>
+typename LagrangeFEEllBVPElementMatrix<DIFF_COEFF, REACTION_COEFF>::elem_mat_t
+LagrangeFEEllBVPElementMatrix<DIFF_COEFF, REACTION_COEFF>::EvalCell(
+    const lf::geometry::Geometry &geo, const lf::quad::QuadRule &qr,
+    const ShapeFunctionTabulation<double> &tab,
+    const std::array<Eigen::MatrixXd, 4> &ref_stiff,
+    const Eigen::MatrixXd &ref_mass) {
+  const size_type nrsf = tab.NumRefShapeFunctions();
+  // Element matrix
+  elem_mat_t mat(nrsf, nrsf);
+  mat.setZero();
+
+  if constexpr (kConstCoeffs) {
+    if (geo.isAffine()) {
+      // The Jacobian is constant: the element matrix is a linear combination
+      // of the element matrices of the reference cell
+      const Eigen::MatrixXd x0{qr.Points().col(0)};
+      const double det = geo.IntegrationElement(x0)[0];
+      if constexpr (!kZeroDiff) {
+        const Eigen::Matrix2d JinvT(geo.JacobianInverseGramian(x0));
+        const Eigen::Matrix2d alpha_mat(alpha_.Value() *
+                                        Eigen::Matrix2d::Identity());
+        const Eigen::Matrix2d C(det * JinvT.transpose() *
+                                alpha_mat.transpose() * JinvT);
+        for (int a = 0; a < 2; ++a) {
+          for (int b = 0; b < 2; ++b) {
+            mat += C(a, b) * ref_stiff[2 * a + b];
+          }
+        }
+      }
+      if constexpr (!kZeroReac) {
+        mat += (det * gamma_.Value()) * ref_mass;
+      }
+      return mat;
+    }
+  }
+
+  // Obtain the metric factors for the quadrature points
+  const Eigen::VectorXd determinants(geo.IntegrationElement(qr.Points()));
+  // Fetch the transformation matrices for the gradients
+  Eigen::MatrixXd JinvT;
+  if constexpr (!kZeroDiff) {
+    JinvT = geo.JacobianInverseGramian(qr.Points());
+  }
+  // Evaluate diffusion and reaction coefficient
+  // at quadrature points in actual cell
+  if constexpr (!kConstCoeffs) {
+    const Eigen::MatrixXd mapped_qpts(geo.Global(qr.Points()));
+    if constexpr (!IsConstantCoefficient<DIFF_COEFF>::value) {
+      EvalCoefficient(alpha_, mapped_qpts, alpha_vals_);
+    }
+    if constexpr (!IsConstantCoefficient<REACTION_COEFF>::value) {
+      EvalCoefficient(gamma_, mapped_qpts, gamma_vals_);
+    }
+  }
+
+  // Loop over quadrature points
+  for (int k = 0; k < qr.NumPoints(); ++k) {
+    const double w = qr.Weights()[k] * determinants[k];
+    if constexpr (!kZeroDiff) {
+      // Transformed gradients
+      const auto trf_grad(JinvT.block(0, 2 * k, 2, 2) * tab.Gradients(k));
+      // Transformed gradients multiplied with coefficient
+      if constexpr (IsConstantCoefficient<DIFF_COEFF>::value) {
+        mat += w * ((alpha_.Value() * trf_grad).transpose() * trf_grad);
+      } else {
+        mat += w * ((alpha_vals_[k] * trf_grad).transpose() * trf_grad);
+      }
+    }
+    if constexpr (!kZeroReac) {
+      if constexpr (IsConstantCoefficient<REACTION_COEFF>::value) {
+        mat += (w * gamma_.Value()) *
+               (tab.Values().col(k) * tab.Values().col(k).transpose());
+      } else {
+        mat += (w * gamma_vals_[k]) *
+               (tab.Values().col(k) * tab.Values().col(k).transpose());
+      }
+    }
+  }
+  return mat;
+}
+
 template <typename DIFF_COEFF, typename REACTION_COEFF>
 typename LagrangeFEEllBVPElementMatrix<DIFF_COEFF, REACTION_COEFF>::ElemMat
 LagrangeFEEllBVPElementMatrix<DIFF_COEFF, REACTION_COEFF>::Eval(
     const lf::mesh::Entity &cell) {
-  // Type for diffusion coefficient
-  using diff_coeff_t = decltype(alpha_(Eigen::Vector2d::Zero()));
-  // Type for reaction coefficient
-  using reac_coeff_t = decltype(gamma_(Eigen::Vector2d::Zero()));
-
   // Topological type of the cell
   const lf::base::RefEl ref_el{cell.RefEl()};
   // Query the shape of the cell
@@ -459,68 +551,12 @@ LagrangeFEEllBVPElementMatrix<DIFF_COEFF, REACTION_COEFF>::Eval(
   // Computations differ depending on the type of the cell
   switch (ref_el) {
     case lf::base::RefEl::kTria(): {
-      // Quadrature points in actual cell
-      const Eigen::MatrixXd mapped_qpts(geo_ptr->Global(qr_tria_.Points()));
-      // Obtain the metric factors for the quadrature points
-      const Eigen::VectorXd determinants(geo_ptr->IntegrationElement(qr_tria_.Points()));
-      // Fetch the transformation matrices for the gradients
-      const Eigen::MatrixXd JinvT(geo_ptr->JacobianInverseGramian(qr_tria_.Points()));
-      
-      // Element matrix
-      elem_mat_t mat(Nrsf_tria_, Nrsf_tria_);
-      mat.setZero();
-
-      // Loop over quadrature points
-      for (int k = 0; k < Nqp_tria_; ++k) {
-	// Evaluate diffusion and reaction coefficient
-	// at quadrature points in actual cell
-	const auto alphaval = alpha_(mapped_qpts.col(k));
-	const auto gammaval = gamma_(mapped_qpts.col(k));
-	
-        const double w = qr_tria_.Weights()[k] * determinants[k];
-        // Transformed gradients
-        const auto trf_grad(JinvT.block(0, 2 * k, 2, 2) *
-                            grad_quadpoint_tria_[k]);
-        // Transformed gradients multiplied with coefficient
-        const auto alpha_trf_grad(alphaval * trf_grad);
-        mat += w * (alpha_trf_grad.transpose() * trf_grad +
-                    (gammaval * rsf_quadpoints_tria_.col(k)) *
-                        (rsf_quadpoints_tria_.col(k).transpose()));
-      }
-      return mat;
-      break;
+      return EvalCell(*geo_ptr, qr_tria_, *tab_tria_, ref_stiff_tria_,
+                      ref_mass_tria_);
     }
     case lf::base::RefEl::kQuad(): {
-      // Quadrature points in actual cell
-      const Eigen::MatrixXd mapped_qpts(geo_ptr->Global(qr_quad_.Points()));
-      // Obtain the metric factors for the quadrature points
-      const Eigen::VectorXd determinants(geo_ptr->IntegrationElement(qr_quad_.Points()));
-      // Fetch the transformation matrices for the gradients
-      const Eigen::MatrixXd JinvT(geo_ptr->JacobianInverseGramian(qr_quad_.Points()));
-
-      // Element matrix
-      elem_mat_t mat(Nrsf_quad_, Nrsf_quad_);
-      mat.setZero();
-
-      // Loop over quadrature points
-      for (int k = 0; k < Nqp_quad_; ++k) {
- 	// Evaluate diffusion and reaction coefficient
-	// at quadrature points in actual cell
-	const auto alphaval{alpha_(mapped_qpts.col(k))};
-	const auto gammaval{gamma_(mapped_qpts.col(k))};
-
-	const double w = qr_quad_.Weights()[k] * determinants[k];
-        // Transformed gradients
-        const auto trf_grad(JinvT.block(0, 2 * k, 2, 2) *
-                            grad_quadpoint_quad_[k]);
-        // Transformed gradients multiplied with coefficient
-        const auto alpha_trf_grad(alphaval * trf_grad);
-        mat += w * (alpha_trf_grad.transpose() * trf_grad +
-                    (gammaval * rsf_quadpoints_quad_.col(k)) *
-                        (rsf_quadpoints_quad_.col(k).transpose()));
-      }
-      return mat;
-      break;
+      return EvalCell(*geo_ptr, qr_quad_, *tab_quad_, ref_stiff_quad_,
+                      ref_mass_quad_);
     }
     default: { LF_ASSERT_MSG(false, "Illegal cell type"); }
   }  // end switch
@@ -584,12 +620,16 @@ class ScalarFELocalLoadVector {
    */
   lf::quad::QuadRule qr_tria_, qr_quad_;
   /**
-   * @brief Matrix of values of all reference shape functions at all quadrature
-   * points
+   * @brief Values of all reference shape functions at all quadrature points
    *
-   * The rows correspond to the RSFs, the columns to the quadrature points
+   * See ShapeFunctionTabulation for the layout.
+   */
+  std::shared_ptr<const ShapeFunctionTabulation<double>> tab_tria_, tab_quad_;
+  /**
+   * @brief values of the source function at the quadrature points of the
+   * current cell, see EvalCoefficient()
    */
-  Eigen::MatrixXd rsf_quadpoints_tria_, rsf_quadpoints_quad_;
+  std::vector<coeff_value_t<FUNCTOR>> fvals_;
 
  public:
   /*
@@ -646,25 +686,10 @@ ScalarFELocalLoadVector<SCALAR, FUNCTOR>::ScalarFELocalLoadVector(
                       std::cout << "LagrEM(Tria): " << qr_tria_ << std::endl);
 
     // Obtain value of reference shape functions in all quadrature points
-    const std::vector<Eigen::Matrix<double, 1, Eigen::Dynamic>> rsf_val{
-        fe_tria_.EvalReferenceShapeFunctions(qr_tria_.Points())};
-    LF_ASSERT_MSG(Nrsf_tria_ == rsf_val.size(),
-                  "Mismatch in length of value vector " << Nrsf_tria_ << " <-> "
-                                                        << rsf_val.size());
-    // Store the values for reuse for all cells
-    rsf_quadpoints_tria_.resize(Nrsf_tria_, Nqp_tria_);
-
-    for (int i = 0; i < Nrsf_tria_; ++i) {
-      LF_ASSERT_MSG(
-          (rsf_val[i].cols() == Nqp_tria_),
-          "Length mismatch " << rsf_val[i].cols() << " <-> " << Nqp_tria_);
-      for (int j = 0; j < Nqp_tria_; ++j) {
-        rsf_quadpoints_tria_(i, j) = rsf_val[i][j];
-      }
-    }
+    tab_tria_ = fe_tria_.Tabulation(qr_tria_);
     SWITCHEDSTATEMENT(ctrl_, kout_rsfvals,
                       std::cout << "LagrEM(Tria): values of RSFs\n"
-                                << rsf_quadpoints_tria_ << std::endl);
+                                << tab_tria_->Values() << std::endl);
   }  // end preprocessing for triangles
 
   {
@@ -678,33 +703,16 @@ ScalarFELocalLoadVector<SCALAR, FUNCTOR>::ScalarFELocalLoadVector(
                       std::cout << "LagrEM(Quad): " << qr_quad_ << std::endl);
 
     // Obtain value of reference shape functions in all quadrature points
-    const std::vector<Eigen::Matrix<double, 1, Eigen::Dynamic>> rsf_val{
-        fe_quad_.EvalReferenceShapeFunctions(qr_quad_.Points())};
-    LF_ASSERT_MSG(Nrsf_quad_ == rsf_val.size(),
-                  "Mismatch in length of value vector " << Nrsf_quad_ << " <-> "
-                                                        << rsf_val.size());
-    // Store the values for reuse for all cells
-    rsf_quadpoints_quad_.resize(Nrsf_quad_, Nqp_quad_);
-
-    for (int i = 0; i < Nrsf_quad_; ++i) {
-      LF_ASSERT_MSG(
-          (rsf_val[i].cols() == Nqp_quad_),
-          "Length mismatch " << rsf_val[i].cols() << " <-> " << Nqp_quad_);
-      for (int j = 0; j < Nqp_quad_; ++j) {
-        rsf_quadpoints_quad_(i, j) = rsf_val[i][j];
-      }
-    }
+    tab_quad_ = fe_quad_.Tabulation(qr_quad_);
     SWITCHEDSTATEMENT(ctrl_, kout_rsfvals,
                       std::cout << "LagrEM(Quad): values of RSFs\n"
-                                << rsf_quadpoints_quad_ << std::endl);
+                                << tab_quad_->Values() << std::endl);
   }  // end preprocessing for quadrilaterals
 }
 
 template <typename SCALAR, typename FUNCTOR>
 typename ScalarFELocalLoadVector<SCALAR, FUNCTOR>::ElemVec
 ScalarFELocalLoadVector<SCALAR, FUNCTOR>::Eval(const lf::mesh::Entity &cell) {
-  // Type for source function
-  using source_fn_t = decltype(f_(Eigen::Vector2d::Zero()));
   // Topological type of the cell
   const lf::base::RefEl ref_el{cell.RefEl()};
   // Query the shape of the cell
@@ -730,14 +738,15 @@ ScalarFELocalLoadVector<SCALAR, FUNCTOR>::Eval(const lf::mesh::Entity &cell) {
       SWITCHEDSTATEMENT(ctrl_, kout_dets,
                         std::cout << "LOCVEC(Tria): Metric factors:\n"
                                   << determinants.transpose() << std::endl);
+      // Source function values at quadrature points
+      EvalCoefficient(f_, mapped_qpts, fvals_);
       // Element vector
       elem_vec_t vec(Nrsf_tria_);
       vec.setZero();
 
       // Loop over quadrature points
       for (int k = 0; k < Nqp_tria_; ++k) {
-        // Source function value at quadrature point
-        const auto fval = f_(mapped_qpts.col(k));
+        const auto &fval = fvals_[k];
         SWITCHEDSTATEMENT(
             ctrl_, kout_loop,
             std::cout << "LOCVEC(Tria): ["
@@ -746,7 +755,7 @@ ScalarFELocalLoadVector<SCALAR, FUNCTOR>::Eval(const lf::mesh::Entity &cell) {
                       << ", weight = " << qr_tria_.Weights()[k] << std::endl);
         // Contribution of current quadrature point
         vec +=
-            (qr_tria_.Weights()[k] * determinants[k] * fval) * rsf_quadpoints_tria_.col(k);
+            (qr_tria_.Weights()[k] * determinants[k] * fval) * tab_tria_->Values().col(k);
       }
       SWITCHEDSTATEMENT(ctrl_, kout_locvec,
                         std::cout << "LOCVEC(Tria) = \n"
@@ -765,14 +774,15 @@ ScalarFELocalLoadVector<SCALAR, FUNCTOR>::Eval(const lf::mesh::Entity &cell) {
       SWITCHEDSTATEMENT(ctrl_, kout_dets,
                         std::cout << "LOCVEC(Quad): Metric factors:\n"
                                   << determinants.transpose() << std::endl);
+      // Source function values at quadrature points
+      EvalCoefficient(f_, mapped_qpts, fvals_);
       // Element vector
       elem_vec_t vec(Nrsf_quad_);
       vec.setZero();
 
       // Loop over quadrature points
       for (int k = 0; k < Nqp_quad_; ++k) {
-        // Source function value at quadrature point
-        const auto fval = f_(mapped_qpts.col(k));
+        const auto &fval = fvals_[k];
         SWITCHEDSTATEMENT(
             ctrl_, kout_loop,
             std::cout << "LOCVEC(Quad): ["
@@ -781,7 +791,7 @@ ScalarFELocalLoadVector<SCALAR, FUNCTOR>::Eval(const lf::mesh::Entity &cell) {
                       << ", weight = " << qr_quad_.Weights()[k] << std::endl);
         // Contribution of current quadrature point
         vec +=
-            (qr_quad_.Weights()[k] * determinants[k] * fval) * rsf_quadpoints_quad_.col(k);
+            (qr_quad_.Weights()[k] * determinants[k] * fval) * tab_quad_->Values().col(k);
       }
       SWITCHEDSTATEMENT(ctrl_, kout_locvec,
                         std::cout << "LOCVEC(Quad) = \n"
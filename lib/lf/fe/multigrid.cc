@@ -0,0 +1,204 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Implementation of the geometric multigrid V-cycle
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#include "multigrid.h"
+#include <algorithm>
+#include <numeric>
+
+namespace lf::fe {
+
+namespace {
+// Residual b - A*x, rows processed in parallel
+Eigen::VectorXd Residual(const LinearFEMultigrid::SparseMatrix &A,
+                         const Eigen::VectorXd &b, const Eigen::VectorXd &x) {
+  Eigen::VectorXd r(b.size());
+  lf::base::ParallelFor(A.rows(), [&](std::size_t first, std::size_t last) {
+    for (std::size_t i = first; i < last; ++i) {
+      double s = b[i];
+      for (LinearFEMultigrid::SparseMatrix::InnerIterator it(A, i); it; ++it) {
+        s -= it.value() * x[it.col()];
+      }
+      r[i] = s;
+    }
+  });
+  return r;
+}
+}  // namespace
+
+LinearFEMultigrid::LinearFEMultigrid(const lf::refinement::MeshHierarchy &mh,
+                                     const Eigen::SparseMatrix<double> &A_fine,
+                                     Options options)
+    : options_(options), matrices_(mh.NumLevels()) {
+  matrices_.back() = A_fine;
+  Init(mh);
+}
+
+LinearFEMultigrid::LinearFEMultigrid(
+    const lf::refinement::MeshHierarchy &mh,
+    const std::vector<Eigen::SparseMatrix<double>> &level_matrices,
+    Options options)
+    : options_(options) {
+  LF_VERIFY_MSG(level_matrices.size() == mh.NumLevels(),
+                level_matrices.size() << " matrices for " << mh.NumLevels()
+                                      << " levels");
+  for (const Eigen::SparseMatrix<double> &A : level_matrices) {
+    matrices_.emplace_back(A);
+  }
+  Init(mh);
+}
+
+void LinearFEMultigrid::Init(const lf::refinement::MeshHierarchy &mh) {
+  const size_type num_levels = mh.NumLevels();
+  const lf::assemble::UniformFEDofHandler::dof_map_t dofmap{
+      {lf::base::RefEl::kPoint(), 1}};
+  std::vector<std::unique_ptr<lf::assemble::UniformFEDofHandler>> dofh;
+  for (size_type level = 0; level < num_levels; ++level) {
+    dofh.push_back(std::make_unique<lf::assemble::UniformFEDofHandler>(
+        mh.getMesh(level), dofmap));
+  }
+  for (size_type level = 0; level + 1 < num_levels; ++level) {
+    transfers_.push_back(std::make_unique<LinearFELevelTransfer>(
+        mh, level, *dofh[level], *dofh[level + 1]));
+  }
+  // Galerkin products for levels without matrix, from fine to coarse
+  for (size_type level = num_levels - 1; level-- > 0;) {
+    if (matrices_[level].size() == 0) {
+      const Eigen::SparseMatrix<double> P =
+          transfers_[level]->ProlongationMatrix();
+      const Eigen::SparseMatrix<double> AP = matrices_[level + 1] * P;
+      matrices_[level] = P.transpose() * AP;
+    }
+  }
+  for (size_type level = 0; level < num_levels; ++level) {
+    const SparseMatrix &A{matrices_[level]};
+    LF_VERIFY_MSG((A.rows() == dofh[level]->NoDofs()) &&
+                      (A.cols() == dofh[level]->NoDofs()),
+                  "Matrix of size " << A.rows() << " x " << A.cols()
+                                    << " on level " << level << " with "
+                                    << dofh[level]->NoDofs() << " dofs");
+    inv_diag_.emplace_back(A.diagonal().cwiseInverse());
+    // Greedy coloring of the matrix graph, rows sorted by color
+    const auto n = static_cast<size_type>(A.rows());
+    std::vector<size_type> color(n, 0);
+    std::vector<size_type> used;
+    size_type num_colors = 0;
+    for (size_type i = 0; i < n; ++i) {
+      used.assign(num_colors + 1, n);
+      for (SparseMatrix::InnerIterator it(A, i); it; ++it) {
+        if (static_cast<size_type>(it.col()) < i) {
+          used[color[it.col()]] = i;
+        }
+      }
+      color[i] = std::find_if(used.begin(), used.end(),
+                              [i](size_type u) { return u != i; }) -
+                 used.begin();
+      num_colors = std::max(num_colors, color[i] + 1);
+    }
+    std::vector<size_type> offsets(num_colors + 1, 0);
+    for (size_type i = 0; i < n; ++i) {
+      ++offsets[color[i] + 1];
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    std::vector<size_type> rows(n);
+    std::vector<size_type> fill(offsets.begin(), offsets.end() - 1);
+    for (size_type i = 0; i < n; ++i) {
+      rows[fill[color[i]]++] = i;
+    }
+    color_offsets_.push_back(std::move(offsets));
+    color_rows_.push_back(std::move(rows));
+  }
+  coarse_solver_ =
+      std::make_unique<Eigen::SparseLU<Eigen::SparseMatrix<double>>>();
+  coarse_solver_->compute(Eigen::SparseMatrix<double>(matrices_[0]));
+  LF_VERIFY_MSG(coarse_solver_->info() == Eigen::Success,
+                "LU decomposition of coarse level matrix failed");
+}
+
+void LinearFEMultigrid::Smooth(size_type level, const Eigen::VectorXd &b,
+                               Eigen::VectorXd &x, unsigned int steps,
+                               bool forward) const {
+  const SparseMatrix &A{matrices_[level]};
+  const Eigen::VectorXd &inv_diag{inv_diag_[level]};
+  for (unsigned int step = 0; step < steps; ++step) {
+    if (options_.smoother == Smoother::kJacobi) {
+      x += options_.jacobi_damping *
+           inv_diag.cwiseProduct(Residual(A, b, x));
+      continue;
+    }
+    // Multi-color Gauss-Seidel: colors in sequence, rows of the same color,
+    // which are not coupled, in parallel
+    const std::vector<size_type> &offsets{color_offsets_[level]};
+    const std::vector<size_type> &rows{color_rows_[level]};
+    const size_type num_colors = offsets.size() - 1;
+    for (size_type k = 0; k < num_colors; ++k) {
+      const size_type color = forward ? k : num_colors - 1 - k;
+      const size_type first = offsets[color];
+      lf::base::ParallelFor(
+          offsets[color + 1] - first,
+          [&](std::size_t begin, std::size_t end) {
+            for (std::size_t l = first + begin; l < first + end; ++l) {
+              const size_type i = rows[l];
+              double s = b[i];
+              for (SparseMatrix::InnerIterator it(A, i); it; ++it) {
+                if (it.col() != static_cast<SparseMatrix::StorageIndex>(i)) {
+                  s -= it.value() * x[it.col()];
+                }
+              }
+              x[i] = s * inv_diag[i];
+            }
+          });
+    }
+  }
+}
+
+void LinearFEMultigrid::VCycle(size_type level, const Eigen::VectorXd &b,
+                               Eigen::VectorXd &x) const {
+  if (level == 0) {
+    x = coarse_solver_->solve(b);
+    return;
+  }
+  Smooth(level, b, x, options_.pre_smoothing, true);
+  const Eigen::VectorXd r_coarse =
+      transfers_[level - 1]->Restrict(Residual(matrices_[level], b, x));
+  Eigen::VectorXd e_coarse = Eigen::VectorXd::Zero(r_coarse.size());
+  VCycle(level - 1, r_coarse, e_coarse);
+  x += transfers_[level - 1]->Prolongate(e_coarse);
+  Smooth(level, b, x, options_.post_smoothing, false);
+}
+
+Eigen::VectorXd LinearFEMultigrid::Apply(const Eigen::VectorXd &r) const {
+  LF_ASSERT_MSG(r.size() == matrices_.back().rows(),
+                "Vector length mismatch");
+  Eigen::VectorXd x = Eigen::VectorXd::Zero(r.size());
+  VCycle(NumLevels() - 1, r, x);
+  return x;
+}
+
+unsigned int LinearFEMultigrid::Solve(const Eigen::VectorXd &b,
+                                      Eigen::VectorXd &x, double rtol,
+                                      unsigned int maxit) const {
+  LF_ASSERT_MSG(b.size() == matrices_.back().rows(),
+                "Vector length mismatch");
+  const double b_norm = b.norm();
+  unsigned int it = 0;
+  for (; it < maxit; ++it) {
+    if (Residual(matrices_.back(), b, x).norm() <= rtol * b_norm) {
+      break;
+    }
+    VCycle(NumLevels() - 1, b, x);
+  }
+  return it;
+}
+
+}  // namespace lf::fe
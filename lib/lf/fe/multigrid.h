@@ -0,0 +1,183 @@
+#ifndef LF_FE_MULTIGRID
+#define LF_FE_MULTIGRID
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Geometric multigrid for linear Lagrangian finite elements on the
+ * meshes of a mesh hierarchy
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#include <lf/assemble/assemble.h>
+#include <Eigen/SparseLU>
+#include <memory>
+#include "prolongation.h"
+
+namespace lf::fe {
+
+/** @brief Smoothers available for LinearFEMultigrid */
+enum class MultigridSmoother { kJacobi, kGaussSeidel };
+
+/** @brief Parameters of the V-cycle of LinearFEMultigrid */
+struct MultigridOptions {
+  MultigridSmoother smoother{MultigridSmoother::kGaussSeidel};
+  /** number of smoothing steps before coarse grid correction */
+  unsigned int pre_smoothing{2};
+  /** number of smoothing steps after coarse grid correction */
+  unsigned int post_smoothing{2};
+  /** damping parameter for the Jacobi smoother */
+  double jacobi_damping{2.0 / 3.0};
+};
+
+/**
+ * @brief Geometric multigrid V-cycle for linear Lagrangian finite element
+ * discretizations on all levels of a lf::refinement::MeshHierarchy
+ *
+ * The dofs on every level are numbered as by a
+ * lf::assemble::UniformFEDofHandler with one dof per node, built for the mesh
+ * of that level. Inter-level transfer is carried out by LinearFELevelTransfer
+ * objects. The level matrices are either supplied by the user, see
+ * AssembleLevelMatrices(), or computed by Galerkin products
+ * \f$ A_{l} = P_{l}^T A_{l+1} P_l \f$ from the finest level matrix.
+ *
+ * On all but the coarsest level the V-cycle performs damped Jacobi or
+ * Gauss-Seidel smoothing; on the coarsest level the linear system is solved
+ * by a sparse LU decomposition. The Gauss-Seidel smoother is parallelized
+ * by a greedy coloring of the matrix graph computed in the constructor: the
+ * colors are processed one after the other, the unknowns of one color, which
+ * are not coupled, in parallel. The result does not depend on the number of
+ * threads. Pre-smoothing runs forward through the colors, post-smoothing
+ * backward, so that the V-cycle is a symmetric operator for symmetric level
+ * matrices and can serve as a preconditioner for the conjugate gradient
+ * method.
+ *
+ * The cost of a V-cycle is proportional to the number of fine dofs, when the
+ * number of dofs grows geometrically from level to level.
+ */
+class LinearFEMultigrid {
+ public:
+  using SparseMatrix = Eigen::SparseMatrix<double, Eigen::RowMajor>;
+
+  using Smoother = MultigridSmoother;
+  using Options = MultigridOptions;
+
+  /**
+   * @brief Set up the multigrid cycle from the matrix on the finest level
+   *
+   * @param mh mesh hierarchy
+   * @param A_fine s.p.d. Galerkin matrix on the finest level of `mh`
+   * @param options parameters of the V-cycle
+   *
+   * The matrices of the coarser levels are computed by Galerkin products.
+   */
+  LinearFEMultigrid(const lf::refinement::MeshHierarchy &mh,
+                    const Eigen::SparseMatrix<double> &A_fine,
+                    Options options = Options());
+
+  /**
+   * @brief Set up the multigrid cycle from matrices assembled on all levels
+   *
+   * @param mh mesh hierarchy
+   * @param level_matrices Galerkin matrices, the `l`-th one belonging to level
+   * `l` of `mh`.
+   * @param options parameters of the V-cycle
+   */
+  LinearFEMultigrid(const lf::refinement::MeshHierarchy &mh,
+                    const std::vector<Eigen::SparseMatrix<double>>
+                        &level_matrices,
+                    Options options = Options());
+
+  /**
+   * @brief Assembly of Galerkin matrices for linear Lagrangian finite
+   * elements on all levels of a mesh hierarchy
+   *
+   * @tparam ELEM_MAT_COMP type of the element matrix builder, see
+   * lf::assemble::AssembleMatrixLocally()
+   * @param mh mesh hierarchy
+   * @param elmat_builder object providing the element matrices, which is
+   * used for the meshes of all levels
+   * @return vector of level matrices, suitable for the constructor
+   */
+  template <class ELEM_MAT_COMP>
+  static std::vector<Eigen::SparseMatrix<double>> AssembleLevelMatrices(
+      const lf::refinement::MeshHierarchy &mh, ELEM_MAT_COMP &elmat_builder);
+
+  /** @brief number of levels */
+  size_type NumLevels() const { return matrices_.size(); }
+
+  /** @brief the system matrix on a level */
+  const SparseMatrix &LevelMatrix(size_type level) const {
+    return matrices_.at(level);
+  }
+
+  /**
+   * @brief Approximate solution of the finest level system by one V-cycle
+   * with zero initial guess, usable as a preconditioner
+   *
+   * @param r right hand side vector (residual) on the finest level
+   * @return approximate solution
+   */
+  Eigen::VectorXd Apply(const Eigen::VectorXd &r) const;
+
+  /**
+   * @brief Solve the finest level system by V-cycle iterations
+   *
+   * @param b right hand side on the finest level
+   * @param x initial guess, overwritten with the approximate solution
+   * @param rtol relative tolerance for the Euclidean norm of the residual
+   * @param maxit maximal number of V-cycles
+   * @return number of V-cycles performed
+   */
+  unsigned int Solve(const Eigen::VectorXd &b, Eigen::VectorXd &x,
+                     double rtol = 1.0E-10, unsigned int maxit = 100) const;
+
+ private:
+  /** @brief set up transfer operators and coarse grid solver */
+  void Init(const lf::refinement::MeshHierarchy &mh);
+  /** @brief one V-cycle on a level updating x */
+  void VCycle(size_type level, const Eigen::VectorXd &b,
+              Eigen::VectorXd &x) const;
+  /** @brief smoothing steps on a level */
+  void Smooth(size_type level, const Eigen::VectorXd &b, Eigen::VectorXd &x,
+              unsigned int steps, bool forward) const;
+
+  Options options_;
+  /** matrices, index 0 = coarsest level */
+  std::vector<SparseMatrix> matrices_;
+  /** inverse diagonals of the level matrices */
+  std::vector<Eigen::VectorXd> inv_diag_;
+  /** rows of the level matrices grouped by colors, compressed format */
+  std::vector<std::vector<size_type>> color_offsets_, color_rows_;
+  /** transfer between level l and l+1 */
+  std::vector<std::unique_ptr<LinearFELevelTransfer>> transfers_;
+  /** sparse LU decomposition of the coarsest level matrix */
+  std::unique_ptr<Eigen::SparseLU<Eigen::SparseMatrix<double>>> coarse_solver_;
+};
+
+template <class ELEM_MAT_COMP>
+std::vector<Eigen::SparseMatrix<double>>
+LinearFEMultigrid::AssembleLevelMatrices(
+    const lf::refinement::MeshHierarchy &mh, ELEM_MAT_COMP &elmat_builder) {
+  const lf::assemble::UniformFEDofHandler::dof_map_t dofmap{
+      {lf::base::RefEl::kPoint(), 1}};
+  std::vector<Eigen::SparseMatrix<double>> level_matrices;
+  for (size_type level = 0; level < mh.NumLevels(); ++level) {
+    const lf::assemble::UniformFEDofHandler dofh(mh.getMesh(level), dofmap);
+    const size_type N = dofh.NoDofs();
+    lf::assemble::COOMatrix<double> A(N, N);
+    lf::assemble::AssembleMatrixLocally(0, dofh, dofh, elmat_builder, A);
+    level_matrices.push_back(A.makeSparse());
+  }
+  return level_matrices;
+}
+
+}  // namespace lf::fe
+
+#endif
@@ -0,0 +1,155 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Implementation of the transfer of linear finite element functions
+ * between consecutive levels of a mesh hierarchy
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#include "prolongation.h"
+
+namespace lf::fe {
+
+namespace {
+// Check that a dof handler describes linear Lagrangian finite elements
+void CheckLinearFEDofHandler(const lf::assemble::DofHandler &dofh) {
+  const lf::mesh::Mesh &mesh{*dofh.Mesh()};
+  for (dim_t codim = 0; codim <= mesh.DimMesh(); ++codim) {
+    const size_type n_int = (codim == mesh.DimMesh()) ? 1 : 0;
+    for (const lf::mesh::Entity &e : mesh.Entities(codim)) {
+      LF_VERIFY_MSG(dofh.NoInteriorDofs(e) == n_int,
+                    "Not a dof handler for linear Lagrangian FE: "
+                        << dofh.NoInteriorDofs(e) << " dofs on "
+                        << e.RefEl().ToString());
+    }
+  }
+}
+}  // namespace
+
+LinearFELevelTransfer::LinearFELevelTransfer(
+    const lf::refinement::MeshHierarchy &mh, size_type coarse_level,
+    const lf::assemble::DofHandler &coarse_dofh,
+    const lf::assemble::DofHandler &fine_dofh)
+    : no_coarse_dofs_(coarse_dofh.NoDofs()) {
+  LF_VERIFY_MSG(coarse_level + 1 < mh.NumLevels(),
+                "No level below level " << coarse_level);
+  LF_VERIFY_MSG(coarse_dofh.Mesh() == mh.getMesh(coarse_level),
+                "Coarse dof handler not defined on level " << coarse_level);
+  LF_VERIFY_MSG(fine_dofh.Mesh() == mh.getMesh(coarse_level + 1),
+                "Fine dof handler not defined on level " << coarse_level + 1);
+  CheckLinearFEDofHandler(coarse_dofh);
+  CheckLinearFEDofHandler(fine_dofh);
+
+  const lf::mesh::Mesh &fine_mesh{*fine_dofh.Mesh()};
+  const dim_t node_codim = fine_mesh.DimMesh();
+  const std::vector<lf::refinement::ParentInfo> &parent_infos{
+      mh.ParentInfos(coarse_level + 1, node_codim)};
+  const SegmentLinearLagrangeFE<double> segment_fe{};
+  const TriaLinearLagrangeFE<double> tria_fe{};
+  const QuadLinearLagrangeFE<double> quad_fe{};
+
+  // Collect weights for the fine nodes ordered by fine dof index
+  const size_type no_fine_dofs = fine_dofh.NoDofs();
+  std::vector<std::vector<std::pair<gdof_idx_t, double>>> rows(no_fine_dofs);
+  for (const lf::mesh::Entity &node : fine_mesh.Entities(node_codim)) {
+    const gdof_idx_t fine_dof = fine_dofh.InteriorGlobalDofIndices(node)[0];
+    const lf::refinement::ParentInfo &pi{parent_infos[fine_mesh.Index(node)]};
+    const lf::mesh::Entity *parent = pi.parent_ptr;
+    LF_VERIFY_MSG(parent != nullptr, "Fine node without parent");
+    auto parent_dofs = coarse_dofh.GlobalDofIndices(*parent);
+    if (parent->RefEl() == lf::base::RefEl::kPoint()) {
+      rows[fine_dof].emplace_back(parent_dofs[0], 1.0);
+      continue;
+    }
+    // Fine node in the interior of a coarse edge or cell
+    const Eigen::MatrixXd x = node.Geometry()->Global(Eigen::MatrixXd(0, 1));
+    const Eigen::MatrixXd xi = parent->Geometry()->Local(x);
+    std::vector<Eigen::Matrix<double, 1, Eigen::Dynamic>> shape_vals;
+    switch (parent->RefEl()) {
+      case lf::base::RefEl::kSegment(): {
+        shape_vals = segment_fe.EvalReferenceShapeFunctions(xi);
+        break;
+      }
+      case lf::base::RefEl::kTria(): {
+        shape_vals = tria_fe.EvalReferenceShapeFunctions(xi);
+        break;
+      }
+      case lf::base::RefEl::kQuad(): {
+        shape_vals = quad_fe.EvalReferenceShapeFunctions(xi);
+        break;
+      }
+      default: {
+        LF_VERIFY_MSG(false, "Illegal parent " << parent->RefEl().ToString());
+      }
+    }
+    for (std::size_t k = 0; k < shape_vals.size(); ++k) {
+      // Skip coarse basis functions vanishing at the fine node
+      if (std::abs(shape_vals[k][0]) > 1.0E-12) {
+        rows[fine_dof].emplace_back(parent_dofs[k], shape_vals[k][0]);
+      }
+    }
+  }
+
+  // Compress
+  offsets_.assign(1, 0);
+  for (const auto &row : rows) {
+    for (const auto &[dof, weight] : row) {
+      coarse_dofs_.push_back(dof);
+      weights_.push_back(weight);
+    }
+    offsets_.push_back(coarse_dofs_.size());
+  }
+}
+
+Eigen::VectorXd LinearFELevelTransfer::Prolongate(
+    const Eigen::VectorXd &u_coarse) const {
+  LF_ASSERT_MSG(u_coarse.size() == no_coarse_dofs_,
+                "Wrong length of coarse vector " << u_coarse.size());
+  const size_type n = NoFineDofs();
+  Eigen::VectorXd u_fine(n);
+  for (size_type i = 0; i < n; ++i) {
+    double s = 0.0;
+    for (size_type k = offsets_[i]; k < offsets_[i + 1]; ++k) {
+      s += weights_[k] * u_coarse[coarse_dofs_[k]];
+    }
+    u_fine[i] = s;
+  }
+  return u_fine;
+}
+
+Eigen::VectorXd LinearFELevelTransfer::Restrict(
+    const Eigen::VectorXd &r_fine) const {
+  const size_type n = NoFineDofs();
+  LF_ASSERT_MSG(r_fine.size() == n,
+                "Wrong length of fine vector " << r_fine.size());
+  Eigen::VectorXd r_coarse = Eigen::VectorXd::Zero(no_coarse_dofs_);
+  for (size_type i = 0; i < n; ++i) {
+    for (size_type k = offsets_[i]; k < offsets_[i + 1]; ++k) {
+      r_coarse[coarse_dofs_[k]] += weights_[k] * r_fine[i];
+    }
+  }
+  return r_coarse;
+}
+
+Eigen::SparseMatrix<double> LinearFELevelTransfer::ProlongationMatrix() const {
+  std::vector<Eigen::Triplet<double>> triplets;
+  triplets.reserve(weights_.size());
+  const size_type n = NoFineDofs();
+  for (size_type i = 0; i < n; ++i) {
+    for (size_type k = offsets_[i]; k < offsets_[i + 1]; ++k) {
+      triplets.emplace_back(i, coarse_dofs_[k], weights_[k]);
+    }
+  }
+  Eigen::SparseMatrix<double> P(n, no_coarse_dofs_);
+  P.setFromTriplets(triplets.begin(), triplets.end());
+  return P;
+}
+
+}  // namespace lf::fe
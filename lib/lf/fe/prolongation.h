@@ -0,0 +1,108 @@
+#ifndef LF_FE_PROLONGATION
+#define LF_FE_PROLONGATION
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Transfer of linear finite element functions between consecutive
+ * levels of a mesh hierarchy
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#include <lf/refinement/refinement.h>
+#include <Eigen/Sparse>
+#include "lagr_fe.h"
+
+namespace lf::fe {
+
+/**
+ * @brief Prolongation and restriction for piecewise linear Lagrangian
+ * finite elements on two consecutive meshes of a
+ * lf::refinement::MeshHierarchy
+ *
+ * Since the meshes are nested, every coarse linear finite element function is
+ * also a finite element function on the fine mesh. The _prolongation_ maps
+ * the basis expansion coefficient vector of a coarse finite element function
+ * to that of the same function on the fine mesh. The _restriction_ is its
+ * transpose, which maps fine-mesh residuals (load vectors) to the coarse
+ * mesh.
+ *
+ * Every node of the fine mesh is a child of a node, an edge or a cell of the
+ * coarse mesh, see lf::refinement::ParentInfo. The value of a coarse
+ * function at a fine node is obtained by evaluating the reference shape
+ * functions of the parent entity in the local coordinates of the fine node
+ * w.r.t. that entity. These weights are computed once in the constructor and
+ * stored in compressed row format, so that both transfer operators can be
+ * applied in \f$ O(N) \f$ operations without assembling a sparse matrix.
+ *
+ * The finite element spaces are described by dof handlers, e.g. of type
+ * lf::assemble::UniformFEDofHandler, with exactly one dof per node and no
+ * other dofs.
+ */
+class LinearFELevelTransfer {
+ public:
+  /**
+   * @brief Set up the transfer operators between a level and the next finer
+   * level of a mesh hierarchy
+   *
+   * @param mh the mesh hierarchy
+   * @param coarse_level level of the coarse mesh, must be smaller than
+   * `mh.NumLevels()-1`
+   * @param coarse_dofh dof handler for linear Lagrangian finite elements on
+   * the mesh of level `coarse_level`
+   * @param fine_dofh dof handler for linear Lagrangian finite elements on
+   * the mesh of level `coarse_level+1`
+   */
+  LinearFELevelTransfer(const lf::refinement::MeshHierarchy &mh,
+                        size_type coarse_level,
+                        const lf::assemble::DofHandler &coarse_dofh,
+                        const lf::assemble::DofHandler &fine_dofh);
+
+  /** @brief number of coarse dofs = number of columns of prolongation */
+  size_type NoCoarseDofs() const { return no_coarse_dofs_; }
+  /** @brief number of fine dofs = number of rows of prolongation */
+  size_type NoFineDofs() const { return offsets_.size() - 1; }
+
+  /**
+   * @brief prolongation of a coarse coefficient vector to the fine mesh
+   *
+   * @param u_coarse coefficient vector of length NoCoarseDofs()
+   * @return coefficient vector of length NoFineDofs() of the same function
+   */
+  Eigen::VectorXd Prolongate(const Eigen::VectorXd &u_coarse) const;
+
+  /**
+   * @brief restriction of a fine vector to the coarse mesh: application
+   * of the transposed prolongation
+   *
+   * @param r_fine vector of length NoFineDofs()
+   * @return vector of length NoCoarseDofs()
+   */
+  Eigen::VectorXd Restrict(const Eigen::VectorXd &r_fine) const;
+
+  /** @brief prolongation as a sparse `NoFineDofs() x NoCoarseDofs()` matrix */
+  Eigen::SparseMatrix<double> ProlongationMatrix() const;
+
+  /** @brief restriction as a sparse `NoCoarseDofs() x NoFineDofs()` matrix */
+  Eigen::SparseMatrix<double> RestrictionMatrix() const {
+    return ProlongationMatrix().transpose();
+  }
+
+ private:
+  size_type no_coarse_dofs_;
+  /** coarse dofs and weights contributing to every fine dof, compressed row
+   * format */
+  std::vector<size_type> offsets_;
+  std::vector<gdof_idx_t> coarse_dofs_;
+  std::vector<double> weights_;
+};
+
+}  // namespace lf::fe
+
+#endif
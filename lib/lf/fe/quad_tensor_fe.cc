@@ -0,0 +1,122 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief One-dimensional building blocks of tensor product Lagrange finite
+ * elements on quadrilaterals
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#include "quad_tensor_fe.h"
+
+namespace lf::fe {
+
+LagrangeBasis1D::LagrangeBasis1D(unsigned int degree)
+    : degree_(degree),
+      nodes_(Eigen::VectorXd::LinSpaced(degree + 1, 0.0, 1.0)) {
+  LF_VERIFY_MSG(degree >= 1, "Degree must be positive");
+}
+
+Eigen::MatrixXd LagrangeBasis1D::Eval(const Eigen::RowVectorXd &x) const {
+  const unsigned int n = degree_ + 1;
+  Eigen::MatrixXd vals(n, x.size());
+  for (unsigned int a = 0; a < n; ++a) {
+    Eigen::ArrayXd prod = Eigen::ArrayXd::Ones(x.size());
+    for (unsigned int m = 0; m < n; ++m) {
+      if (m != a) {
+        prod *= (x.transpose().array() - nodes_[m]) / (nodes_[a] - nodes_[m]);
+      }
+    }
+    vals.row(a) = prod.transpose();
+  }
+  return vals;
+}
+
+Eigen::MatrixXd LagrangeBasis1D::EvalDerivatives(
+    const Eigen::RowVectorXd &x) const {
+  const unsigned int n = degree_ + 1;
+  Eigen::MatrixXd ders(n, x.size());
+  for (unsigned int a = 0; a < n; ++a) {
+    // Product rule: differentiate one linear factor at a time
+    Eigen::ArrayXd sum = Eigen::ArrayXd::Zero(x.size());
+    for (unsigned int l = 0; l < n; ++l) {
+      if (l == a) {
+        continue;
+      }
+      Eigen::ArrayXd prod =
+          Eigen::ArrayXd::Constant(x.size(), 1.0 / (nodes_[a] - nodes_[l]));
+      for (unsigned int m = 0; m < n; ++m) {
+        if ((m != a) && (m != l)) {
+          prod *=
+              (x.transpose().array() - nodes_[m]) / (nodes_[a] - nodes_[m]);
+        }
+      }
+      sum += prod;
+    }
+    ders.row(a) = sum.transpose();
+  }
+  return ders;
+}
+
+std::vector<size_type> QuadTensorLexToDof(unsigned int degree) {
+  const size_type p = degree;
+  const size_type n = p + 1;
+  std::vector<size_type> lex_to_dof(n * n);
+  auto lex = [n](size_type a, size_type b) { return a + n * b; };
+  // Vertices in the order of the reference element
+  lex_to_dof[lex(0, 0)] = 0;
+  lex_to_dof[lex(p, 0)] = 1;
+  lex_to_dof[lex(p, p)] = 2;
+  lex_to_dof[lex(0, p)] = 3;
+  // Interior nodes of the edges, traversed from endpoint 0 to endpoint 1
+  size_type cnt = 4;
+  for (size_type a = 1; a < p; ++a) {  // edge 0: (0,0) -> (1,0)
+    lex_to_dof[lex(a, 0)] = cnt++;
+  }
+  for (size_type b = 1; b < p; ++b) {  // edge 1: (1,0) -> (1,1)
+    lex_to_dof[lex(p, b)] = cnt++;
+  }
+  for (size_type a = p - 1; a > 0; --a) {  // edge 2: (1,1) -> (0,1)
+    lex_to_dof[lex(a, p)] = cnt++;
+  }
+  for (size_type b = p - 1; b > 0; --b) {  // edge 3: (0,1) -> (0,0)
+    lex_to_dof[lex(0, b)] = cnt++;
+  }
+  // Interior nodes of the cell
+  for (size_type b = 1; b < p; ++b) {
+    for (size_type a = 1; a < p; ++a) {
+      lex_to_dof[lex(a, b)] = cnt++;
+    }
+  }
+  return lex_to_dof;
+}
+
+QuadTensorKernels::QuadTensorKernels(unsigned int degree,
+                                     unsigned int num_points_1d)
+    : degree_(degree), lex_to_dof_(QuadTensorLexToDof(degree)) {
+  LF_VERIFY_MSG(num_points_1d >= 1, "At least one quadrature point needed");
+  const lf::quad::QuadRule &qr1d{lf::quad::QuadRuleCache(
+      lf::base::RefEl::kSegment(), 2 * num_points_1d - 1)};
+  const LagrangeBasis1D basis(degree);
+  B_ = basis.Eval(qr1d.Points().row(0)).transpose();
+  D_ = basis.EvalDerivatives(qr1d.Points().row(0)).transpose();
+
+  const Eigen::Index n = num_points_1d;
+  points_.resize(2, n * n);
+  weights_.resize(n * n);
+  for (Eigen::Index r = 0; r < n; ++r) {
+    for (Eigen::Index q = 0; q < n; ++q) {
+      points_(0, q + n * r) = qr1d.Points()(0, q);
+      points_(1, q + n * r) = qr1d.Points()(0, r);
+      weights_[q + n * r] = qr1d.Weights()[q] * qr1d.Weights()[r];
+    }
+  }
+}
+
+}  // namespace lf::fe
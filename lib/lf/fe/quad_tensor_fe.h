@@ -0,0 +1,528 @@
+#ifndef LF_FE_QUAD_TENSOR
+#define LF_FE_QUAD_TENSOR
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Tensor product Lagrange finite elements of arbitrary degree on
+ * quadrilaterals and sum-factorization kernels for them
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#include <lf/assemble/assemble.h>
+#include <lf/quad/quad.h>
+#include <vector>
+#include "coefficient_eval.h"
+#include "lagr_fe.h"
+
+namespace lf::fe {
+
+/**
+ * @brief Lagrange polynomials of degree \f$ p \f$ on \f$ [0,1] \f$ for the
+ * equidistant nodes \f$ t_a = a/p \f$, \f$ a=0,\ldots,p \f$
+ */
+class LagrangeBasis1D {
+ public:
+  /**
+   * @brief Set up the nodes
+   * @param degree polynomial degree \f$ p \geq 1 \f$
+   */
+  explicit LagrangeBasis1D(unsigned int degree);
+
+  /** @brief the polynomial degree */
+  unsigned int Degree() const { return degree_; }
+  /** @brief the interpolation nodes \f$ t_0,\ldots,t_p \f$ */
+  const Eigen::VectorXd &Nodes() const { return nodes_; }
+
+  /**
+   * @brief Values of all Lagrange polynomials at a number of points
+   * @param x points in \f$ [0,1] \f$
+   * @return matrix of size `(p+1) x x.size()`, row `a` contains the values of
+   * the polynomial belonging to node \f$ t_a \f$.
+   */
+  Eigen::MatrixXd Eval(const Eigen::RowVectorXd &x) const;
+  /**
+   * @brief Derivatives of all Lagrange polynomials at a number of points
+   * @param x points in \f$ [0,1] \f$
+   * @return matrix of size `(p+1) x x.size()`, layout as for Eval()
+   */
+  Eigen::MatrixXd EvalDerivatives(const Eigen::RowVectorXd &x) const;
+
+ private:
+  unsigned int degree_;
+  Eigen::VectorXd nodes_;
+};
+
+/**
+ * @brief Numbering of the local shape functions of QuadTensorLagrangeFE
+ *
+ * @param degree polynomial degree \f$ p \f$
+ * @return vector of length \f$ (p+1)^2 \f$: entry `a + (p+1)*b` is the
+ * local index of the shape function \f$ L_a(x)L_b(y) \f$ associated with the
+ * node \f$ (t_a,t_b) \f$.
+ *
+ * The numbering complies with the rules of lf::assemble::DofHandler: first
+ * the four vertices, then the \f$ p-1 \f$ interior nodes of each edge,
+ * ordered from the first to the second endpoint of the edge, then the
+ * interior nodes of the cell in lexicographic order (x fastest).
+ */
+std::vector<size_type> QuadTensorLexToDof(unsigned int degree);
+
+/**
+ * @brief Lagrange finite element of degree \f$ p \f$ on the quadrilateral
+ * reference element
+ *
+ * The local space is \f$ \mathbb{Q}_p \f$ spanned by the products
+ * \f$ L_a(\widehat{x}_1)L_b(\widehat{x}_2) \f$ of the one-dimensional
+ * Lagrange polynomials of LagrangeBasis1D. For the numbering of the shape
+ * functions see QuadTensorLexToDof().
+ *
+ * This is a specialization of ScalarReferenceFiniteElement.
+ * Refer to its documentation.
+ */
+template <typename SCALAR>
+class QuadTensorLagrangeFE final : public ScalarReferenceFiniteElement<SCALAR> {
+ public:
+  QuadTensorLagrangeFE(const QuadTensorLagrangeFE &) = default;
+  QuadTensorLagrangeFE(QuadTensorLagrangeFE &&) noexcept = default;
+  QuadTensorLagrangeFE &operator=(const QuadTensorLagrangeFE &) = delete;
+  QuadTensorLagrangeFE &operator=(QuadTensorLagrangeFE &&) noexcept = delete;
+  /**
+   * @brief Set up element of a given degree
+   * @param degree polynomial degree \f$ p \geq 1 \f$
+   */
+  explicit QuadTensorLagrangeFE(unsigned int degree)
+      : ScalarReferenceFiniteElement<SCALAR>(lf::base::RefEl::kQuad(), degree),
+        basis_(degree),
+        lex_to_dof_(QuadTensorLexToDof(degree)) {}
+  virtual ~QuadTensorLagrangeFE() = default;
+
+  /** @copydoc ScalarReferenceFiniteElement::NumRefShapeFunctions() */
+  size_type NumRefShapeFunctions() const override {
+    return (basis_.Degree() + 1) * (basis_.Degree() + 1);
+  }
+
+  /** @brief One shape function per vertex, \f$ p-1 \f$ per edge and
+   * \f$ (p-1)^2 \f$ in the interior
+   * @copydoc ScalarReferenceFiniteElement::NumRefShapeFunctions(dim_t)
+   */
+  size_type NumRefShapeFunctions(dim_t codim,
+                                 sub_idx_t /*subidx*/) const override {
+    LF_ASSERT_MSG(codim <= 2, "Illegal codim " << codim);
+    const size_type p = basis_.Degree();
+    return (codim == 2) ? 1 : ((codim == 1) ? p - 1 : (p - 1) * (p - 1));
+  }
+
+  /** @copydoc ScalarReferenceFiniteElement::EvalReferenceShapeFunctions() */
+  std::vector<Eigen::Matrix<SCALAR, 1, Eigen::Dynamic>>
+  EvalReferenceShapeFunctions(const Eigen::MatrixXd &refcoords) const override {
+    LF_ASSERT_MSG(refcoords.rows() == 2,
+                  "Reference coordinates must be 2-vectors");
+    const Eigen::MatrixXd bx{basis_.Eval(refcoords.row(0))};
+    const Eigen::MatrixXd by{basis_.Eval(refcoords.row(1))};
+    const size_type n = basis_.Degree() + 1;
+    std::vector<Eigen::Matrix<SCALAR, 1, Eigen::Dynamic>> ret(n * n);
+    for (size_type b = 0; b < n; ++b) {
+      for (size_type a = 0; a < n; ++a) {
+        ret[lex_to_dof_[a + n * b]] =
+            (bx.row(a).array() * by.row(b).array()).matrix();
+      }
+    }
+    return ret;
+  }
+
+  /** @copydoc ScalarReferenceFiniteElement::GradientsReferenceShapeFunctions*/
+  std::vector<Eigen::Matrix<SCALAR, Eigen::Dynamic, Eigen::Dynamic>>
+  GradientsReferenceShapeFunctions(
+      const Eigen::MatrixXd &refcoords) const override {
+    LF_ASSERT_MSG(refcoords.rows() == 2,
+                  "Reference coordinates must be 2-vectors");
+    const Eigen::MatrixXd bx{basis_.Eval(refcoords.row(0))};
+    const Eigen::MatrixXd by{basis_.Eval(refcoords.row(1))};
+    const Eigen::MatrixXd dx{basis_.EvalDerivatives(refcoords.row(0))};
+    const Eigen::MatrixXd dy{basis_.EvalDerivatives(refcoords.row(1))};
+    const size_type n = basis_.Degree() + 1;
+    std::vector<Eigen::Matrix<SCALAR, Eigen::Dynamic, Eigen::Dynamic>> ret(
+        n * n);
+    for (size_type b = 0; b < n; ++b) {
+      for (size_type a = 0; a < n; ++a) {
+        auto &grad = ret[lex_to_dof_[a + n * b]];
+        grad.resize(2, refcoords.cols());
+        grad.row(0) = (dx.row(a).array() * by.row(b).array()).matrix();
+        grad.row(1) = (bx.row(a).array() * dy.row(b).array()).matrix();
+      }
+    }
+    return ret;
+  }
+
+  /** @copydoc ScalarReferenceFiniteElement::Tabulate() */
+  void Tabulate(const Eigen::MatrixXd &refcoords,
+                SCALAR *buffer) const override {
+    LF_ASSERT_MSG(refcoords.rows() == 2,
+                  "Reference coordinates must be 2-vectors");
+    const Eigen::MatrixXd bx{basis_.Eval(refcoords.row(0))};
+    const Eigen::MatrixXd by{basis_.Eval(refcoords.row(1))};
+    const Eigen::MatrixXd dx{basis_.EvalDerivatives(refcoords.row(0))};
+    const Eigen::MatrixXd dy{basis_.EvalDerivatives(refcoords.row(1))};
+    const size_type n = basis_.Degree() + 1;
+    const size_type n_rsf = n * n;
+    const size_type n_pts = refcoords.cols();
+    Eigen::Map<Eigen::Matrix<SCALAR, Eigen::Dynamic, Eigen::Dynamic>> vals(
+        buffer, n_rsf, n_pts);
+    SCALAR *grads =
+        buffer + ShapeFunctionTabulation<SCALAR>::GradientOffset(n_rsf, n_pts);
+    for (size_type b = 0; b < n; ++b) {
+      for (size_type a = 0; a < n; ++a) {
+        const size_type i = lex_to_dof_[a + n * b];
+        for (size_type k = 0; k < n_pts; ++k) {
+          vals(i, k) = bx(a, k) * by(b, k);
+          grads[2 * (i + n_rsf * k)] = dx(a, k) * by(b, k);
+          grads[2 * (i + n_rsf * k) + 1] = bx(a, k) * dy(b, k);
+        }
+      }
+    }
+  }
+
+  /** @brief Evaluation nodes are the tensor product nodes
+   * \f$ (t_a,t_b) \f$
+   * @copydoc ScalarReferenceFiniteElement::EvaluationNodes()
+   */
+  Eigen::MatrixXd EvaluationNodes() const override {
+    const size_type n = basis_.Degree() + 1;
+    Eigen::MatrixXd nodes(2, n * n);
+    for (size_type b = 0; b < n; ++b) {
+      for (size_type a = 0; a < n; ++a) {
+        nodes(0, lex_to_dof_[a + n * b]) = basis_.Nodes()[a];
+        nodes(1, lex_to_dof_[a + n * b]) = basis_.Nodes()[b];
+      }
+    }
+    return nodes;
+  }
+
+  /** @copydoc ScalarReferenceFiniteElement::NumEvaluationNodes() */
+  size_type NumEvaluationNodes() const override {
+    return NumRefShapeFunctions();
+  }
+
+ private:
+  LagrangeBasis1D basis_;
+  std::vector<size_type> lex_to_dof_;
+};
+
+/**
+ * @brief Sum-factorized evaluation of QuadTensorLagrangeFE functions and
+ * their gradients in the points of a tensor product Gauss rule
+ *
+ * The coefficients of a function in the local space are passed as a
+ * `(p+1) x (p+1)` matrix \f$ \mathbf{U} \f$ in lexicographic order: entry
+ * `(a,b)` belongs to \f$ L_a(x)L_b(y) \f$. Values in the \f$ n^2 \f$
+ * quadrature points are returned as `n x n` matrices, entry `(q,r)` belongs to
+ * the point \f$ (\xi_q,\xi_r) \f$. With the 1D matrices
+ * \f$ B_{qa} = L_a(\xi_q) \f$ and \f$ D_{qa} = L'_a(\xi_q) \f$
+ * - the values are \f$ \mathbf{B}\mathbf{U}\mathbf{B}^T \f$,
+ * - the x-derivatives are \f$ \mathbf{D}\mathbf{U}\mathbf{B}^T \f$,
+ * - the y-derivatives are \f$ \mathbf{B}\mathbf{U}\mathbf{D}^T \f$.
+ *
+ * Each product costs \f$ O(p^3) \f$ operations instead of the
+ * \f$ O(p^4) \f$ needed for evaluating all \f$ (p+1)^2 \f$ shape functions in
+ * all \f$ n^2 \sim p^2 \f$ points.
+ */
+class QuadTensorKernels {
+ public:
+  /**
+   * @brief Precompute the 1D matrices
+   * @param degree polynomial degree \f$ p \f$
+   * @param num_points_1d number \f$ n \f$ of Gauss points per direction
+   */
+  QuadTensorKernels(unsigned int degree, unsigned int num_points_1d);
+
+  /** @brief the polynomial degree */
+  unsigned int Degree() const { return degree_; }
+  /** @brief number of Gauss points per direction */
+  size_type NumPoints1D() const { return B_.rows(); }
+  /** @brief the `2 x n*n` quadrature points, column `q + n*r` is
+   * \f$ (\xi_q,\xi_r) \f$ */
+  const Eigen::MatrixXd &Points() const { return points_; }
+  /** @brief the quadrature weights belonging to Points() */
+  const Eigen::VectorXd &Weights() const { return weights_; }
+  /** @brief see QuadTensorLexToDof() */
+  const std::vector<size_type> &LexToDof() const { return lex_to_dof_; }
+
+  /** @brief values \f$ \mathbf{B}\mathbf{U}\mathbf{B}^T \f$ in the
+   * quadrature points */
+  void Values(const Eigen::MatrixXd &U, Eigen::MatrixXd &V) const {
+    V.noalias() = B_ * U * B_.transpose();
+  }
+  /** @brief reference gradients in the quadrature points */
+  void Gradients(const Eigen::MatrixXd &U, Eigen::MatrixXd &Gx,
+                 Eigen::MatrixXd &Gy) const {
+    const Eigen::MatrixXd UBt{U * B_.transpose()};
+    Gx.noalias() = D_ * UBt;
+    Gy.noalias() = B_ * U * D_.transpose();
+  }
+  /** @brief transpose of Values(): \f$ \mathbf{Y} \mathrel{+}=
+   * \mathbf{B}^T\mathbf{V}\mathbf{B} \f$ */
+  void AddValuesTransposed(const Eigen::MatrixXd &V, Eigen::MatrixXd &Y) const {
+    Y.noalias() += B_.transpose() * V * B_;
+  }
+  /** @brief transpose of Gradients(): \f$ \mathbf{Y} \mathrel{+}=
+   * \mathbf{D}^T\mathbf{F}_x\mathbf{B} + \mathbf{B}^T\mathbf{F}_y\mathbf{D}
+   * \f$ */
+  void AddGradientsTransposed(const Eigen::MatrixXd &Fx,
+                              const Eigen::MatrixXd &Fy,
+                              Eigen::MatrixXd &Y) const {
+    Y.noalias() += D_.transpose() * Fx * B_;
+    Y.noalias() += B_.transpose() * Fy * D_;
+  }
+
+ private:
+  unsigned int degree_;
+  Eigen::MatrixXd B_, D_;
+  Eigen::MatrixXd points_;
+  Eigen::VectorXd weights_;
+  std::vector<size_type> lex_to_dof_;
+};
+
+/**
+ * @brief Local computations for the bilinear form
+ * \f$ (u,v)\mapsto\int_K \alpha\nabla u\cdot\nabla v + \gamma uv\,dx \f$ and
+ * QuadTensorLagrangeFE on planar quadrilaterals by sum factorization
+ *
+ * @tparam DIFF_COEFF functor for \f$ \alpha \f$, scalar or 2x2 matrix valued
+ * @tparam REACTION_COEFF functor for the scalar \f$ \gamma \f$
+ *
+ * The Gauss rule has \f$ p+1 \f$ points per direction, which is the rule used
+ * by LagrangeFEEllBVPElementMatrix for the same degree. The computations on
+ * a cell are split into two steps:
+ * - QuadData() evaluates geometry and coefficients in the quadrature points,
+ * - ApplyLocal() applies the element matrix to a vector in \f$ O(p^3) \f$.
+ *
+ * Eval() computes the full element matrix by applying it to the unit vectors,
+ * which costs \f$ O(p^5) \f$. This class complies with the requirements for
+ * the type `ELEM_MAT_COMP` of lf::assemble::AssembleMatrixLocally().
+ */
+template <typename DIFF_COEFF, typename REACTION_COEFF>
+class QuadTensorEllBVPElementMatrix {
+ public:
+  /** @brief type of returned element matrix */
+  using elem_mat_t = Eigen::MatrixXd;
+  using ElemMat = const elem_mat_t;
+
+  /**
+   * @brief Coefficients in the quadrature points of one cell
+   *
+   * Column `c` of row `k` holds, multiplied with the quadrature weight and the
+   * integration element, the entry `c` of the (column major) 2x2 matrix
+   * \f$ (\alpha J^{-T})^TJ^{-T} \f$ for `c<4` and \f$ \gamma \f$ for `c==4`.
+   */
+  using quad_data_t = Eigen::Matrix<double, Eigen::Dynamic, 5>;
+
+  /**
+   * @brief Constructor: cell-independent precomputations
+   * @param degree polynomial degree of QuadTensorLagrangeFE
+   * @param alpha diffusion coefficient
+   * @param gamma reaction coefficient
+   */
+  QuadTensorEllBVPElementMatrix(unsigned int degree, DIFF_COEFF alpha,
+                                REACTION_COEFF gamma)
+      : kernels_(degree, degree + 1), alpha_(alpha), gamma_(gamma) {}
+
+  /** @brief All cells are considered active in the default implementation */
+  virtual bool isActive(const lf::mesh::Entity & /*cell*/) { return true; }
+
+  /** @brief the underlying sum-factorization kernels */
+  const QuadTensorKernels &Kernels() const { return kernels_; }
+
+  /**
+   * @brief Evaluate geometry and coefficients in the quadrature points
+   * @param cell planar quadrilateral
+   * @param data the coefficients, see quad_data_t
+   */
+  void QuadData(const lf::mesh::Entity &cell, quad_data_t &data) const;
+
+  /**
+   * @brief Apply the element matrix of a cell
+   * @param data coefficients of the cell as computed by QuadData()
+   * @param U `(p+1)x(p+1)` coefficients in lexicographic order
+   * @param Y the result is added to this `(p+1)x(p+1)` matrix
+   */
+  void ApplyLocal(const quad_data_t &data, const Eigen::MatrixXd &U,
+                  Eigen::MatrixXd &Y) const;
+
+  /**
+   * @brief Element matrix for the local shape functions numbered as in
+   * QuadTensorLagrangeFE
+   * @param cell planar quadrilateral
+   */
+  ElemMat Eval(const lf::mesh::Entity &cell);
+
+ private:
+  QuadTensorKernels kernels_;
+  DIFF_COEFF alpha_;
+  REACTION_COEFF gamma_;
+};
+
+template <typename DIFF_COEFF, typename REACTION_COEFF>
+void QuadTensorEllBVPElementMatrix<DIFF_COEFF, REACTION_COEFF>::QuadData(
+    const lf::mesh::Entity &cell, quad_data_t &data) const {
+  LF_ASSERT_MSG(cell.RefEl() == lf::base::RefEl::kQuad(),
+                "Only quadrilaterals are supported");
+  const lf::geometry::Geometry &geo{*cell.Geometry()};
+  LF_ASSERT_MSG((geo.DimGlobal() == 2) && (geo.DimLocal() == 2),
+                "Only 2D implementation available!");
+  const Eigen::MatrixXd &points{kernels_.Points()};
+  const Eigen::MatrixXd mapped_qpts{geo.Global(points)};
+  const Eigen::VectorXd determinants{geo.IntegrationElement(points)};
+  const Eigen::MatrixXd JinvT{geo.JacobianInverseGramian(points)};
+  const Eigen::Index nqp = points.cols();
+  std::vector<coeff_value_t<const DIFF_COEFF>> alpha_vals;
+  std::vector<coeff_value_t<const REACTION_COEFF>> gamma_vals;
+  EvalCoefficient(alpha_, mapped_qpts, alpha_vals);
+  EvalCoefficient(gamma_, mapped_qpts, gamma_vals);
+  data.resize(nqp, 5);
+  for (Eigen::Index k = 0; k < nqp; ++k) {
+    const double w = kernels_.Weights()[k] * determinants[k];
+    const Eigen::Matrix2d jit{JinvT.block(0, 2 * k, 2, 2)};
+    const Eigen::Matrix2d m{w * ((alpha_vals[k] * jit).transpose() * jit)};
+    data.block<1, 4>(k, 0) = Eigen::Map<const Eigen::RowVector4d>(m.data());
+    data(k, 4) = w * gamma_vals[k];
+  }
+}
+
+template <typename DIFF_COEFF, typename REACTION_COEFF>
+void QuadTensorEllBVPElementMatrix<DIFF_COEFF, REACTION_COEFF>::ApplyLocal(
+    const quad_data_t &data, const Eigen::MatrixXd &U,
+    Eigen::MatrixXd &Y) const {
+  const Eigen::Index n = kernels_.NumPoints1D();
+  Eigen::MatrixXd V(n, n), Gx(n, n), Gy(n, n);
+  kernels_.Values(U, V);
+  kernels_.Gradients(U, Gx, Gy);
+  // Pointwise products with the coefficients, the n x n matrices are
+  // viewed as vectors of length n*n
+  auto col = [&data, n](int c) {
+    return Eigen::Map<const Eigen::ArrayXXd>(data.col(c).data(), n, n);
+  };
+  const Eigen::MatrixXd Fx{(col(0) * Gx.array() + col(2) * Gy.array())};
+  const Eigen::MatrixXd Fy{(col(1) * Gx.array() + col(3) * Gy.array())};
+  V.array() *= col(4);
+  kernels_.AddGradientsTransposed(Fx, Fy, Y);
+  kernels_.AddValuesTransposed(V, Y);
+}
+
+template <typename DIFF_COEFF, typename REACTION_COEFF>
+typename QuadTensorEllBVPElementMatrix<DIFF_COEFF, REACTION_COEFF>::ElemMat
+QuadTensorEllBVPElementMatrix<DIFF_COEFF, REACTION_COEFF>::Eval(
+    const lf::mesh::Entity &cell) {
+  quad_data_t data;
+  QuadData(cell, data);
+  const Eigen::Index n = kernels_.Degree() + 1;
+  const std::vector<size_type> &lex_to_dof{kernels_.LexToDof()};
+  elem_mat_t mat(n * n, n * n);
+  Eigen::MatrixXd U{Eigen::MatrixXd::Zero(n, n)};
+  Eigen::MatrixXd Y(n, n);
+  for (Eigen::Index j = 0; j < n * n; ++j) {
+    U(j) = 1.0;
+    Y.setZero();
+    ApplyLocal(data, U, Y);
+    U(j) = 0.0;
+    for (Eigen::Index i = 0; i < n * n; ++i) {
+      mat(lex_to_dof[i], lex_to_dof[j]) = Y(i);
+    }
+  }
+  return mat;
+}
+
+/**
+ * @brief Matrix-free application of the Galerkin matrix of
+ * \f$ (u,v)\mapsto\int_\Omega \alpha\nabla u\cdot\nabla v + \gamma uv\,dx \f$
+ * for QuadTensorLagrangeFE on a mesh of planar quadrilaterals
+ *
+ * The coefficients in the quadrature points of all cells are computed once by
+ * the constructor and stored, see
+ * QuadTensorEllBVPElementMatrix::QuadData(). Apply() then costs
+ * \f$ O(p^3) \f$ operations per cell and never forms element matrices.
+ */
+template <typename DIFF_COEFF, typename REACTION_COEFF>
+class QuadTensorEllBVPOperator {
+ public:
+  using elem_mat_comp_t = QuadTensorEllBVPElementMatrix<DIFF_COEFF, REACTION_COEFF>;
+
+  /**
+   * @brief Precompute the coefficients in all quadrature points
+   * @param dofh dof handler matching QuadTensorLagrangeFE of degree `degree`,
+   * i.e., one dof per node, \f$ p-1 \f$ per edge and \f$ (p-1)^2 \f$ per cell
+   * @param degree polynomial degree
+   * @param alpha diffusion coefficient
+   * @param gamma reaction coefficient
+   */
+  QuadTensorEllBVPOperator(const lf::assemble::DofHandler &dofh,
+                           unsigned int degree, DIFF_COEFF alpha,
+                           REACTION_COEFF gamma);
+
+  /** @brief number of rows and columns of the Galerkin matrix */
+  size_type NumDofs() const { return dofh_.NoDofs(); }
+
+  /**
+   * @brief Compute \f$ \mathbf{y} = \mathbf{A}\mathbf{u} \f$
+   * @param u vector of length NumDofs()
+   * @param y result, resized to NumDofs()
+   */
+  void Apply(const Eigen::VectorXd &u, Eigen::VectorXd &y) const;
+
+ private:
+  const lf::assemble::DofHandler &dofh_;
+  elem_mat_comp_t elem_mat_comp_;
+  std::vector<const lf::mesh::Entity *> cells_;
+  std::vector<typename elem_mat_comp_t::quad_data_t> quad_data_;
+};
+
+template <typename DIFF_COEFF, typename REACTION_COEFF>
+QuadTensorEllBVPOperator<DIFF_COEFF, REACTION_COEFF>::QuadTensorEllBVPOperator(
+    const lf::assemble::DofHandler &dofh, unsigned int degree,
+    DIFF_COEFF alpha, REACTION_COEFF gamma)
+    : dofh_(dofh), elem_mat_comp_(degree, alpha, gamma) {
+  const lf::mesh::Mesh &mesh{*dofh_.Mesh()};
+  cells_.reserve(mesh.Size(0));
+  for (const lf::mesh::Entity &cell : mesh.Entities(0)) {
+    LF_ASSERT_MSG(dofh_.NoLocalDofs(cell) == (degree + 1) * (degree + 1),
+                  "Dof handler does not match the degree");
+    cells_.push_back(&cell);
+  }
+  quad_data_.resize(cells_.size());
+  for (std::size_t k = 0; k < cells_.size(); ++k) {
+    elem_mat_comp_.QuadData(*cells_[k], quad_data_[k]);
+  }
+}
+
+template <typename DIFF_COEFF, typename REACTION_COEFF>
+void QuadTensorEllBVPOperator<DIFF_COEFF, REACTION_COEFF>::Apply(
+    const Eigen::VectorXd &u, Eigen::VectorXd &y) const {
+  LF_ASSERT_MSG(u.size() == NumDofs(), "Vector length mismatch");
+  const std::vector<size_type> &lex_to_dof{
+      elem_mat_comp_.Kernels().LexToDof()};
+  const Eigen::Index n = elem_mat_comp_.Kernels().Degree() + 1;
+  y.setZero(NumDofs());
+  Eigen::MatrixXd U(n, n), Y(n, n);
+  for (std::size_t k = 0; k < cells_.size(); ++k) {
+    lf::base::RandomAccessRange<const gdof_idx_t> idx(
+        dofh_.GlobalDofIndices(*cells_[k]));
+    for (Eigen::Index i = 0; i < n * n; ++i) {
+      U(i) = u[idx[lex_to_dof[i]]];
+    }
+    Y.setZero();
+    elem_mat_comp_.ApplyLocal(quad_data_[k], U, Y);
+    for (Eigen::Index i = 0; i < n * n; ++i) {
+      y[idx[lex_to_dof[i]]] += Y(i);
+    }
+  }
+}
+
+}  // namespace lf::fe
+
+#endif
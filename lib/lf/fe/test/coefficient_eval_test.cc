@@ -0,0 +1,170 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Tests for the batched evaluation of coefficient functors
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#include "lf/fe/coefficient_eval.h"
+#include <gtest/gtest.h>
+#include <lf/mesh/utils/utils.h>
+#include <memory>
+#include "lf/fe/loc_comp_ellbvp.h"
+#include "lf/fe/quad_tensor_fe.h"
+#include "lf/mesh/test_utils/test_meshes.h"
+
+namespace lf::fe::test {
+
+// Scalar coefficient 1+x*y supporting the batched protocol; counts the calls
+// of both evaluation methods
+struct BatchedCoefficient {
+  double operator()(const Eigen::Vector2d &x) const {
+    ++*num_point_calls;
+    return 1.0 + x[0] * x[1];
+  }
+  void EvalBatch(const Eigen::MatrixXd &pts, std::vector<double> &vals) const {
+    ++*num_batch_calls;
+    Eigen::Map<Eigen::ArrayXd>(vals.data(), pts.cols()) =
+        1.0 + pts.row(0).array().transpose() * pts.row(1).array().transpose();
+  }
+  std::shared_ptr<int> num_point_calls{std::make_shared<int>(0)};
+  std::shared_ptr<int> num_batch_calls{std::make_shared<int>(0)};
+};
+
+// Matrix-valued coefficient supporting the batched protocol
+struct BatchedTensorCoefficient {
+  Eigen::Matrix2d operator()(const Eigen::Vector2d &x) const {
+    return (Eigen::Matrix2d() << 2.0, x[0], x[0], 3.0).finished();
+  }
+  void EvalBatch(const Eigen::MatrixXd &pts,
+                 std::vector<Eigen::Matrix2d> &vals) const {
+    for (Eigen::Index k = 0; k < pts.cols(); ++k) {
+      vals[k] = (*this)(pts.col(k));
+    }
+  }
+};
+
+TEST(lf_fe, coefficient_eval_dispatch) {
+  auto plain = [](const Eigen::Vector2d &x) -> double {
+    return 1.0 + x[0] * x[1];
+  };
+  static_assert(!HasEvalBatch<decltype(plain)>::value);
+  static_assert(HasEvalBatch<BatchedCoefficient>::value);
+  static_assert(HasEvalBatch<const BatchedCoefficient>::value);
+  static_assert(HasEvalBatch<BatchedTensorCoefficient>::value);
+  static_assert(std::is_same_v<coeff_value_t<BatchedTensorCoefficient>,
+                               Eigen::Matrix2d>);
+
+  const Eigen::MatrixXd pts{Eigen::MatrixXd::Random(2, 7)};
+  std::vector<double> vals_plain;
+  std::vector<double> vals_batch;
+  BatchedCoefficient batched;
+  EvalCoefficient(plain, pts, vals_plain);
+  EvalCoefficient(batched, pts, vals_batch);
+  EXPECT_EQ(*batched.num_batch_calls, 1);
+  EXPECT_EQ(*batched.num_point_calls, 0);
+  ASSERT_EQ(vals_batch.size(), 7);
+  for (int k = 0; k < 7; ++k) {
+    EXPECT_NEAR(vals_plain[k], vals_batch[k], 1.0E-15);
+  }
+}
+
+// The element providers must use the batched protocol and yield the same
+// results as with ordinary functors
+TEST(lf_fe, coefficient_eval_providers) {
+  auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh(0);
+  auto alpha = [](const Eigen::Vector2d &x) -> Eigen::Matrix2d {
+    return (Eigen::Matrix2d() << 2.0, x[0], x[0], 3.0).finished();
+  };
+  auto gamma = [](const Eigen::Vector2d &x) -> double {
+    return 1.0 + x[0] * x[1];
+  };
+  const BatchedTensorCoefficient alpha_batched;
+  const BatchedCoefficient gamma_batched;
+
+  const TriaLinearLagrangeFE<double> tlfe;
+  const QuadLinearLagrangeFE<double> qlfe;
+  LagrangeFEEllBVPElementMatrix<decltype(alpha), decltype(gamma)> elmat(
+      tlfe, qlfe, alpha, gamma);
+  LagrangeFEEllBVPElementMatrix<BatchedTensorCoefficient, BatchedCoefficient>
+      elmat_batched(tlfe, qlfe, alpha_batched, gamma_batched);
+  ScalarFELocalLoadVector<double, decltype(gamma)> elvec(tlfe, qlfe, gamma);
+  ScalarFELocalLoadVector<double, BatchedCoefficient> elvec_batched(
+      tlfe, qlfe, gamma_batched);
+  QuadTensorEllBVPElementMatrix<decltype(alpha), decltype(gamma)> elmat_q2(
+      2, alpha, gamma);
+  QuadTensorEllBVPElementMatrix<BatchedTensorCoefficient, BatchedCoefficient>
+      elmat_q2_batched(2, alpha_batched, gamma_batched);
+
+  int num_cells = 0;
+  for (const lf::mesh::Entity &cell : mesh_p->Entities(0)) {
+    const Eigen::MatrixXd A{elmat.Eval(cell)};
+    EXPECT_LT((elmat_batched.Eval(cell) - A).norm(), 1.0E-14 * A.norm());
+    const Eigen::VectorXd phi{elvec.Eval(cell)};
+    EXPECT_LT((elvec_batched.Eval(cell) - phi).norm(), 1.0E-14 * phi.norm());
+    num_cells += 2;
+    if (cell.RefEl() == lf::base::RefEl::kQuad()) {
+      const Eigen::MatrixXd B{elmat_q2.Eval(cell)};
+      EXPECT_LT((elmat_q2_batched.Eval(cell) - B).norm(), 1.0E-14 * B.norm());
+      ++num_cells;
+    }
+  }
+  // One batched evaluation per cell and provider, no pointwise evaluations
+  EXPECT_EQ(*gamma_batched.num_batch_calls, num_cells);
+  EXPECT_EQ(*gamma_batched.num_point_calls, 0);
+}
+
+// Zero and constant coefficients must give the same element matrices as
+// ordinary functors with the same values
+template <typename ALPHA, typename GAMMA, typename ALPHA_REF,
+          typename GAMMA_REF>
+void CheckSpecialCoefficients(ALPHA alpha, GAMMA gamma, ALPHA_REF alpha_ref,
+                              GAMMA_REF gamma_ref) {
+  // Contains affine triangles and general quadrilaterals
+  auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh(0);
+  const TriaLinearLagrangeFE<double> tlfe;
+  const QuadLinearLagrangeFE<double> qlfe;
+  LagrangeFEEllBVPElementMatrix<ALPHA, GAMMA> elmat(tlfe, qlfe, alpha, gamma);
+  LagrangeFEEllBVPElementMatrix<ALPHA_REF, GAMMA_REF> elmat_ref(
+      tlfe, qlfe, alpha_ref, gamma_ref);
+  for (const lf::mesh::Entity &cell : mesh_p->Entities(0)) {
+    const Eigen::MatrixXd A{elmat_ref.Eval(cell)};
+    EXPECT_LT((elmat.Eval(cell) - A).norm(), 1.0E-13 * A.norm())
+        << cell.RefEl();
+  }
+}
+
+TEST(lf_fe, coefficient_eval_zero_constant) {
+  static_assert(IsConstantCoefficient<ZeroCoefficient>::value);
+  static_assert(IsConstantCoefficient<ConstantCoefficient<double>>::value);
+  static_assert(!IsZeroCoefficient<ConstantCoefficient<double>>::value);
+  auto zero = [](const Eigen::Vector2d & /*x*/) -> double { return 0.0; };
+  auto two = [](const Eigen::Vector2d & /*x*/) -> double { return 2.0; };
+  auto var = [](const Eigen::Vector2d &x) -> double { return 1.0 + x[0]; };
+  const Eigen::Matrix2d K{(Eigen::Matrix2d() << 2.0, 0.5, 0.3, 1.0).finished()};
+  auto tensor = [K](const Eigen::Vector2d & /*x*/) -> Eigen::Matrix2d {
+    return K;
+  };
+  // Laplacian
+  CheckSpecialCoefficients(ConstantCoefficient<double>(2.0), ZeroCoefficient(),
+                           two, zero);
+  // Mass matrix
+  CheckSpecialCoefficients(ZeroCoefficient(), ConstantCoefficient<double>(2.0),
+                           zero, two);
+  // Constant tensor coefficient
+  CheckSpecialCoefficients(ConstantCoefficient<Eigen::Matrix2d>(K),
+                           ConstantCoefficient<double>(2.0), tensor, two);
+  // Variable diffusion, no reaction
+  CheckSpecialCoefficients(var, ZeroCoefficient(), var, zero);
+  // Constant diffusion, variable reaction
+  CheckSpecialCoefficients(ConstantCoefficient<double>(2.0), var, two, var);
+}
+
+}  // namespace lf::fe::test
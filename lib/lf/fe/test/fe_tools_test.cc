@@ -0,0 +1,133 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Tests for interpolation and error norms on whole meshes
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#include "lf/fe/fe_tools.h"
+#include <gtest/gtest.h>
+#include <lf/mesh/hybrid2d/hybrid2d.h>
+#include <lf/mesh/utils/utils.h>
+#include "lf/fe/quad_tensor_fe.h"
+#include "lf/mesh/test_utils/test_meshes.h"
+
+namespace lf::fe::test {
+
+std::shared_ptr<const lf::mesh::Mesh> TriaMesh(unsigned int n) {
+  lf::mesh::hybrid2d::TPTriagMeshBuilder builder(
+      std::make_shared<lf::mesh::hybrid2d::MeshFactory>(2));
+  builder.setBottomLeftCorner(Eigen::Vector2d{0.0, 0.0})
+      .setTopRightCorner(Eigen::Vector2d{1.0, 1.0})
+      .setNoXCells(n)
+      .setNoYCells(n);
+  return builder.Build();
+}
+
+// Finite element functions are reproduced exactly
+TEST(lf_fe, fe_tools_exact) {
+  auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh(0);
+  const lf::assemble::UniformFEDofHandler dofh(
+      mesh_p, {{lf::base::RefEl::kPoint(), 1}});
+  const TriaLinearLagrangeFE<double> tlfe;
+  const QuadLinearLagrangeFE<double> qlfe;
+  auto u = [](const Eigen::Vector2d &x) -> double {
+    return 1.0 + 2.0 * x[0] - x[1];
+  };
+  auto grad_u = [](const Eigen::Vector2d & /*x*/) -> Eigen::Vector2d {
+    return {2.0, -1.0};
+  };
+  const Eigen::VectorXd mu{NodalProjection(dofh, tlfe, qlfe, u)};
+  for (const lf::mesh::Entity &node : mesh_p->Entities(2)) {
+    const Eigen::Vector2d x{
+        node.Geometry()->Global(Eigen::Matrix<double, 0, 1>())};
+    EXPECT_NEAR(mu[dofh.InteriorGlobalDofIndices(node)[0]], u(x), 1.0E-14);
+  }
+  EXPECT_LT(L2Error(dofh, tlfe, qlfe, mu, u), 1.0E-13);
+  EXPECT_LT(H1SemiError(dofh, tlfe, qlfe, mu, grad_u), 1.0E-12);
+
+  // Biquadratic functions on a tensor product mesh
+  lf::mesh::hybrid2d::TPQuadMeshBuilder builder(
+      std::make_shared<lf::mesh::hybrid2d::MeshFactory>(2));
+  builder.setBottomLeftCorner(Eigen::Vector2d{0.0, 0.0})
+      .setTopRightCorner(Eigen::Vector2d{1.0, 2.0})
+      .setNoXCells(3)
+      .setNoYCells(4);
+  auto quad_mesh_p = builder.Build();
+  const lf::assemble::UniformFEDofHandler dofh_q2(
+      quad_mesh_p, {{lf::base::RefEl::kPoint(), 1},
+                    {lf::base::RefEl::kSegment(), 1},
+                    {lf::base::RefEl::kTria(), 0},
+                    {lf::base::RefEl::kQuad(), 1}});
+  const QuadTensorLagrangeFE<double> q2fe(2);
+  auto v = [](const Eigen::Vector2d &x) -> double {
+    return x[0] * x[0] * x[1] * x[1];
+  };
+  auto grad_v = [](const Eigen::Vector2d &x) -> Eigen::Vector2d {
+    return {2.0 * x[0] * x[1] * x[1], 2.0 * x[0] * x[0] * x[1]};
+  };
+  const Eigen::VectorXd nu{NodalProjection(dofh_q2, tlfe, q2fe, v)};
+  EXPECT_LT(L2Error(dofh_q2, tlfe, q2fe, nu, v), 1.0E-13);
+  EXPECT_LT(H1SemiError(dofh_q2, tlfe, q2fe, nu, grad_v), 1.0E-12);
+}
+
+// Fixture for tests that change lf::base::DefaultNumThreads(): the former
+// value is restored even if a test fails
+class FeToolsThreadsTest : public ::testing::Test {
+ protected:
+  void SetUp() override { num_threads_ = lf::base::DefaultNumThreads(); }
+  void TearDown() override { lf::base::DefaultNumThreads() = num_threads_; }
+
+ private:
+  unsigned int num_threads_{0};
+};
+
+// Rates of convergence of the interpolation error and independence of the
+// results from the number of threads
+TEST_F(FeToolsThreadsTest, fe_tools_convergence) {
+  auto u = [](const Eigen::Vector2d &x) -> double {
+    return std::sin(x[0]) * std::exp(x[1]);
+  };
+  auto grad_u = [](const Eigen::Vector2d &x) -> Eigen::Vector2d {
+    return {std::cos(x[0]) * std::exp(x[1]), std::sin(x[0]) * std::exp(x[1])};
+  };
+  const TriaLinearLagrangeFE<double> tlfe;
+  const QuadLinearLagrangeFE<double> qlfe;
+  std::vector<double> l2_errs;
+  std::vector<double> h1_errs;
+  for (unsigned int n : {16, 32}) {
+    auto mesh_p = TriaMesh(n);
+    const lf::assemble::UniformFEDofHandler dofh(
+        mesh_p, {{lf::base::RefEl::kPoint(), 1}});
+    const Eigen::VectorXd mu{NodalProjection(dofh, tlfe, qlfe, u)};
+    l2_errs.push_back(L2Error(dofh, tlfe, qlfe, mu, u));
+    h1_errs.push_back(H1SemiError(dofh, tlfe, qlfe, mu, grad_u));
+
+    lf::base::DefaultNumThreads() = 1;
+    const Eigen::VectorXd mu_serial{NodalProjection(dofh, tlfe, qlfe, u)};
+    const double l2_serial = L2Error(dofh, tlfe, qlfe, mu, u);
+    const double h1_serial = H1SemiError(dofh, tlfe, qlfe, mu, grad_u);
+    lf::base::DefaultNumThreads() = 4;
+    EXPECT_EQ(mu_serial, mu);
+    EXPECT_EQ(l2_serial, L2Error(dofh, tlfe, qlfe, mu, u));
+    EXPECT_EQ(h1_serial, H1SemiError(dofh, tlfe, qlfe, mu, grad_u));
+  }
+  EXPECT_NEAR(l2_errs[0] / l2_errs[1], 4.0, 0.1);
+  EXPECT_NEAR(h1_errs[0] / h1_errs[1], 2.0, 0.05);
+}
+
+TEST(lf_fe, fe_tools_compensated_sum) {
+  // Naive summation loses all small terms
+  std::vector<double> vals(1001, 1.0E-16);
+  vals[0] = 1.0;
+  EXPECT_DOUBLE_EQ(detail::CompensatedSum(vals), 1.0 + 1.0E-13);
+}
+
+}  // namespace lf::fe::test
@@ -0,0 +1,139 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Tests for the Lagrangian finite elements with compile-time sizes
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#include "lf/fe/fixed_lagr_fe.h"
+#include <gtest/gtest.h>
+#include <lf/mesh/utils/utils.h>
+#include "lf/fe/loc_comp_ellbvp.h"
+#include "lf/fe/quad_tensor_fe.h"
+#include "lf/mesh/test_utils/test_meshes.h"
+
+namespace lf::fe::test {
+
+// Cardinal basis property and consistency of gradients with values
+template <base::RefElType REF_EL, int DEGREE>
+void CheckFixedShapeFunctions() {
+  using rsf_t = FixedLagrangeShapeFunctions<REF_EL, DEGREE>;
+  const typename rsf_t::grads_t nodes{rsf_t::EvaluationNodes()};
+  for (int j = 0; j < rsf_t::kNumRefShapeFunctions; ++j) {
+    const typename rsf_t::vals_t vals{rsf_t::Eval(nodes.col(j))};
+    for (int i = 0; i < rsf_t::kNumRefShapeFunctions; ++i) {
+      EXPECT_NEAR(vals[i], (i == j) ? 1.0 : 0.0, 1.0E-14);
+    }
+  }
+  // Central difference quotients are exact for polynomials of degree 2
+  const Eigen::Vector2d x(0.3, 0.2);
+  const double h = 1.0E-3;
+  const typename rsf_t::grads_t grads{rsf_t::Gradients(x)};
+  for (int d = 0; d < 2; ++d) {
+    const Eigen::Vector2d e{Eigen::Vector2d::Unit(d)};
+    const typename rsf_t::vals_t dq{
+        (rsf_t::Eval(x + h * e) - rsf_t::Eval(x - h * e)) / (2.0 * h)};
+    EXPECT_LT((dq.transpose() - grads.row(d)).norm(), 1.0E-10);
+  }
+}
+
+TEST(lf_fe, fixed_lagr_fe_shape_functions) {
+  CheckFixedShapeFunctions<base::RefElType::kTria, 1>();
+  CheckFixedShapeFunctions<base::RefElType::kTria, 2>();
+  CheckFixedShapeFunctions<base::RefElType::kQuad, 1>();
+  CheckFixedShapeFunctions<base::RefElType::kQuad, 2>();
+}
+
+// Compare with the element matrices computed by the generic classes
+TEST(lf_fe, fixed_lagr_fe_element_matrix) {
+  auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh(0);
+  auto alpha = [](Eigen::Vector2d x) -> double { return 1.0 + x[0] * x[1]; };
+  auto gamma = [](Eigen::Vector2d x) -> double { return 2.0 + x[0]; };
+  using alpha_t = decltype(alpha);
+  using gamma_t = decltype(gamma);
+
+  const TriaLinearLagrangeFE<double> tlfe;
+  const QuadLinearLagrangeFE<double> qlfe;
+  LagrangeFEEllBVPElementMatrix<alpha_t, gamma_t> elmat_o1(tlfe, qlfe, alpha,
+                                                           gamma);
+  QuadTensorEllBVPElementMatrix<alpha_t, gamma_t> elmat_q2(2, alpha, gamma);
+
+  FixedLagrangeFEEllBVPElementMatrix<base::RefEl::kTria(), 1, 2, alpha_t,
+                                     gamma_t>
+      elmat_p1(alpha, gamma);
+  FixedLagrangeFEEllBVPElementMatrix<base::RefEl::kQuad(), 1, 2, alpha_t,
+                                     gamma_t>
+      elmat_fq1(alpha, gamma);
+  FixedLagrangeFEEllBVPElementMatrix<base::RefEl::kQuad(), 2, 4, alpha_t,
+                                     gamma_t>
+      elmat_fq2(alpha, gamma);
+
+  int no_trias = 0;
+  int no_quads = 0;
+  for (const lf::mesh::Entity &cell : mesh_p->Entities(0)) {
+    EXPECT_NE(elmat_p1.isActive(cell), elmat_fq1.isActive(cell));
+    if (cell.RefEl() == lf::base::RefEl::kTria()) {
+      const Eigen::MatrixXd ref{elmat_o1.Eval(cell)};
+      EXPECT_LT((elmat_p1.Eval(cell) - ref).norm(), 1.0E-13 * ref.norm());
+      ++no_trias;
+    } else {
+      const Eigen::MatrixXd ref1{elmat_o1.Eval(cell)};
+      EXPECT_LT((elmat_fq1.Eval(cell) - ref1).norm(), 1.0E-13 * ref1.norm());
+      const Eigen::MatrixXd ref2{elmat_q2.Eval(cell)};
+      EXPECT_LT((elmat_fq2.Eval(cell) - ref2).norm(), 1.0E-12 * ref2.norm());
+      ++no_quads;
+    }
+  }
+  EXPECT_GT(no_trias, 0);
+  EXPECT_GT(no_quads, 0);
+}
+
+// For quadratic Lagrangian finite elements on affine triangles the energy of
+// the interpolant of a quadratic polynomial is computed exactly
+TEST(lf_fe, fixed_lagr_fe_p2_energy) {
+  auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh(0);
+  auto one = [](Eigen::Vector2d /*x*/) -> double { return 1.0; };
+  using rsf_t = FixedLagrangeShapeFunctions<base::RefElType::kTria, 2>;
+  FixedLagrangeFEEllBVPElementMatrix<base::RefEl::kTria(), 2, 4,
+                                     decltype(one), decltype(one)>
+      elmat(one, one);
+  // u(x,y) = x^2 + x*y - y
+  auto u = [](const Eigen::Vector2d &x) -> double {
+    return x[0] * x[0] + x[0] * x[1] - x[1];
+  };
+  auto grad_u = [](const Eigen::Vector2d &x) -> Eigen::Vector2d {
+    return {2.0 * x[0] + x[1], x[0] - 1.0};
+  };
+  const lf::quad::QuadRule qr{
+      lf::quad::make_QuadRule(lf::base::RefEl::kTria(), 6)};
+  for (const lf::mesh::Entity &cell : mesh_p->Entities(0)) {
+    if (cell.RefEl() != lf::base::RefEl::kTria()) {
+      continue;
+    }
+    const lf::geometry::Geometry &geo{*cell.Geometry()};
+    const Eigen::MatrixXd nodes{
+        geo.Global(Eigen::MatrixXd(rsf_t::EvaluationNodes()))};
+    Eigen::Matrix<double, 6, 1> mu;
+    for (int i = 0; i < 6; ++i) {
+      mu[i] = u(nodes.col(i));
+    }
+    const Eigen::MatrixXd mapped{geo.Global(qr.Points())};
+    const Eigen::VectorXd dets{geo.IntegrationElement(qr.Points())};
+    double energy = 0.0;
+    for (int k = 0; k < qr.NumPoints(); ++k) {
+      energy += qr.Weights()[k] * dets[k] *
+                (grad_u(mapped.col(k)).squaredNorm() +
+                 u(mapped.col(k)) * u(mapped.col(k)));
+    }
+    EXPECT_NEAR(mu.dot(elmat.Eval(cell) * mu), energy, 1.0E-13);
+  }
+}
+
+}  // namespace lf::fe::test
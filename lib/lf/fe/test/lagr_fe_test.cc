@@ -16,6 +16,7 @@
 #include <gtest/gtest.h>
 #include <iostream>
 #include "lf/fe/loc_comp_ellbvp.h"
+#include "lf/fe/quad_tensor_fe.h"
 
 #include <lf/mesh/utils/utils.h>
 #include "lf/mesh/test_utils/test_meshes.h"
@@ -168,4 +169,44 @@ TEST(lf_fe, lf_fe_loadvec) {
   }
 }
 
+// Tabulate() must agree with EvalReferenceShapeFunctions() and
+// GradientsReferenceShapeFunctions()
+void CheckTabulation(const ScalarReferenceFiniteElement<double> &fe,
+                     const lf::quad::QuadRule &qr) {
+  const auto tab = fe.Tabulation(qr);
+  EXPECT_EQ(tab, fe.Tabulation(qr)) << "Tabulation not cached";
+  ASSERT_EQ(tab->NumRefShapeFunctions(), fe.NumRefShapeFunctions());
+  ASSERT_EQ(tab->NumPoints(), qr.NumPoints());
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(tab->Gradients().data()) %
+                std::max(EIGEN_MAX_ALIGN_BYTES, 1),
+            0);
+  const auto vals{fe.EvalReferenceShapeFunctions(qr.Points())};
+  const auto grads{fe.GradientsReferenceShapeFunctions(qr.Points())};
+  const size_type n = fe.NumRefShapeFunctions();
+  for (size_type i = 0; i < n; ++i) {
+    for (size_type k = 0; k < qr.NumPoints(); ++k) {
+      EXPECT_NEAR(tab->Values()(i, k), vals[i][k], 1.0E-14);
+      EXPECT_NEAR((tab->Gradients(k).col(i) - grads[i].col(k)).norm(), 0.0,
+                  1.0E-13);
+      EXPECT_EQ(tab->Gradients(k).col(i), tab->Gradients().col(i + n * k));
+    }
+  }
+}
+
+TEST(lf_fe, lf_fe_tabulation) {
+  CheckTabulation(TriaLinearLagrangeFE<double>(),
+                  lf::quad::make_QuadRule(lf::base::RefEl::kTria(), 4));
+  CheckTabulation(QuadLinearLagrangeFE<double>(),
+                  lf::quad::make_QuadRule(lf::base::RefEl::kQuad(), 3));
+  CheckTabulation(SegmentLinearLagrangeFE<double>(),
+                  lf::quad::make_QuadRule(lf::base::RefEl::kSegment(), 2));
+  CheckTabulation(QuadTensorLagrangeFE<double>(3),
+                  lf::quad::make_QuadRule(lf::base::RefEl::kQuad(), 6));
+  // Different quadrature rules yield different tabulations
+  const TriaLinearLagrangeFE<double> fe;
+  EXPECT_NE(
+      fe.Tabulation(lf::quad::make_QuadRule(lf::base::RefEl::kTria(), 2)),
+      fe.Tabulation(lf::quad::make_QuadRule(lf::base::RefEl::kTria(), 5)));
+}
+
 }  // end namespace lf::fe::test
@@ -0,0 +1,89 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Tests for the geometric multigrid solver
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#include "lf/fe/multigrid.h"
+#include <gtest/gtest.h>
+#include <lf/mesh/hybrid2d/hybrid2d.h>
+#include "lf/fe/loc_comp_ellbvp.h"
+#include "lf/mesh/test_utils/test_meshes.h"
+
+namespace lf::fe::test {
+
+// Solve -Delta u + u = f with natural boundary conditions by multigrid and
+// compare with a direct solver
+void CheckMultigrid(LinearFEMultigrid::Smoother smoother, bool galerkin,
+                    unsigned int max_its) {
+  auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh(0);
+  lf::refinement::MeshHierarchy mh(
+      mesh_p, std::make_shared<lf::mesh::hybrid2d::MeshFactory>(2));
+  for (int k = 0; k < 4; ++k) {
+    mh.RefineRegular();
+  }
+
+  TriaLinearLagrangeFE<double> tlfe{};
+  QuadLinearLagrangeFE<double> qlfe{};
+  auto alpha = [](Eigen::Vector2d /*x*/) -> double { return 1.0; };
+  auto gamma = [](Eigen::Vector2d /*x*/) -> double { return 1.0; };
+  auto f = [](Eigen::Vector2d x) -> double { return std::sin(x[0]) + x[1]; };
+  LagrangeFEEllBVPElementMatrix<decltype(alpha), decltype(gamma)>
+      elmat_builder(tlfe, qlfe, alpha, gamma);
+  LinearFELocalLoadVector<double, decltype(f)> elvec_builder(f);
+
+  const std::vector<Eigen::SparseMatrix<double>> level_matrices =
+      LinearFEMultigrid::AssembleLevelMatrices(mh, elmat_builder);
+  const Eigen::SparseMatrix<double> &A{level_matrices.back()};
+  const lf::assemble::UniformFEDofHandler dofh(
+      mh.getMesh(mh.NumLevels() - 1), {{lf::base::RefEl::kPoint(), 1}});
+  Eigen::VectorXd phi = Eigen::VectorXd::Zero(dofh.NoDofs());
+  lf::assemble::AssembleVectorLocally(0, dofh, elvec_builder, phi);
+
+  Eigen::SparseLU<Eigen::SparseMatrix<double>> solver;
+  solver.compute(A);
+  const Eigen::VectorXd u_direct = solver.solve(phi);
+
+  LinearFEMultigrid::Options options;
+  options.smoother = smoother;
+  const LinearFEMultigrid mg =
+      galerkin ? LinearFEMultigrid(mh, A, options)
+               : LinearFEMultigrid(mh, level_matrices, options);
+  ASSERT_EQ(mg.NumLevels(), 5);
+  for (size_type level = 0; level < mg.NumLevels(); ++level) {
+    // Galerkin products preserve symmetry
+    const Eigen::MatrixXd A_l(mg.LevelMatrix(level));
+    EXPECT_LT((A_l - A_l.transpose()).norm(), 1.0E-12 * A_l.norm());
+  }
+
+  Eigen::VectorXd u = Eigen::VectorXd::Zero(dofh.NoDofs());
+  const unsigned int no_its = mg.Solve(phi, u, 1.0E-10, 50);
+  EXPECT_LE(no_its, max_its) << "Multigrid convergence too slow";
+  EXPECT_LT((u - u_direct).norm(), 1.0E-8 * u_direct.norm());
+
+  // The V-cycle is a symmetric preconditioner
+  const Eigen::VectorXd r1 = Eigen::VectorXd::Random(dofh.NoDofs());
+  const Eigen::VectorXd r2 = Eigen::VectorXd::Random(dofh.NoDofs());
+  EXPECT_NEAR(r1.dot(mg.Apply(r2)), r2.dot(mg.Apply(r1)),
+              1.0E-10 * r1.norm() * mg.Apply(r2).norm());
+}
+
+TEST(lf_fe, multigrid_gauss_seidel) {
+  CheckMultigrid(LinearFEMultigrid::Smoother::kGaussSeidel, false, 20);
+  CheckMultigrid(LinearFEMultigrid::Smoother::kGaussSeidel, true, 20);
+}
+
+TEST(lf_fe, multigrid_jacobi) {
+  CheckMultigrid(LinearFEMultigrid::Smoother::kJacobi, false, 40);
+  CheckMultigrid(LinearFEMultigrid::Smoother::kJacobi, true, 40);
+}
+
+}  // namespace lf::fe::test
@@ -0,0 +1,92 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Tests for the transfer of linear finite element functions between
+ * levels of a mesh hierarchy
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#include "lf/fe/prolongation.h"
+#include <gtest/gtest.h>
+#include <lf/mesh/hybrid2d/hybrid2d.h>
+#include "lf/mesh/test_utils/test_meshes.h"
+
+namespace lf::fe::test {
+
+// Nodal interpolant of a linear function
+Eigen::VectorXd InterpolateLinear(const lf::assemble::DofHandler &dofh) {
+  auto f = [](const Eigen::VectorXd &x) { return 1.0 + 2.0 * x[0] - x[1]; };
+  Eigen::VectorXd u(dofh.NoDofs());
+  for (const lf::mesh::Entity &node : dofh.Mesh()->Entities(2)) {
+    u[dofh.InteriorGlobalDofIndices(node)[0]] =
+        f(node.Geometry()->Global(Eigen::MatrixXd(0, 1)).col(0));
+  }
+  return u;
+}
+
+// Prolongation of linear functions must be exact on all levels
+void CheckTransfer(lf::refinement::MeshHierarchy &mh) {
+  const lf::assemble::UniformFEDofHandler::dof_map_t dofmap{
+      {lf::base::RefEl::kPoint(), 1}};
+  for (size_type level = 0; level + 1 < mh.NumLevels(); ++level) {
+    const lf::assemble::UniformFEDofHandler coarse_dofh(mh.getMesh(level),
+                                                        dofmap);
+    const lf::assemble::UniformFEDofHandler fine_dofh(mh.getMesh(level + 1),
+                                                      dofmap);
+    const LinearFELevelTransfer transfer(mh, level, coarse_dofh, fine_dofh);
+    ASSERT_EQ(transfer.NoCoarseDofs(), coarse_dofh.NoDofs());
+    ASSERT_EQ(transfer.NoFineDofs(), fine_dofh.NoDofs());
+    EXPECT_GT(fine_dofh.NoDofs(), coarse_dofh.NoDofs());
+
+    const Eigen::VectorXd u_coarse = InterpolateLinear(coarse_dofh);
+    const Eigen::VectorXd u_fine = transfer.Prolongate(u_coarse);
+    EXPECT_LT((u_fine - InterpolateLinear(fine_dofh)).norm(),
+              1.0E-10 * u_fine.norm());
+
+    // Matrix-free and matrix based transfer must agree
+    const Eigen::SparseMatrix<double> P = transfer.ProlongationMatrix();
+    EXPECT_LT((P * u_coarse - u_fine).norm(), 1.0E-12 * u_fine.norm());
+    const Eigen::VectorXd r_fine = Eigen::VectorXd::Random(P.rows());
+    const Eigen::VectorXd r_coarse = transfer.Restrict(r_fine);
+    EXPECT_LT((transfer.RestrictionMatrix() * r_fine - r_coarse).norm(),
+              1.0E-12 * r_coarse.norm());
+    // Constants are preserved
+    const Eigen::VectorXd ones = P * Eigen::VectorXd::Ones(P.cols());
+    EXPECT_LT((ones - Eigen::VectorXd::Ones(P.rows())).norm(), 1.0E-12);
+  }
+}
+
+TEST(lf_fe, prolongation_regular) {
+  auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh(0);
+  lf::refinement::MeshHierarchy mh(
+      mesh_p, std::make_shared<lf::mesh::hybrid2d::MeshFactory>(2));
+  mh.RefineRegular();
+  mh.RefineRegular();
+  CheckTransfer(mh);
+}
+
+TEST(lf_fe, prolongation_local) {
+  auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh(1);
+  lf::refinement::MeshHierarchy mh(
+      mesh_p, std::make_shared<lf::mesh::hybrid2d::MeshFactory>(2));
+  for (int step = 0; step < 3; ++step) {
+    // Refine edges close to the origin
+    mh.MarkEdges([](const lf::mesh::Mesh & /*mesh*/,
+                    const lf::mesh::Entity &edge) -> bool {
+      const Eigen::MatrixXd mp = edge.Geometry()->Global(
+          (Eigen::MatrixXd(1, 1) << 0.5).finished());
+      return mp.norm() < 1.5;
+    });
+    mh.RefineMarked();
+  }
+  CheckTransfer(mh);
+}
+
+}  // namespace lf::fe::test
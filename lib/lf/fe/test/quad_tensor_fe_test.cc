@@ -0,0 +1,150 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Tests for tensor product Lagrange finite elements on quadrilaterals
+ * and their sum-factorization kernels
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#include "lf/fe/quad_tensor_fe.h"
+#include <gtest/gtest.h>
+#include <lf/mesh/hybrid2d/hybrid2d.h>
+#include <lf/mesh/utils/utils.h>
+#include "lf/mesh/test_utils/test_meshes.h"
+
+namespace lf::fe::test {
+
+TEST(lf_fe, quad_tensor_fe_shape_functions) {
+  for (unsigned int p = 1; p <= 6; ++p) {
+    const QuadTensorLagrangeFE<double> fe(p);
+    ASSERT_EQ(fe.NumRefShapeFunctions(), (p + 1) * (p + 1));
+    // Cardinal basis w.r.t. the evaluation nodes
+    const Eigen::MatrixXd nodes{fe.EvaluationNodes()};
+    const auto vals{fe.EvalReferenceShapeFunctions(nodes)};
+    for (size_type i = 0; i < fe.NumRefShapeFunctions(); ++i) {
+      for (size_type j = 0; j < fe.NumEvaluationNodes(); ++j) {
+        EXPECT_NEAR(vals[i][j], (i == j) ? 1.0 : 0.0, 1.0E-12);
+      }
+    }
+    // The first four nodes are the vertices
+    EXPECT_TRUE(nodes.leftCols(4).isApprox(
+        lf::base::RefEl::kQuad().NodeCoords(), 1.0E-14));
+    // Partition of unity: gradients sum up to zero
+    const Eigen::MatrixXd pts{Eigen::MatrixXd::Random(2, 5).array().abs()};
+    const auto grads{fe.GradientsReferenceShapeFunctions(pts)};
+    Eigen::MatrixXd sum{Eigen::MatrixXd::Zero(2, 5)};
+    for (const auto &g : grads) {
+      sum += g;
+    }
+    EXPECT_LT(sum.norm(), 1.0E-10);
+  }
+}
+
+// Compare with the element matrix computed by evaluating all shape functions
+// in all quadrature points
+TEST(lf_fe, quad_tensor_fe_element_matrix) {
+  auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh(0);
+  auto alpha = [](Eigen::Vector2d x) -> double { return 1.0 + x[0] * x[1]; };
+  auto gamma = [](Eigen::Vector2d x) -> double { return 2.0 + x[0]; };
+  for (unsigned int p = 1; p <= 4; ++p) {
+    const QuadTensorLagrangeFE<double> fe(p);
+    QuadTensorEllBVPElementMatrix<decltype(alpha), decltype(gamma)> elmat(
+        p, alpha, gamma);
+    const lf::quad::QuadRule qr{
+        lf::quad::make_QuadRule(lf::base::RefEl::kQuad(), 2 * p)};
+    const auto vals{fe.EvalReferenceShapeFunctions(qr.Points())};
+    const auto grads{fe.GradientsReferenceShapeFunctions(qr.Points())};
+    for (const lf::mesh::Entity &cell : mesh_p->Entities(0)) {
+      if (cell.RefEl() != lf::base::RefEl::kQuad()) {
+        continue;
+      }
+      const lf::geometry::Geometry &geo{*cell.Geometry()};
+      const Eigen::MatrixXd mapped{geo.Global(qr.Points())};
+      const Eigen::VectorXd dets{geo.IntegrationElement(qr.Points())};
+      const Eigen::MatrixXd JinvT{geo.JacobianInverseGramian(qr.Points())};
+      const size_type N = fe.NumRefShapeFunctions();
+      Eigen::MatrixXd ref{Eigen::MatrixXd::Zero(N, N)};
+      for (int k = 0; k < qr.NumPoints(); ++k) {
+        const double w = qr.Weights()[k] * dets[k];
+        for (size_type i = 0; i < N; ++i) {
+          for (size_type j = 0; j < N; ++j) {
+            ref(i, j) +=
+                w * (alpha(mapped.col(k)) *
+                         (JinvT.block(0, 2 * k, 2, 2) * grads[i].col(k))
+                             .dot(JinvT.block(0, 2 * k, 2, 2) *
+                                  grads[j].col(k)) +
+                     gamma(mapped.col(k)) * vals[i][k] * vals[j][k]);
+          }
+        }
+      }
+      EXPECT_LT((elmat.Eval(cell) - ref).norm(), 1.0E-12 * ref.norm())
+          << "p = " << p;
+    }
+  }
+}
+
+TEST(lf_fe, quad_tensor_fe_operator) {
+  lf::mesh::hybrid2d::TPQuadMeshBuilder builder(
+      std::make_shared<lf::mesh::hybrid2d::MeshFactory>(2));
+  builder.setBottomLeftCorner(Eigen::Vector2d{0.0, 0.0})
+      .setTopRightCorner(Eigen::Vector2d{1.0, 1.0})
+      .setNoXCells(4)
+      .setNoYCells(3);
+  auto mesh_p = builder.Build();
+  auto one = [](Eigen::Vector2d /*x*/) -> double { return 1.0; };
+  for (unsigned int p = 1; p <= 6; ++p) {
+    const lf::assemble::UniformFEDofHandler dofh(
+        mesh_p, {{lf::base::RefEl::kPoint(), 1},
+                 {lf::base::RefEl::kSegment(), p - 1},
+                 {lf::base::RefEl::kTria(), 0},
+                 {lf::base::RefEl::kQuad(), (p - 1) * (p - 1)}});
+    const size_type N = dofh.NoDofs();
+    // Interpolate u(x,y) = x^p y^p; dofs shared by several cells must
+    // receive the same value from all of them
+    const QuadTensorLagrangeFE<double> fe(p);
+    Eigen::VectorXd u{Eigen::VectorXd::Constant(N, -1.0)};
+    for (const lf::mesh::Entity &cell : mesh_p->Entities(0)) {
+      const Eigen::MatrixXd nodes{
+          cell.Geometry()->Global(fe.EvaluationNodes())};
+      lf::base::RandomAccessRange<const gdof_idx_t> idx(
+          dofh.GlobalDofIndices(cell));
+      for (int k = 0; k < nodes.cols(); ++k) {
+        const double val = std::pow(nodes(0, k) * nodes(1, k), p);
+        if (u[idx[k]] >= 0.0) {
+          EXPECT_NEAR(u[idx[k]], val, 1.0E-14);
+        }
+        u[idx[k]] = val;
+      }
+    }
+    ASSERT_GE(u.minCoeff(), 0.0);
+
+    const QuadTensorEllBVPOperator<decltype(one), decltype(one)> op(dofh, p,
+                                                                    one, one);
+    Eigen::VectorXd y;
+    op.Apply(u, y);
+    // The quadrature is exact for u in Q_p on rectangles
+    const double exact = 1.0 / ((2.0 * p + 1) * (2.0 * p + 1)) +
+                         2.0 * p * p / ((2.0 * p - 1) * (2.0 * p + 1));
+    EXPECT_NEAR(u.dot(y), exact, 1.0E-11 * exact) << "p = " << p;
+
+    // Compare with the assembled matrix
+    QuadTensorEllBVPElementMatrix<decltype(one), decltype(one)> elmat(p, one,
+                                                                      one);
+    const Eigen::MatrixXd A{
+        lf::assemble::AssembleMatrixLocally<lf::assemble::COOMatrix<double>>(
+            0, dofh, elmat)
+            .makeDense()};
+    const Eigen::VectorXd v{Eigen::VectorXd::Random(N)};
+    op.Apply(v, y);
+    EXPECT_LT((A * v - y).norm(), 1.0E-12 * y.norm()) << "p = " << p;
+  }
+}
+
+}  // namespace lf::fe::test
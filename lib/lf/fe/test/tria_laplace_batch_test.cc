@@ -0,0 +1,69 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Tests for the batched assembly of the Laplacian for linear finite
+ * elements
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#include "lf/fe/tria_laplace_batch.h"
+#include <gtest/gtest.h>
+#include <lf/mesh/hybrid2d/hybrid2d.h>
+#include <lf/mesh/utils/utils.h>
+#include "lf/mesh/test_utils/test_meshes.h"
+
+namespace lf::fe::test {
+
+// Compare with cell-by-cell assembly
+void CheckBatchedLaplacian(
+    const std::shared_ptr<const lf::mesh::Mesh> &mesh_p) {
+  const lf::assemble::UniformFEDofHandler dofh(
+      mesh_p, {{lf::base::RefEl::kPoint(), 1}});
+  const size_type N = dofh.NoDofs();
+  LinearFELaplaceElementMatrix elmat_builder;
+  const Eigen::MatrixXd A_ref =
+      lf::assemble::AssembleMatrixLocally<lf::assemble::COOMatrix<double>>(
+          0, dofh, elmat_builder)
+          .makeDense();
+  lf::assemble::COOMatrix<double> A(N, N);
+  AssembleLinearFELaplaceMatrix(dofh, A);
+  EXPECT_LT((A.makeDense() - A_ref).norm(), 1.0E-12 * A_ref.norm());
+}
+
+TEST(lf_fe, tria_laplace_batch_hybrid) {
+  // Mesh with triangles and quadrilaterals
+  CheckBatchedLaplacian(lf::mesh::test_utils::GenerateHybrid2DTestMesh(0));
+}
+
+TEST(lf_fe, tria_laplace_batch_tp) {
+  // Number of triangles not a multiple of the batch size
+  lf::mesh::hybrid2d::TPTriagMeshBuilder builder(
+      std::make_shared<lf::mesh::hybrid2d::MeshFactory>(2));
+  builder.setBottomLeftCorner(Eigen::Vector2d{0.0, 0.0})
+      .setTopRightCorner(Eigen::Vector2d{2.0, 1.0})
+      .setNoXCells(7)
+      .setNoYCells(5);
+  CheckBatchedLaplacian(builder.Build());
+}
+
+TEST(lf_fe, tria_laplace_batch_kernel) {
+  // Rows of an element matrix sum up to zero, diagonal entries are positive
+  TriaBatchVertices vertices;
+  for (TriaBatchArray &v : vertices) {
+    v = TriaBatchArray::Random();
+  }
+  TriaBatchElemMats elem_mats;
+  LinearFELaplaceTriaBatch(vertices, elem_mats);
+  const TriaBatchArray row_sum = elem_mats[0] + elem_mats[1] + elem_mats[2];
+  EXPECT_LT(row_sum.abs().maxCoeff(), 1.0E-10 * elem_mats[0].maxCoeff());
+  EXPECT_GT(elem_mats[3].minCoeff(), 0.0);
+}
+
+}  // namespace lf::fe::test
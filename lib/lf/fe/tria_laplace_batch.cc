@@ -0,0 +1,83 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Batched computation of element matrices for the Laplacian on
+ * affine triangles
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#include "tria_laplace_batch.h"
+
+namespace lf::fe {
+
+void LinearFELaplaceTriaBatch(const TriaBatchVertices &vertices,
+                              TriaBatchElemMats &elem_mats) {
+  const TriaBatchArray &x0{vertices[0]};
+  const TriaBatchArray &y0{vertices[1]};
+  const TriaBatchArray &x1{vertices[2]};
+  const TriaBatchArray &y1{vertices[3]};
+  const TriaBatchArray &x2{vertices[4]};
+  const TriaBatchArray &y2{vertices[5]};
+  // Edge vectors opposite to the vertices
+  const TriaBatchArray ex0 = x2 - x1;
+  const TriaBatchArray ey0 = y2 - y1;
+  const TriaBatchArray ex1 = x0 - x2;
+  const TriaBatchArray ey1 = y0 - y2;
+  const TriaBatchArray ex2 = x1 - x0;
+  const TriaBatchArray ey2 = y1 - y0;
+  // 1/(4|K|) = 1/(2|det|), det = determinant of the Jacobian
+  const TriaBatchArray scale = 0.5 / (ex2 * (-ey1) - ey2 * (-ex1)).abs();
+  elem_mats[0] = scale * (ex0 * ex0 + ey0 * ey0);
+  elem_mats[1] = scale * (ex0 * ex1 + ey0 * ey1);
+  elem_mats[2] = scale * (ex0 * ex2 + ey0 * ey2);
+  elem_mats[3] = scale * (ex1 * ex1 + ey1 * ey1);
+  elem_mats[4] = scale * (ex1 * ex2 + ey1 * ey2);
+  elem_mats[5] = scale * (ex2 * ex2 + ey2 * ey2);
+}
+
+std::vector<TriaBatchElemMats> LinearFELaplaceTriaElementMatrices(
+    const lf::mesh::Mesh &mesh,
+    const std::vector<const lf::mesh::Entity *> &cells) {
+  LF_ASSERT_MSG(mesh.DimWorld() == 2, "Only 2D implementation available!");
+  // Table of node positions, avoids evaluating cell geometries
+  Eigen::Matrix2Xd node_coords(2, mesh.Size(2));
+  const Eigen::MatrixXd origin(0, 1);
+  for (const lf::mesh::Entity &node : mesh.Entities(2)) {
+    node_coords.col(mesh.Index(node)) = node.Geometry()->Global(origin);
+  }
+  const std::size_t num_batches =
+      (cells.size() + kTriaBatchSize - 1) / kTriaBatchSize;
+  std::vector<TriaBatchElemMats> elem_mats(num_batches);
+  lf::base::ParallelFor(
+      num_batches,
+      [&](std::size_t first, std::size_t last) {
+        TriaBatchVertices vertices;
+        for (std::size_t batch = first; batch < last; ++batch) {
+          // Gather vertex coordinates into SoA layout
+          for (int lane = 0; lane < kTriaBatchSize; ++lane) {
+            const std::size_t k = std::min<std::size_t>(
+                batch * kTriaBatchSize + lane, cells.size() - 1);
+            LF_ASSERT_MSG(cells[k]->RefEl() == lf::base::RefEl::kTria(),
+                          "Only triangles can be processed");
+            auto nodes = cells[k]->SubEntities(2);
+            for (int i = 0; i < 3; ++i) {
+              const auto node_idx = mesh.Index(nodes[i]);
+              vertices[2 * i][lane] = node_coords(0, node_idx);
+              vertices[2 * i + 1][lane] = node_coords(1, node_idx);
+            }
+          }
+          LinearFELaplaceTriaBatch(vertices, elem_mats[batch]);
+        }
+      },
+      64);
+  return elem_mats;
+}
+
+}  // namespace lf::fe
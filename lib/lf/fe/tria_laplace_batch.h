@@ -0,0 +1,145 @@
+#ifndef LF_FE_TRIA_LAPLACE_BATCH
+#define LF_FE_TRIA_LAPLACE_BATCH
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Element matrices of the Laplacian for linear finite elements,
+ * computed for batches of affine triangles at once
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#include <lf/assemble/assemble.h>
+#include <array>
+#include <vector>
+#include "loc_comp_ellbvp.h"
+
+namespace lf::fe {
+
+/** @brief Number of triangles processed simultaneously by
+ * LinearFELaplaceTriaBatch() */
+constexpr int kTriaBatchSize = 8;
+
+/** @brief One value per triangle of a batch */
+using TriaBatchArray = Eigen::Array<double, kTriaBatchSize, 1>;
+
+/**
+ * @brief Vertex coordinates of a batch of triangles in "structure of arrays"
+ * layout: entry `2*i+d` holds coordinate `d` of vertex `i` of all triangles.
+ */
+using TriaBatchVertices = std::array<TriaBatchArray, 6>;
+
+/**
+ * @brief Element matrices of a batch of triangles in "structure of arrays"
+ * layout: the entries (0,0), (0,1), (0,2), (1,1), (1,2), (2,2) of the
+ * symmetric 3x3 element matrices, in this order.
+ */
+using TriaBatchElemMats = std::array<TriaBatchArray, 6>;
+
+/**
+ * @brief Element matrices of the Laplacian for linear finite elements on a
+ * batch of affine triangles
+ *
+ * @param vertices corner coordinates of the triangles
+ * @param elem_mats upper triangles of the element matrices
+ *
+ * With the edge vectors \f$ \mathbf{e}_i \f$ opposite to the vertices, the
+ * element matrix of a triangle \f$ K \f$ is
+ * \f$ \frac{1}{4|K|}\mathbf{e}_i\cdot\mathbf{e}_j \f$. The computations for
+ * all triangles of a batch are carried out by array operations without
+ * branches, which Eigen maps onto SIMD instructions (SSE2, AVX, AVX-512)
+ * as enabled by the compiler flags, and onto scalar code otherwise.
+ */
+void LinearFELaplaceTriaBatch(const TriaBatchVertices &vertices,
+                              TriaBatchElemMats &elem_mats);
+
+/**
+ * @brief Element matrices of the Laplacian for linear finite elements on
+ * many triangles of a planar mesh
+ *
+ * @param mesh underlying mesh with `DimWorld() == 2`
+ * @param cells triangular cells of `mesh` with affine geometry
+ * @return element matrices in batches of kTriaBatchSize, the element matrix
+ * of `cells[k]` belongs to lane `k % kTriaBatchSize` of batch
+ * `k / kTriaBatchSize`.
+ *
+ * The vertex coordinates are gathered from a table of node positions and the
+ * batches are processed in parallel, see lf::base::ParallelFor(). Unused
+ * lanes of the last batch contain copies of the last triangle.
+ */
+std::vector<TriaBatchElemMats> LinearFELaplaceTriaElementMatrices(
+    const lf::mesh::Mesh &mesh,
+    const std::vector<const lf::mesh::Entity *> &cells);
+
+/**
+ * @brief Assembly of the Galerkin matrix of the Laplacian for linear finite
+ * elements on a hybrid planar mesh
+ *
+ * @tparam TMPMATRIX matrix type as for lf::assemble::AssembleMatrixLocally()
+ * @param dofh dof handler with one dof per node
+ * @param matrix matrix to which the element matrices are added
+ *
+ * Computes the same matrix as lf::assemble::AssembleMatrixLocally() with a
+ * LinearFELaplaceElementMatrix, but the element matrices of affine triangles
+ * are obtained from the batched kernel LinearFELaplaceTriaBatch(). All other
+ * cells are handled by LinearFELaplaceElementMatrix::Eval(). Contributions
+ * of the triangles are added first.
+ */
+template <typename TMPMATRIX>
+void AssembleLinearFELaplaceMatrix(const lf::assemble::DofHandler &dofh,
+                                   TMPMATRIX &matrix) {
+  const lf::mesh::Mesh &mesh{*dofh.Mesh()};
+  LF_ASSERT_MSG(mesh.DimWorld() == 2, "Only 2D implementation available!");
+  // Split cells into affine triangles and others
+  std::vector<const lf::mesh::Entity *> trias;
+  std::vector<const lf::mesh::Entity *> others;
+  for (const lf::mesh::Entity &cell : mesh.Entities(0)) {
+    LF_ASSERT_MSG(dofh.NoLocalDofs(cell) == cell.RefEl().NumNodes(),
+                  "Exactly one dof per node required");
+    if ((cell.RefEl() == lf::base::RefEl::kTria()) &&
+        cell.Geometry()->isAffine()) {
+      trias.push_back(&cell);
+    } else {
+      others.push_back(&cell);
+    }
+  }
+  const std::vector<TriaBatchElemMats> elem_mats =
+      LinearFELaplaceTriaElementMatrices(mesh, trias);
+  // Entries of the upper triangle, see TriaBatchElemMats
+  const std::array<std::array<int, 3>, 3> kEntry{
+      {{0, 1, 2}, {1, 3, 4}, {2, 4, 5}}};
+  for (std::size_t k = 0; k < trias.size(); ++k) {
+    const TriaBatchElemMats &batch{elem_mats[k / kTriaBatchSize]};
+    const int lane = k % kTriaBatchSize;
+    lf::base::RandomAccessRange<const lf::assemble::gdof_idx_t> idx(
+        dofh.GlobalDofIndices(*trias[k]));
+    for (int i = 0; i < 3; ++i) {
+      for (int j = 0; j < 3; ++j) {
+        matrix.AddToEntry(idx[i], idx[j], batch[kEntry[i][j]][lane]);
+      }
+    }
+  }
+  LinearFELaplaceElementMatrix elmat_builder;
+  for (const lf::mesh::Entity *cell : others) {
+    const LinearFELaplaceElementMatrix::ElemMat elem_mat(
+        elmat_builder.Eval(*cell));
+    lf::base::RandomAccessRange<const lf::assemble::gdof_idx_t> idx(
+        dofh.GlobalDofIndices(*cell));
+    const int n = cell->RefEl().NumNodes();
+    for (int i = 0; i < n; ++i) {
+      for (int j = 0; j < n; ++j) {
+        matrix.AddToEntry(idx[i], idx[j], elem_mat(i, j));
+      }
+    }
+  }
+}
+
+}  // namespace lf::fe
+
+#endif
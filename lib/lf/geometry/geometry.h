@@ -9,6 +9,7 @@
 #ifndef __02a3dfa9ae3a4969b29d4c0ecfaa6ad9
 #define __02a3dfa9ae3a4969b29d4c0ecfaa6ad9
 
+#include "geometry_arena.h"
 #include "geometry_interface.h"
 #include "point.h"
 #include "quad_o1.h"
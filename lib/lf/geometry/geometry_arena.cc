@@ -0,0 +1,229 @@
+/**
+ * @file
+ * @brief Implementation of the bump allocator for Geometry objects
+ * @author agent
+ * @date   2026-10-19
+ * @copyright MIT License
+ */
+
+#include "geometry_arena.h"
+#include <algorithm>
+#include <cstdint>
+#include <new>
+
+namespace lf::geometry {
+
+namespace {
+// Every allocation is preceded by a pointer to the owning arena. Memory from
+// the heap reserves kHeaderSize bytes for it, which preserves the alignment.
+constexpr std::size_t kAlignment = alignof(std::max_align_t);
+constexpr std::size_t kHeaderSize =
+    ((sizeof(GeometryArena*) + kAlignment - 1) / kAlignment) * kAlignment;
+
+std::size_t RoundUp(std::size_t size, std::size_t alignment) {
+  return ((size + alignment - 1) / alignment) * alignment;
+}
+
+// Upper bound for the bytes consumed by BumpAllocate()
+std::size_t MaxBytes(std::size_t size, std::size_t alignment) {
+  return sizeof(GeometryArena*) + alignment + RoundUp(size, kAlignment);
+}
+
+// Bytes in front of an object allocated from the heap
+std::size_t HeapOffset(std::size_t alignment) {
+  return std::max(alignment, kHeaderSize);
+}
+
+// Arena installed for the current thread and the part of one of its blocks
+// that is reserved for the thread
+struct ThreadState {
+  GeometryArena* arena{nullptr};
+  char* free_begin{nullptr};
+  char* free_end{nullptr};
+};
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local ThreadState thread_state;
+
+GeometryArena*& Header(void* ptr) {
+  return *reinterpret_cast<GeometryArena**>(static_cast<char*>(ptr) -
+                                            sizeof(GeometryArena*));
+}
+
+// Place an object with its header at the beginning of [free_begin,free_end)
+// and advance free_begin, returns nullptr if the range is too small.
+char* BumpAllocate(std::size_t size, std::size_t alignment, char*& free_begin,
+                   char* free_end) {
+  if (free_begin == nullptr) {
+    return nullptr;
+  }
+  const auto begin = reinterpret_cast<std::uintptr_t>(free_begin);
+  const std::uintptr_t obj =
+      RoundUp(begin + sizeof(GeometryArena*), alignment);
+  const std::size_t num_bytes = (obj - begin) + RoundUp(size, kAlignment);
+  if (num_bytes > static_cast<std::size_t>(free_end - free_begin)) {
+    return nullptr;
+  }
+  char* ptr = free_begin + (obj - begin);
+  free_begin += num_bytes;
+  return ptr;
+}
+}  // namespace
+
+std::shared_ptr<GeometryArena> GeometryArena::Create(std::size_t block_size) {
+  LF_VERIFY_MSG(block_size > kHeaderSize,
+                "Block size " << block_size << " too small");
+  return std::shared_ptr<GeometryArena>(
+      new GeometryArena(block_size),
+      [](GeometryArena* arena) { arena->Release(); });
+}
+
+GeometryArena::GeometryArena(std::size_t block_size)
+    : block_size_(block_size) {}
+
+GeometryArena::Scope::Scope(GeometryArena* arena)
+    : previous_arena_(thread_state.arena),
+      previous_free_begin_(thread_state.free_begin),
+      previous_free_end_(thread_state.free_end),
+      nested_(arena == thread_state.arena) {
+  // A nested scope for the same arena continues in the range of the
+  // enclosing one
+  if (!nested_) {
+    thread_state = {arena, nullptr, nullptr};
+  }
+}
+
+GeometryArena::Scope::~Scope() {
+  if (nested_) {
+    return;
+  }
+  if (thread_state.arena != nullptr) {
+    thread_state.arena->ReturnRange(thread_state.free_begin,
+                                    thread_state.free_end);
+  }
+  thread_state = {previous_arena_, previous_free_begin_, previous_free_end_};
+}
+
+GeometryArena* GeometryArena::Current() { return thread_state.arena; }
+
+const GeometryArena* GeometryArena::Owner(const void* ptr) {
+  return Header(const_cast<void*>(ptr));
+}
+
+void* GeometryArena::Allocate(std::size_t size, GeometryArena* arena,
+                              std::size_t alignment) {
+  alignment = std::max(alignment, kAlignment);
+  void* ptr;
+  if (arena != nullptr) {
+    ptr = arena->AllocateInArena(size, alignment);
+  } else if (alignment > kAlignment) {
+    ptr = static_cast<char*>(::operator new(size + HeapOffset(alignment),
+                                            std::align_val_t(alignment))) +
+          HeapOffset(alignment);
+  } else {
+    ptr = static_cast<char*>(::operator new(size + kHeaderSize)) + kHeaderSize;
+  }
+  Header(ptr) = arena;
+  return ptr;
+}
+
+void GeometryArena::Deallocate(void* ptr, std::size_t alignment) noexcept {
+  if (ptr == nullptr) {
+    return;
+  }
+  alignment = std::max(alignment, kAlignment);
+  GeometryArena* arena = Header(ptr);
+  if (arena != nullptr) {
+    arena->num_objects_.fetch_sub(1, std::memory_order_relaxed);
+    arena->Release();
+  } else if (alignment > kAlignment) {
+    ::operator delete(static_cast<char*>(ptr) - HeapOffset(alignment),
+                      std::align_val_t(alignment));
+  } else {
+    ::operator delete(static_cast<char*>(ptr) - kHeaderSize);
+  }
+}
+
+void* GeometryArena::AllocateInArena(std::size_t size, std::size_t alignment) {
+  char* ptr;
+  if (thread_state.arena == this) {
+    // Fast path: the range reserved for this thread needs no locking
+    ptr = BumpAllocate(size, alignment, thread_state.free_begin,
+                       thread_state.free_end);
+    if (ptr == nullptr) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ptr = AllocateLocked(size, alignment, thread_state.free_begin,
+                           thread_state.free_end);
+    }
+  } else {
+    // The arena is not installed on this thread, e.g. for an explicit call
+    // of Allocate(): use the range shared by all such calls
+    std::lock_guard<std::mutex> lock(mutex_);
+    ptr = BumpAllocate(size, alignment, free_begin_, free_end_);
+    if (ptr == nullptr) {
+      ptr = AllocateLocked(size, alignment, free_begin_, free_end_);
+    }
+  }
+  num_objects_.fetch_add(1, std::memory_order_relaxed);
+  num_refs_.fetch_add(1, std::memory_order_relaxed);
+  return ptr;
+}
+
+char* GeometryArena::AllocateLocked(std::size_t size, std::size_t alignment,
+                                    char*& free_begin, char*& free_end) {
+  const std::size_t num_bytes = MaxBytes(size, alignment);
+  if (num_bytes > block_size_) {
+    // Oversized object: dedicated block, keep filling the current range
+    blocks_.emplace_back(new char[num_bytes]);
+    num_bytes_ += num_bytes;
+    char* block_begin = blocks_.back().get();
+    return BumpAllocate(size, alignment, block_begin, block_begin + num_bytes);
+  }
+  // Continue in a range left over by a closed scope, or in a new block. The
+  // rest of the current range is smaller than the object and is dropped.
+  auto range = std::find_if(
+      free_ranges_.begin(), free_ranges_.end(),
+      [num_bytes](const std::pair<char*, char*>& r) {
+        return static_cast<std::size_t>(r.second - r.first) >= num_bytes;
+      });
+  if (range != free_ranges_.end()) {
+    free_begin = range->first;
+    free_end = range->second;
+    free_ranges_.erase(range);
+  } else {
+    blocks_.emplace_back(new char[block_size_]);
+    free_begin = blocks_.back().get();
+    free_end = free_begin + block_size_;
+    num_bytes_ += block_size_;
+  }
+  return BumpAllocate(size, alignment, free_begin, free_end);
+}
+
+void GeometryArena::ReturnRange(char* free_begin, char* free_end) noexcept {
+  // Small remainders are not worth keeping
+  if (static_cast<std::size_t>(free_end - free_begin) < block_size_ / 8) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  try {
+    free_ranges_.emplace_back(free_begin, free_end);
+  } catch (...) {
+    // Losing the range only wastes memory
+  }
+}
+
+void GeometryArena::Release() noexcept {
+  if (num_refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    delete this;
+  }
+}
+
+base::size_type GeometryArena::NumObjects() const {
+  return num_objects_.load(std::memory_order_relaxed);
+}
+
+std::size_t GeometryArena::NumBytes() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return num_bytes_;
+}
+
+}  // namespace lf::geometry
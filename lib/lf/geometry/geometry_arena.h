@@ -0,0 +1,164 @@
+/**
+ * @file
+ * @brief Bump allocator for the Geometry objects belonging to one mesh
+ * @author agent
+ * @date   2026-10-19
+ * @copyright MIT License
+ */
+
+#ifndef __5b2c8e0d9f3a4c7e8b1d6a4f2e9c0b7d
+#define __5b2c8e0d9f3a4c7e8b1d6a4f2e9c0b7d
+
+#include <lf/base/base.h>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace lf::geometry {
+
+/**
+ * @brief Memory region from which Geometry objects are allocated
+ *
+ * A mesh owns one Geometry object per entity, typically hundreds of thousands
+ * of small objects. Allocating them one by one from the heap fragments memory
+ * and makes the destruction of a mesh expensive. A `GeometryArena` hands out
+ * memory from large blocks instead, by simply advancing a pointer.
+ *
+ * Geometry objects are not allocated from an arena explicitly: every
+ * `new`-expression for a class derived from Geometry, e.g. inside
+ * `std::make_unique`, consults the arena installed for the current thread
+ * by a GeometryArena::Scope object. Without such a scope the memory comes
+ * from the heap as usual. Hence all interfaces keep passing
+ * `std::unique_ptr<Geometry>` around and geometries allocated in different
+ * ways can be mixed freely.
+ *
+ * Deleting an object that lives in an arena does not release any memory.
+ * The blocks of the arena are freed in one go, as soon as the arena has been
+ * released by its owner (the last `std::shared_ptr` returned by Create())
+ * _and_ all objects allocated from it have been deleted. Thus an object
+ * never outlives its memory, even if it is handed out of the mesh.
+ *
+ * Allocation is thread-safe, so that the same arena may be used in a scope
+ * on several threads at the same time. Every Scope reserves a range of a
+ * block for its thread and allocates from it without synchronization; the
+ * arena is locked only when a thread needs a new range. The unused part of
+ * the range is handed back to the arena when the scope is closed.
+ *
+ * Used by lf::mesh::hybrid2d::MeshFactory, which allocates all geometries of
+ * the mesh under construction from an arena of its own, see
+ * lf::mesh::MeshFactory::Arena().
+ */
+class GeometryArena {
+ public:
+  GeometryArena(const GeometryArena&) = delete;
+  GeometryArena(GeometryArena&&) = delete;
+  GeometryArena& operator=(const GeometryArena&) = delete;
+  GeometryArena& operator=(GeometryArena&&) = delete;
+
+  /** @brief Default size in bytes of the memory blocks of an arena */
+  static constexpr std::size_t kDefaultBlockSize = 64 * 1024;
+
+  /**
+   * @brief Create a new, empty arena
+   * @param block_size size in bytes of the blocks requested from the heap.
+   *        Larger objects are given a block of their own.
+   * @return owning pointer to the arena.
+   */
+  static std::shared_ptr<GeometryArena> Create(
+      std::size_t block_size = kDefaultBlockSize);
+
+  /**
+   * @brief Installs an arena for all Geometry objects created by the current
+   *        thread during the lifetime of the scope object
+   *
+   * Scopes can be nested, the previously installed arena is restored by the
+   * destructor. Passing `nullptr` switches to heap allocation. The arena
+   * must not be destroyed before the scope.
+   *
+   * @note The arena is _not_ propagated to other threads, e.g. those running
+   *       the chunks of lf::base::ParallelFor(). Open a scope inside the
+   *       function executed by the threads instead.
+   */
+  class Scope {
+   public:
+    explicit Scope(GeometryArena* arena);
+    Scope(const Scope&) = delete;
+    Scope(Scope&&) = delete;
+    Scope& operator=(const Scope&) = delete;
+    Scope& operator=(Scope&&) = delete;
+    ~Scope();
+
+   private:
+    GeometryArena* previous_arena_;
+    char* previous_free_begin_;
+    char* previous_free_end_;
+    bool nested_;  // same arena as the enclosing scope
+  };
+
+  /** @brief The arena installed for the current thread, may be `nullptr` */
+  static GeometryArena* Current();
+
+  /**
+   * @brief Arena from which an object was allocated
+   * @param ptr address returned by Allocate()
+   * @return `nullptr`, if the memory was obtained from the heap
+   */
+  static const GeometryArena* Owner(const void* ptr);
+
+  /**
+   * @brief Allocate memory for an object
+   * @param size number of bytes
+   * @param arena arena to draw memory from, the heap is used for `nullptr`
+   * @param alignment alignment of the object, a power of two
+   * @return pointer to memory aligned to `alignment`
+   *
+   * Memory allocated by this function must be released by Deallocate() with
+   * the same alignment.
+   */
+  static void* Allocate(std::size_t size, GeometryArena* arena,
+                        std::size_t alignment = alignof(std::max_align_t));
+
+  /** @brief Release memory obtained from Allocate() */
+  static void Deallocate(
+      void* ptr, std::size_t alignment = alignof(std::max_align_t)) noexcept;
+
+  /** @brief Number of objects allocated from the arena and not yet deleted */
+  base::size_type NumObjects() const;
+
+  /** @brief Number of bytes requested from the heap by the arena */
+  std::size_t NumBytes() const;
+
+ private:
+  explicit GeometryArena(std::size_t block_size);
+  ~GeometryArena() = default;
+
+  /** @brief bump allocation from the range of the current thread */
+  void* AllocateInArena(std::size_t size, std::size_t alignment);
+  /** @brief allocation from a new range, `mutex_` must be held */
+  char* AllocateLocked(std::size_t size, std::size_t alignment,
+                       char*& free_begin, char*& free_end);
+  /** @brief keep the unused part of a range for other scopes */
+  void ReturnRange(char* free_begin, char* free_end) noexcept;
+  /** @brief drop a reference and free the arena with the last one */
+  void Release() noexcept;
+
+  const std::size_t block_size_;
+  mutable std::mutex mutex_;  // guards the block data
+  std::vector<std::unique_ptr<char[]>> blocks_;
+  // unused parts of blocks returned by closed scopes
+  std::vector<std::pair<char*, char*>> free_ranges_;
+  // range for allocations from threads on which the arena is not installed
+  char* free_begin_{nullptr};
+  char* free_end_{nullptr};
+  std::size_t num_bytes_{0};
+  // one reference held by the owner plus one for every live object
+  std::atomic<base::size_type> num_refs_{1};
+  std::atomic<base::size_type> num_objects_{0};
+};
+
+}  // namespace lf::geometry
+
+#endif  // __5b2c8e0d9f3a4c7e8b1d6a4f2e9c0b7d
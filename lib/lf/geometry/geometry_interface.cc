@@ -7,6 +7,39 @@
 
 namespace lf::geometry {
 
+Eigen::MatrixXd Geometry::Local(const Eigen::MatrixXd& global) const {
+  LF_ASSERT_MSG(global.rows() == DimGlobal(),
+                "Points must have " << DimGlobal() << " coordinates");
+  const lf::base::dim_t dim_local = DimLocal();
+  const Eigen::Index n = global.cols();
+  Eigen::MatrixXd local(dim_local, n);
+  if (dim_local == 0) {
+    return local;
+  }
+  // Initial guess: center of the reference element
+  const Eigen::VectorXd center =
+      RefEl().NodeCoords().rowwise().sum() / RefEl().NumNodes();
+  local = center.replicate(1, n);
+  // Gauss-Newton iterations, performed for all points simultaneously
+  const unsigned int max_its = isAffine() ? 1 : 20;
+  for (unsigned int it = 0; it < max_its; ++it) {
+    const Eigen::MatrixXd res = global - Global(local);
+    const Eigen::MatrixXd jig = JacobianInverseGramian(local);
+    double max_upd = 0.0;
+    for (Eigen::Index k = 0; k < n; ++k) {
+      const Eigen::VectorXd upd =
+          jig.block(0, k * dim_local, jig.rows(), dim_local).transpose() *
+          res.col(k);
+      local.col(k) += upd;
+      max_upd = std::max(max_upd, upd.cwiseAbs().maxCoeff());
+    }
+    if (max_upd < 1.0E-13) {
+      break;
+    }
+  }
+  return local;
+}
+
 double Volume(const Geometry& geo) {
   const lf::base::dim_t refdim = geo.DimLocal();
 
@@ -4,6 +4,8 @@
 #include <lf/base/base.h>
 #include <Eigen/Eigen>
 #include <memory>
+#include <new>
+#include "geometry_arena.h"
 #include "refinement_pattern.h"
 
 namespace lf::geometry {
@@ -53,6 +55,26 @@ class Geometry {
    */
   virtual Eigen::MatrixXd Global(const Eigen::MatrixXd& local) const = 0;
 
+  /**
+   * @brief Map a number of points in global coordinates back to the
+   *        reference element (inverse of Global()).
+   * @param global A Matrix of size `DimGlobal() x numPoints` that contains
+   *               the global coordinates of the points as column vectors.
+   * @return A Matrix of size `DimLocal() x numPoints` that contains the
+   *         local coordinates of the points as column vectors.
+   *
+   * The returned local coordinates \f$ \mathbf{\xi} \f$ minimize
+   * \f$ |\mathbf{\Phi}(\mathbf{\xi}) - \mathbf{x}| \f$, that is, they
+   * are the preimages of the points if `DimLocal() == DimGlobal()`. Points
+   * outside the entity are mapped to local coordinates outside the reference
+   * element, which allows to test whether a point lies inside an entity.
+   *
+   * The default implementation runs Gauss-Newton iterations starting from the
+   * center of the reference element, which terminate after a single step for
+   * affine geometries. Derived classes may provide closed formulas.
+   */
+  virtual Eigen::MatrixXd Local(const Eigen::MatrixXd& global) const;
+
   /**
    * @brief Evaluate the jacobian of the mapping simultaneously at `numPoints`
    *        points.
@@ -182,6 +204,40 @@ class Geometry {
    */
   virtual ~Geometry() = default;
 
+  /**
+   * @brief Allocation of geometry objects, from the GeometryArena installed
+   *        for the current thread, or from the heap if there is none
+   *
+   * @note Deleting a geometry that was allocated from an arena does not make
+   * its memory available again, not even inside the same
+   * GeometryArena::Scope. The memory is reclaimed only when the whole arena
+   * is destroyed.
+   */
+  static void* operator new(std::size_t size) {
+    return GeometryArena::Allocate(size, GeometryArena::Current());
+  }
+
+  /**
+   * @brief Allocation of geometry objects with an extended alignment, e.g.
+   *        because they contain fixed-size vectorizable Eigen members
+   *
+   * Behaves like operator new(std::size_t).
+   */
+  static void* operator new(std::size_t size, std::align_val_t alignment) {
+    return GeometryArena::Allocate(size, GeometryArena::Current(),
+                                   static_cast<std::size_t>(alignment));
+  }
+
+  /** @brief Counterpart of operator new(std::size_t) */
+  static void operator delete(void* ptr) noexcept {
+    GeometryArena::Deallocate(ptr);
+  }
+
+  /** @brief Counterpart of operator new(std::size_t, std::align_val_t) */
+  static void operator delete(void* ptr, std::align_val_t alignment) noexcept {
+    GeometryArena::Deallocate(ptr, static_cast<std::size_t>(alignment));
+  }
+
   // Output control variable
   /** @brief Output control variable */
   static unsigned int output_ctrl_;
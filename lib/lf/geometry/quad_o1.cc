@@ -6,6 +6,12 @@
 
 namespace lf::geometry {
 
+namespace /*anonymous*/ {
+// View of entry (r,c) of all 2x2 blocks of a 2 x 2n matrix, the entry of the
+// i-th block is stored at position 4*i+2*c+r
+using BlockEntries = Eigen::Map<Eigen::ArrayXd, 0, Eigen::InnerStride<4>>;
+}  // namespace
+
 bool assertNonDegenerateQuad(
     const Eigen::Matrix<double, Eigen::Dynamic, 4>& coords, double tol) {
   // World dimension
@@ -55,77 +61,126 @@ bool assertNonDegenerateQuad(
 }
 
 QuadO1::QuadO1(Eigen::Matrix<double, Eigen::Dynamic, 4> coords)
-    : coords_(std::move(coords)) {
+    : coords_(std::move(coords)), coeffs_(coords_.rows(), 4) {
   // Check validity of geometry (non-zero area)
   assertNonDegenerateQuad(coords_);
+  // Coefficients of the bilinear mapping, computed once
+  coeffs_.col(0) = coords_.col(0);
+  coeffs_.col(1) = coords_.col(1) - coords_.col(0);
+  coeffs_.col(2) = coords_.col(3) - coords_.col(0);
+  coeffs_.col(3) =
+      coords_.col(0) - coords_.col(1) + coords_.col(2) - coords_.col(3);
 }
 
 Eigen::MatrixXd QuadO1::Global(const Eigen::MatrixXd& local) const {
   LF_ASSERT_MSG(local.rows() == 2, "reference coords must be 2-vectors");
-  return coords_.col(0) *
-             ((1 - local.array().row(0)) * (1 - local.array().row(1)))
-                 .matrix() +
-         coords_.col(1) *
-             (local.array().row(0) * (1 - local.array().row(1))).matrix() +
-         coords_.col(2) *
-             (local.array().row(0) * local.array().row(1)).matrix() +
-         coords_.col(3) *
-             ((1 - local.array().row(0)) * local.array().row(1)).matrix();
+  Eigen::Matrix<double, 4, Eigen::Dynamic> monomials(4, local.cols());
+  monomials.row(0).setOnes();
+  monomials.block(1, 0, 2, local.cols()) = local;
+  monomials.row(3) = local.row(0).cwiseProduct(local.row(1));
+  return coeffs_ * monomials;
 }
 
 Eigen::MatrixXd QuadO1::Jacobian(const Eigen::MatrixXd& local) const {
+  LF_ASSERT_MSG(local.rows() == 2, "reference coords must be 2-vectors");
   Eigen::MatrixXd result(DimGlobal(), local.cols() * 2);
-
   for (int i = 0; i < local.cols(); ++i) {
-    result.col(2 * i) = (coords_.col(1) - coords_.col(0)) * (1 - local(1, i)) +
-                        (coords_.col(2) - coords_.col(3)) * local(1, i);
-    result.col(2 * i + 1) =
-        (coords_.col(3) - coords_.col(0)) * (1 - local(0, i)) +
-        (coords_.col(2) - coords_.col(1)) * local(0, i);
+    result.col(2 * i) = coeffs_.col(1) + coeffs_.col(3) * local(1, i);
+    result.col(2 * i + 1) = coeffs_.col(2) + coeffs_.col(3) * local(0, i);
   }
   return result;
 }
 
 Eigen::MatrixXd QuadO1::JacobianInverseGramian(
     const ::Eigen::MatrixXd& local) const {
-  Eigen::MatrixXd result(DimGlobal(), local.cols() * 2);
-  Eigen::MatrixXd jacobian(DimGlobal(), 2);
-
-  for (int i = 0; i < local.cols(); ++i) {
-    jacobian.col(0) = (coords_.col(1) - coords_.col(0)) * (1 - local(1, i)) +
-                      (coords_.col(2) - coords_.col(3)) * local(1, i);
-    jacobian.col(1) = (coords_.col(3) - coords_.col(0)) * (1 - local(0, i)) +
-                      (coords_.col(2) - coords_.col(1)) * local(0, i);
-
-    if (DimGlobal() == 2) {
-      result.block(0, 2 * i, DimGlobal(), 2) = jacobian.transpose().inverse();
-    } else {
-      result.block(0, 2 * i, DimGlobal(), 2) = (jacobian.transpose() * jacobian)
-                                                   .colPivHouseholderQr()
-                                                   .solve(jacobian.transpose())
-                                                   .transpose();
+  LF_ASSERT_MSG(local.rows() == 2, "reference coords must be 2-vectors");
+  const Eigen::Index n = local.cols();
+  Eigen::MatrixXd result(DimGlobal(), 2 * n);
+  if (DimGlobal() != 2) {
+    for (Eigen::Index i = 0; i < n; ++i) {
+      const Eigen::Matrix<double, Eigen::Dynamic, 2> J(JacobianAt(local, i));
+      const Eigen::Matrix2d gramian = J.transpose() * J;
+      result.block(0, 2 * i, DimGlobal(), 2) = J * gramian.inverse();
     }
+    return result;
   }
-
+  const PlanarJacobians jac(PlanarJacobianEntries(local));
+  const Eigen::ArrayXd inv_det =
+      (jac.j00 * jac.j11 - jac.j01 * jac.j10).inverse();
+  BlockEntries(result.data(), n) = jac.j11 * inv_det;
+  BlockEntries(result.data() + 1, n) = -jac.j01 * inv_det;
+  BlockEntries(result.data() + 2, n) = -jac.j10 * inv_det;
+  BlockEntries(result.data() + 3, n) = jac.j00 * inv_det;
   return result;
 }
 
 Eigen::VectorXd QuadO1::IntegrationElement(const Eigen::MatrixXd& local) const {
-  Eigen::VectorXd result(local.cols());
-  Eigen::MatrixXd jacobian(DimGlobal(), 2);
-  for (int i = 0; i < local.cols(); ++i) {
-    jacobian.col(0) = (coords_.col(1) - coords_.col(0)) * (1 - local(1, i)) +
-                      (coords_.col(2) - coords_.col(3)) * local(1, i);
-    jacobian.col(1) = (coords_.col(3) - coords_.col(0)) * (1 - local(0, i)) +
-                      (coords_.col(2) - coords_.col(1)) * local(0, i);
+  LF_ASSERT_MSG(local.rows() == 2, "reference coords must be 2-vectors");
+  const Eigen::Index n = local.cols();
+  if (DimGlobal() != 2) {
+    Eigen::VectorXd result(n);
+    for (Eigen::Index i = 0; i < n; ++i) {
+      const Eigen::Matrix<double, Eigen::Dynamic, 2> J(JacobianAt(local, i));
+      const Eigen::Matrix2d gramian = J.transpose() * J;
+      result(i) = std::sqrt(gramian.determinant());
+    }
+    return result;
+  }
+  const PlanarJacobians jac(PlanarJacobianEntries(local));
+  return (jac.j00 * jac.j11 - jac.j01 * jac.j10).abs().matrix();
+}
 
-    if (DimGlobal() == 2) {
-      result(i) = std::abs(jacobian.determinant());
-    } else {
-      result(i) = std::sqrt((jacobian.transpose() * jacobian).determinant());
+void QuadO1::MetricTerms(const Eigen::MatrixXd& local,
+                         Eigen::MatrixXd& jacobian,
+                         Eigen::MatrixXd& jacobian_inverse_gramian,
+                         Eigen::VectorXd& integration_element) const {
+  LF_ASSERT_MSG(local.rows() == 2, "reference coords must be 2-vectors");
+  const Eigen::Index n = local.cols();
+  jacobian.resize(DimGlobal(), 2 * n);
+  jacobian_inverse_gramian.resize(DimGlobal(), 2 * n);
+  integration_element.resize(n);
+  if (DimGlobal() != 2) {
+    for (Eigen::Index i = 0; i < n; ++i) {
+      const Eigen::Matrix<double, Eigen::Dynamic, 2> J(JacobianAt(local, i));
+      const Eigen::Matrix2d gramian = J.transpose() * J;
+      jacobian.block(0, 2 * i, DimGlobal(), 2) = J;
+      jacobian_inverse_gramian.block(0, 2 * i, DimGlobal(), 2) =
+          J * gramian.inverse();
+      integration_element(i) = std::sqrt(gramian.determinant());
     }
+    return;
   }
-  return result;
+  const PlanarJacobians jac(PlanarJacobianEntries(local));
+  const Eigen::ArrayXd det = jac.j00 * jac.j11 - jac.j01 * jac.j10;
+  BlockEntries(jacobian.data(), n) = jac.j00;
+  BlockEntries(jacobian.data() + 1, n) = jac.j10;
+  BlockEntries(jacobian.data() + 2, n) = jac.j01;
+  BlockEntries(jacobian.data() + 3, n) = jac.j11;
+  // Closed form of the inverse transposed Jacobians
+  const Eigen::ArrayXd inv_det = det.inverse();
+  BlockEntries(jacobian_inverse_gramian.data(), n) = jac.j11 * inv_det;
+  BlockEntries(jacobian_inverse_gramian.data() + 1, n) = -jac.j01 * inv_det;
+  BlockEntries(jacobian_inverse_gramian.data() + 2, n) = -jac.j10 * inv_det;
+  BlockEntries(jacobian_inverse_gramian.data() + 3, n) = jac.j00 * inv_det;
+  integration_element = det.abs().matrix();
+}
+
+Eigen::Matrix<double, Eigen::Dynamic, 2> QuadO1::JacobianAt(
+    const Eigen::MatrixXd& local, Eigen::Index i) const {
+  Eigen::Matrix<double, Eigen::Dynamic, 2> J(DimGlobal(), 2);
+  J.col(0) = coeffs_.col(1) + coeffs_.col(3) * local(1, i);
+  J.col(1) = coeffs_.col(2) + coeffs_.col(3) * local(0, i);
+  return J;
+}
+
+QuadO1::PlanarJacobians QuadO1::PlanarJacobianEntries(
+    const Eigen::MatrixXd& local) const {
+  const auto xi = local.row(0).array();
+  const auto eta = local.row(1).array();
+  return {(coeffs_(0, 1) + coeffs_(0, 3) * eta).transpose(),
+          (coeffs_(1, 1) + coeffs_(1, 3) * eta).transpose(),
+          (coeffs_(0, 2) + coeffs_(0, 3) * xi).transpose(),
+          (coeffs_(1, 2) + coeffs_(1, 3) * xi).transpose()};
 }
 
 std::unique_ptr<Geometry> QuadO1::SubGeometry(dim_t codim, dim_t i) const {
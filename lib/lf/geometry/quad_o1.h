@@ -48,6 +48,30 @@ class QuadO1 : public Geometry {
   Eigen::VectorXd IntegrationElement(
       const Eigen::MatrixXd& local) const override;
 
+  /**
+   * @brief Jacobians, their pseudo-inverses and the integration elements for
+   *        many points in one pass
+   *
+   * @param local 2 x n matrix of reference coordinates, e.g. the points of a
+   *        quadrature rule
+   * @param jacobian the same as Jacobian() for the points in `local`
+   * @param jacobian_inverse_gramian the same as JacobianInverseGramian()
+   * @param integration_element the same as IntegrationElement()
+   *
+   * For a quadrilateral in the plane the entries of the 2x2 Jacobians are
+   * computed as arrays over all points, which are inverted by the closed
+   * formula \f$ J^{-T} = \frac{1}{\det J}\left[\begin{smallmatrix} J_{11} &
+   * -J_{10} \\ -J_{01} & J_{00}\end{smallmatrix}\right] \f$. In three
+   * dimensions the pseudo-inverses are computed point by point.
+ 
+   *
+   * JacobianInverseGramian() and IntegrationElement() use the same formulas
+   * but only compute their own result.
+   */
+  void MetricTerms(const Eigen::MatrixXd& local, Eigen::MatrixXd& jacobian,
+                   Eigen::MatrixXd& jacobian_inverse_gramian,
+                   Eigen::VectorXd& integration_element) const;
+
   /** @copydoc Geometry::SubGeometry() */
   std::unique_ptr<Geometry> SubGeometry(dim_t codim, dim_t i) const override;
 
@@ -66,6 +90,21 @@ class QuadO1 : public Geometry {
  private:
   /** @brief Coordinates of the a four vertices, stored in matrix columns */
   Eigen::Matrix<double, Eigen::Dynamic, 4> coords_;
+  /** @brief Coefficient vectors of the bilinear mapping
+   * \f$ \mathbf{x}(\xi,\eta) = \mathbf{a}_0 + \mathbf{a}_1\xi +
+   * \mathbf{a}_2\eta + \mathbf{a}_3\xi\eta \f$, stored in matrix columns */
+  Eigen::Matrix<double, Eigen::Dynamic, 4> coeffs_;
+
+  /** @brief Jacobian at the `i`-th point of `local` */
+  Eigen::Matrix<double, Eigen::Dynamic, 2> JacobianAt(
+      const Eigen::MatrixXd& local, Eigen::Index i) const;
+
+  /** @brief Entries of the 2x2 Jacobians of a planar quadrilateral, each
+   * stored as an array over all points */
+  struct PlanarJacobians {
+    Eigen::ArrayXd j00, j10, j01, j11;
+  };
+  PlanarJacobians PlanarJacobianEntries(const Eigen::MatrixXd& local) const;
 };
 
 /**
@@ -103,6 +142,16 @@ class Parallelogram : public Geometry {
   base::RefEl RefEl() const override { return base::RefEl::kQuad(); }
 
   Eigen::MatrixXd Global(const Eigen::MatrixXd& local) const override;
+
+  /** @copydoc Geometry::Local()
+   *
+   * Closed formula using the constant pseudo-inverse of the Jacobian.
+   */
+  Eigen::MatrixXd Local(const Eigen::MatrixXd& global) const override {
+    return jacobian_inverse_gramian_.transpose() *
+           (global.colwise() - coords_.col(0));
+  }
+
   Eigen::MatrixXd Jacobian(const Eigen::MatrixXd& local) const override;
   Eigen::MatrixXd JacobianInverseGramian(
       const ::Eigen::MatrixXd& local) const override;
@@ -21,7 +21,7 @@ bool isParallelogram(
   if (polygon.cols() != 4) {
     return false;
   }
-  return ((polygon * (Eigen::Vector4i() << 1, -1, -1, 1).finished())
+  return ((polygon * (Eigen::Vector4i() << 1, -1, 1, -1).finished())
               .squaredNorm() == 0);
 }
 }  // namespace lf::geometry
@@ -0,0 +1,114 @@
+/**
+ * @file
+ * @brief Tests for the allocation of geometries from a GeometryArena
+ * @author agent
+ * @date   2026-10-19
+ * @copyright MIT License
+ */
+
+#include <gtest/gtest.h>
+#include <lf/geometry/geometry.h>
+#include <cstdint>
+#include <set>
+
+namespace lf::geometry::test {
+
+TEST(GeometryArenaTest, scopes) {
+  auto arena = GeometryArena::Create(1024);
+  EXPECT_EQ(GeometryArena::Current(), nullptr);
+  std::unique_ptr<Geometry> heap_geo =
+      std::make_unique<Point>(Eigen::Vector2d(1, 2));
+  std::vector<std::unique_ptr<Geometry>> arena_geos;
+  {
+    GeometryArena::Scope scope(arena.get());
+    EXPECT_EQ(GeometryArena::Current(), arena.get());
+    Eigen::Matrix<double, Eigen::Dynamic, 3> corners(2, 3);
+    corners << 0, 1, 0, 0, 0, 1;
+    for (int i = 0; i < 100; ++i) {
+      arena_geos.push_back(std::make_unique<TriaO1>(corners));
+    }
+    // Geometries created by other geometries go to the arena as well
+    arena_geos.push_back(arena_geos[0]->SubGeometry(1, 0));
+    {
+      GeometryArena::Scope heap_scope(nullptr);
+      EXPECT_EQ(GeometryArena::Current(), nullptr);
+    }
+    EXPECT_EQ(GeometryArena::Current(), arena.get());
+  }
+  EXPECT_EQ(GeometryArena::Current(), nullptr);
+  EXPECT_EQ(GeometryArena::Owner(heap_geo.get()), nullptr);
+  for (const auto& geo : arena_geos) {
+    EXPECT_EQ(GeometryArena::Owner(geo.get()), arena.get());
+  }
+  EXPECT_EQ(arena->NumObjects(), 101);
+  EXPECT_GE(arena->NumBytes(), 101 * sizeof(TriaO1));
+  arena_geos.resize(50);
+  EXPECT_EQ(arena->NumObjects(), 50);
+}
+
+TEST(GeometryArenaTest, objectsOutliveOwner) {
+  std::unique_ptr<Geometry> geo;
+  {
+    auto arena = GeometryArena::Create();
+    GeometryArena::Scope scope(arena.get());
+    geo = std::make_unique<SegmentO1>(
+        (Eigen::Matrix<double, Eigen::Dynamic, 2>(1, 2) << 0, 2).finished());
+  }
+  // The memory of the arena is kept until the last object has been deleted
+  EXPECT_EQ(geo->Global((Eigen::MatrixXd(1, 1) << 0.5).finished())(0, 0),
+            1.0);
+  geo.reset();
+}
+
+// Geometry that requires more than the default alignment
+class alignas(64) AlignedPoint : public Point {
+ public:
+  AlignedPoint() : Point(Eigen::Vector2d(0, 0)) {}
+  char padding[40]{};
+};
+
+TEST(GeometryArenaTest, overAlignedGeometry) {
+  auto arena = GeometryArena::Create(1024);
+  std::vector<std::unique_ptr<Geometry>> geos;
+  for (GeometryArena* a : {static_cast<GeometryArena*>(nullptr), arena.get()}) {
+    GeometryArena::Scope scope(a);
+    for (int i = 0; i < 10; ++i) {
+      geos.push_back(std::make_unique<Point>(Eigen::Vector2d(1, 2)));
+      geos.push_back(std::make_unique<AlignedPoint>());
+      EXPECT_EQ(reinterpret_cast<std::uintptr_t>(geos.back().get()) % 64, 0);
+      EXPECT_EQ(GeometryArena::Owner(geos.back().get()), a);
+    }
+  }
+  EXPECT_EQ(arena->NumObjects(), 20);
+  geos.clear();
+  EXPECT_EQ(arena->NumObjects(), 0);
+}
+
+TEST(GeometryArenaTest, concurrentScopes) {
+  auto arena = GeometryArena::Create(4096);
+  const std::size_t n = 20000;
+  std::vector<std::unique_ptr<Geometry>> geos(n);
+  base::ParallelFor(
+      n,
+      [&](std::size_t begin, std::size_t end) {
+        const GeometryArena::Scope scope(arena.get());
+        for (std::size_t i = begin; i < end; ++i) {
+          geos[i] = std::make_unique<Point>(Eigen::Vector2d(i, 0));
+        }
+      },
+      100, 4);
+  EXPECT_EQ(arena->NumObjects(), n);
+  // No two objects share memory
+  std::set<const Geometry*> addresses;
+  for (std::size_t i = 0; i < n; ++i) {
+    EXPECT_EQ(GeometryArena::Owner(geos[i].get()), arena.get());
+    EXPECT_EQ(geos[i]->Global(Eigen::MatrixXd(0, 1))(0, 0),
+              static_cast<double>(i));
+    addresses.insert(geos[i].get());
+  }
+  EXPECT_EQ(addresses.size(), n);
+  // The 200 scopes reuse the unused parts of the blocks of earlier ones
+  EXPECT_LT(arena->NumBytes(), n * (sizeof(Point) + 32) + 16 * 4096);
+}
+
+}  // namespace lf::geometry::test
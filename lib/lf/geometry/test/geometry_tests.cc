@@ -118,6 +118,20 @@ void checkIntegrationElement(const lf::geometry::Geometry &geom,
   }
 }
 
+/**
+ * Checks if Local() inverts Global() on the given points
+ */
+void checkLocal(const lf::geometry::Geometry &geom,
+                const Eigen::MatrixXd &eval_points) {
+  const Eigen::MatrixXd local = geom.Local(geom.Global(eval_points));
+
+  EXPECT_EQ(local.rows(), geom.DimLocal());
+  EXPECT_EQ(local.cols(), eval_points.cols());
+  EXPECT_TRUE(local.isApprox(eval_points, 1e-10))
+      << "Local() does not invert Global(): " << local << " instead of "
+      << eval_points;
+}
+
 TEST(Geometry, Point) {
   lf::geometry::Point geom((Eigen::MatrixXd(2, 1) << 1, 1).finished());
 
@@ -137,6 +151,7 @@ TEST(Geometry, SegmentO1) {
   checkJacobians(geom, qr.Points(), 1e-9);
   checkJacobianInverseGramian(geom, qr.Points());
   checkIntegrationElement(geom, qr.Points());
+  checkLocal(geom, qr.Points());
 }
 
 TEST(Geometry, TriaO1) {
@@ -147,6 +162,7 @@ TEST(Geometry, TriaO1) {
   checkJacobians(geom, qr.Points(), 1e-9);
   checkJacobianInverseGramian(geom, qr.Points());
   checkIntegrationElement(geom, qr.Points());
+  checkLocal(geom, qr.Points());
 }
 
 TEST(Geometry, QuadO1) {
@@ -157,4 +173,16 @@ TEST(Geometry, QuadO1) {
   checkJacobians(geom, qr.Points(), 1e-9);
   checkJacobianInverseGramian(geom, qr.Points());
   checkIntegrationElement(geom, qr.Points());
+  checkLocal(geom, qr.Points());
+}
+
+TEST(Geometry, Parallelogram) {
+  lf::geometry::Parallelogram geom(
+      (Eigen::MatrixXd(2, 4) << -1, 3, 5, 1, -2, 0, 3, 1).finished());
+  auto qr = lf::quad::make_QuadRule(lf::base::RefEl::kQuad(), 5);
+
+  checkJacobians(geom, qr.Points(), 1e-9);
+  checkJacobianInverseGramian(geom, qr.Points());
+  checkIntegrationElement(geom, qr.Points());
+  checkLocal(geom, qr.Points());
 }
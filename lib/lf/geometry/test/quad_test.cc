@@ -33,4 +33,50 @@ TEST(QuadTest, checkJacobians) {
       << "Different metric factors " << Jacit_quad << " <-> " << Jacit_parg;
 }
 
+// Check the metric terms of a general quadrilateral against finite
+// differences of the parameterization
+void CheckMetricTerms(const Eigen::Matrix<double, Eigen::Dynamic, 4> &corners) {
+  const lf::geometry::QuadO1 quad(corners);
+  const int dim = corners.rows();
+  Eigen::MatrixXd refcoords(2, 5);
+  refcoords << 0.2, 0.7, 0.0, 1.0, 0.5, 0.1, 0.3, 1.0, 0.0, 0.9;
+  Eigen::MatrixXd J;
+  Eigen::MatrixXd JIG;
+  Eigen::VectorXd ie;
+  quad.MetricTerms(refcoords, J, JIG, ie);
+  EXPECT_EQ(J, quad.Jacobian(refcoords));
+  EXPECT_EQ(JIG, quad.JacobianInverseGramian(refcoords));
+  EXPECT_EQ(ie, quad.IntegrationElement(refcoords));
+  const double h = 1.0E-6;
+  for (int i = 0; i < refcoords.cols(); ++i) {
+    Eigen::MatrixXd J_fd(dim, 2);
+    for (int k = 0; k < 2; ++k) {
+      Eigen::MatrixXd pts(2, 2);
+      pts << refcoords.col(i), refcoords.col(i);
+      pts(k, 0) -= h;
+      pts(k, 1) += h;
+      const Eigen::MatrixXd x = quad.Global(pts);
+      J_fd.col(k) = (x.col(1) - x.col(0)) / (2 * h);
+    }
+    const Eigen::MatrixXd J_i = J.block(0, 2 * i, dim, 2);
+    EXPECT_NEAR((J_i - J_fd).norm(), 0.0, 1.0E-8);
+    EXPECT_NEAR(
+        (J_i.transpose() * JIG.block(0, 2 * i, dim, 2) -
+         Eigen::Matrix2d::Identity())
+            .norm(),
+        0.0, 1.0E-12);
+    EXPECT_NEAR(ie[i], std::sqrt((J_i.transpose() * J_i).determinant()),
+                1.0E-12);
+  }
+}
+
+TEST(QuadTest, metricTerms) {
+  Eigen::Matrix<double, Eigen::Dynamic, 4> corners_2d(2, 4);
+  corners_2d << 0, 2, 3, -0.5, 0, 0.5, 2, 1.5;
+  CheckMetricTerms(corners_2d);
+  Eigen::Matrix<double, Eigen::Dynamic, 4> corners_3d(3, 4);
+  corners_3d << 0, 2, 3, -0.5, 0, 0.5, 2, 1.5, 0, 0.1, 0.5, 0.2;
+  CheckMetricTerms(corners_3d);
+}
+
 }  // namespace lf::geometry::test
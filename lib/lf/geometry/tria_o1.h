@@ -29,6 +29,15 @@ class TriaO1 : public Geometry {
   base::RefEl RefEl() const override { return base::RefEl::kTria(); }
   Eigen::MatrixXd Global(const Eigen::MatrixXd& local) const override;
 
+  /** @copydoc Geometry::Local()
+   *
+   * Closed formula using the constant pseudo-inverse of the Jacobian.
+   */
+  Eigen::MatrixXd Local(const Eigen::MatrixXd& global) const override {
+    return jacobian_inverse_gramian_.transpose() *
+           (global.colwise() - coords_.col(0));
+  }
+
   Eigen::MatrixXd Jacobian(const Eigen::MatrixXd& local) const override {
     return jacobian_.replicate(1, local.cols());
   }
@@ -10,6 +10,8 @@
 #define __22f8165024874bb58675c694b54c52b5
 
 #include "gmsh_reader.h"
+#include "time_series.h"
+#include "vtk_stream_writer.h"
 #include "vtk_writer.h"
 #include "write_matplotlib.h"
 
@@ -0,0 +1,131 @@
+/**
+ * @file
+ * @brief Test TimeSeriesWriter and TimeSeriesReader
+ * @author agent
+ * @date   2026-10-19
+ * @copyright MIT License
+ */
+
+#include <gtest/gtest.h>
+#include <lf/io/io.h>
+#include <lf/io/test_utils/read_mesh.h>
+#include <boost/variant/get.hpp>
+#include <fstream>
+#include <iterator>
+#include "lf/mesh/utils/lambda_mesh_data_set.h"
+
+namespace lf::io::test {
+
+std::streamoff FileSize(const std::string& filename) {
+  return std::ifstream(filename, std::ios_base::binary | std::ios_base::ate)
+      .tellg();
+}
+
+TEST(lf_io_TimeSeries, writeRead) {
+  auto reader = test_utils::getGmshReader("two_element_hybrid_2d.msh", 2);
+  auto mesh_p = reader.mesh();
+  using lf::mesh::utils::make_LambdaMeshDataSet;
+
+  std::vector<std::streamoff> step_sizes;
+  {
+    TimeSeriesWriter writer(mesh_p, "series.lfts");
+    // data can only be written into a time step
+    EXPECT_THROW(writer.WritePointData(
+                     "u", *make_LambdaMeshDataSet(
+                              [](const auto& /*e*/) { return 1.0; })),
+                 base::LfException);
+    for (int step = 0; step < 3; ++step) {
+      const std::streamoff size_before = FileSize("series.lfts");
+      writer.BeginStep(0.5 * step);
+      writer.WritePointData("u", *make_LambdaMeshDataSet([&](const auto& e) {
+                              return step + 0.1 * mesh_p->Index(e);
+                            }));
+      writer.WriteCellData(
+          "index",
+          *make_LambdaMeshDataSet(
+              [&](const auto& e) { return static_cast<int>(mesh_p->Index(e)); },
+              [&](const auto& e) { return mesh_p->Index(e) == 0; }),
+          -1);
+      writer.WriteCellData("v", *make_LambdaMeshDataSet([&](const auto& e) {
+                             return Eigen::Vector2d(step, 1.0);
+                           }));
+      // the name of a dataset must be unique within a step
+      EXPECT_THROW(writer.WriteCellData(
+                       "v", *make_LambdaMeshDataSet(
+                                [](const auto& /*e*/) { return 1.0; })),
+                   base::LfException);
+      step_sizes.push_back(FileSize("series.lfts") - size_before);
+    }
+    EXPECT_EQ(writer.NumSteps(), 3);
+  }
+  // every step only contains its data, not the mesh
+  EXPECT_EQ(step_sizes[0], step_sizes[2]);
+  EXPECT_EQ(step_sizes[0], 17 + (24 + 5 * 8) + (28 + 2 * 4) + (24 + 6 * 8));
+
+  const TimeSeriesReader series("series.lfts");
+  ASSERT_EQ(series.NumSteps(), 3);
+  EXPECT_EQ(series.Grid().points.size(), 5);
+  EXPECT_EQ(series.Grid().points[2], Eigen::Vector3f(2, 0, 0));
+  ASSERT_EQ(series.Grid().cells.size(), 2);
+  EXPECT_EQ(series.Grid().cells[0], std::vector<unsigned int>({1, 2, 4}));
+  EXPECT_EQ(series.Grid().cell_types[1], VtkFile::CellType::VTK_QUAD);
+  EXPECT_EQ(series.Time(2), 1.0);
+  ASSERT_EQ(series.DataSets(1).size(), 3);
+  EXPECT_EQ(series.DataSets(1)[2].name, "v");
+  EXPECT_EQ(series.DataSets(1)[2].num_components, 3);
+
+  const std::vector<double> u = series.ReadData<double>(2, "u", false);
+  ASSERT_EQ(u.size(), 5);
+  EXPECT_DOUBLE_EQ(u[3], 2.3);
+  EXPECT_EQ(series.ReadData<int>(1, "index", true), std::vector<int>({0, -1}));
+  EXPECT_EQ(series.ReadData<double>(1, "v", true),
+            std::vector<double>({1, 1, 0, 1, 1, 0}));
+  EXPECT_THROW(series.ReadData<float>(1, "u", false), base::LfException);
+  EXPECT_THROW(series.ReadData<double>(1, "u", true), base::LfException);
+
+  const VtkFile vtk_file = series.ReadStep(1);
+  EXPECT_EQ(vtk_file.point_data.size(), 1);
+  EXPECT_EQ(vtk_file.cell_data.size(), 2);
+  const auto& v = boost::get<VtkFile::VectorData<double>>(vtk_file.cell_data[1]);
+  EXPECT_EQ(v.data[1], Eigen::Vector3d(1, 1, 0));
+
+  WriteTimeSeriesToVtu("series.lfts", "series");
+  for (int step = 0; step < 3; ++step) {
+    EXPECT_GT(FileSize("series_" + std::to_string(step) + ".vtu"), 0);
+  }
+  std::ifstream pvd("series.pvd");
+  const std::string pvd_content((std::istreambuf_iterator<char>(pvd)),
+                                std::istreambuf_iterator<char>());
+  EXPECT_NE(pvd_content.find("timestep=\"0.5\" part=\"0\" file=\"series_1.vtu\""),
+            std::string::npos);
+}
+
+// A dataset that was not written completely is ignored
+TEST(lf_io_TimeSeries, truncatedFile) {
+  auto reader = test_utils::getGmshReader("two_element_hybrid_2d.msh", 2);
+  auto mesh_p = reader.mesh();
+  using lf::mesh::utils::make_LambdaMeshDataSet;
+  auto mds = make_LambdaMeshDataSet([](const auto& /*e*/) { return 1.0; });
+  {
+    TimeSeriesWriter writer(mesh_p, "truncated.lfts");
+    writer.BeginStep(0.0);
+    writer.WritePointData("u", *mds);
+    writer.BeginStep(1.0);
+    writer.WritePointData("u", *mds);
+  }
+  std::ifstream in("truncated.lfts", std::ios_base::binary);
+  std::string content((std::istreambuf_iterator<char>(in)),
+                      std::istreambuf_iterator<char>());
+  content.resize(content.size() - 3);
+  std::ofstream("truncated.lfts", std::ios_base::binary) << content;
+
+  const TimeSeriesReader series("truncated.lfts");
+  ASSERT_EQ(series.NumSteps(), 2);
+  EXPECT_EQ(series.DataSets(0).size(), 1);
+  EXPECT_EQ(series.DataSets(1).size(), 0);
+
+  std::ofstream("not_a_series.lfts") << "LFT";
+  EXPECT_THROW(TimeSeriesReader("not_a_series.lfts"), base::LfException);
+}
+
+}  // namespace lf::io::test
@@ -0,0 +1,126 @@
+/**
+ * @file
+ * @brief Test the VtkStreamWriter against the VtkWriter
+ * @author agent
+ * @date   2026-10-19
+ * @copyright MIT License
+ */
+
+#include <gtest/gtest.h>
+#include <lf/io/io.h>
+#include <lf/io/test_utils/read_mesh.h>
+#include <fstream>
+#include <iterator>
+#include "lf/mesh/utils/lambda_mesh_data_set.h"
+
+namespace lf::io::test {
+
+std::string ReadFile(const std::string& filename) {
+  std::ifstream file(filename, std::ios_base::binary);
+  return {std::istreambuf_iterator<char>(file),
+          std::istreambuf_iterator<char>()};
+}
+
+// Write the same data with both writers, the binary files must be identical
+TEST(lf_io_VtkStreamWriter, sameAsVtkWriter) {
+  auto reader = test_utils::getGmshReader("two_element_hybrid_2d.msh", 2);
+  auto mesh_p = reader.mesh();
+  using lf::mesh::utils::make_LambdaMeshDataSet;
+  auto index_mds = make_LambdaMeshDataSet(
+      [&](const auto& e) { return static_cast<double>(mesh_p->Index(e)); });
+  auto int_mds = make_LambdaMeshDataSet(
+      [&](const auto& e) { return static_cast<int>(mesh_p->Index(e)); },
+      [&](const auto& e) { return mesh_p->Index(e) < 3; });
+  auto uchar_mds = make_LambdaMeshDataSet([&](const auto& e) {
+    return static_cast<unsigned char>(mesh_p->Index(e));
+  });
+  auto vector_mds = make_LambdaMeshDataSet([&](const auto& e) {
+    return Eigen::Vector2f(static_cast<float>(mesh_p->Index(e)), 1.f);
+  });
+
+  for (base::dim_t codim : {0, 1}) {
+    {
+      VtkWriter writer(mesh_p, "vtk_writer.vtk", codim);
+      writer.setBinary(true);
+      writer.WriteGlobalData("time", std::vector<double>{0.5});
+      writer.WriteGlobalData("step", std::vector<int>{1, 2});
+      writer.WritePointData("double", *index_mds);
+      writer.WritePointData("int", *int_mds, -1);
+      writer.WritePointData("vector", *vector_mds);
+      writer.WriteCellData("uchar", *uchar_mds);
+      writer.WriteCellData("vector", *vector_mds);
+    }
+    {
+      VtkStreamWriter writer(mesh_p, "vtk_stream_writer.vtk", codim);
+      writer.WriteGlobalData("time", std::vector<double>{0.5});
+      writer.WriteGlobalData("step", std::vector<int>{1, 2});
+      writer.WritePointData("double", *index_mds);
+      writer.WritePointData("int", *int_mds, -1);
+      writer.WritePointData("vector", *vector_mds);
+      writer.WriteCellData("uchar", *uchar_mds);
+      writer.WriteCellData("vector", *vector_mds);
+    }
+    EXPECT_EQ(ReadFile("vtk_writer.vtk"), ReadFile("vtk_stream_writer.vtk"));
+  }
+}
+
+TEST(lf_io_VtkStreamWriter, ascii) {
+  auto reader = test_utils::getGmshReader("two_element_hybrid_2d.msh", 2);
+  auto mesh_p = reader.mesh();
+  using lf::mesh::utils::make_LambdaMeshDataSet;
+  auto mds = make_LambdaMeshDataSet(
+      [&](const auto& e) { return 0.1 * mesh_p->Index(e); });
+  {
+    VtkStreamWriter writer(mesh_p, "stream_ascii.vtk", 0,
+                           VtkFile::Format::ASCII);
+    // data sections may alternate
+    writer.WriteCellData("c", *mds);
+    writer.WritePointData("p", *mds);
+    writer.WriteCellData("c2", *mds);
+  }
+  const std::string content = ReadFile("stream_ascii.vtk");
+  EXPECT_NE(content.find("CELLS 2 9\n3 1 2 4\n4 0 3 4 1\n"), std::string::npos);
+  EXPECT_NE(content.find("CELL_DATA 2\nSCALARS c double 1\nLOOKUP_TABLE "
+                         "default\n0\n0.10000000000000001\nPOINT_DATA 5\n"),
+            std::string::npos);
+  EXPECT_NE(content.find("SCALARS p double 1\nLOOKUP_TABLE default\n0\n"
+                         "0.10000000000000001\n0.20000000000000001\n"
+                         "0.30000000000000004\n0.40000000000000002\n"
+                         "CELL_DATA 2\nSCALARS c2"),
+            std::string::npos);
+}
+
+TEST(lf_io_VtkStreamWriter, errors) {
+  auto reader = test_utils::getGmshReader("two_element_hybrid_2d.msh", 2);
+  using lf::mesh::utils::make_LambdaMeshDataSet;
+  auto mds = make_LambdaMeshDataSet([](const auto& e) { return 1; });
+
+  VtkStreamWriter writer(reader.mesh(), "stream_errors.vtk");
+  writer.WriteGlobalData("global", std::vector<int>{0});
+  EXPECT_THROW(writer.WriteGlobalData("global", std::vector<float>{0}),
+               base::LfException);
+  writer.WritePointData("data", *mds);
+  writer.WriteCellData("data", *mds);
+  EXPECT_THROW(writer.WritePointData("data", *mds), base::LfException);
+  EXPECT_THROW(writer.WriteCellData("h w", *mds), base::LfException);
+  // global data has to be written before the point and cell data
+  EXPECT_THROW(writer.WriteGlobalData("late", std::vector<int>{0}),
+               base::LfException);
+  writer.Close();
+  EXPECT_THROW(writer.WriteCellData("closed", *mds), base::LfException);
+}
+
+#ifdef __linux__
+TEST(lf_io_VtkStreamWriter, writeErrors) {
+  auto reader = test_utils::getGmshReader("two_element_hybrid_2d.msh", 2);
+
+  // writing to /dev/full always fails, Close() reports this
+  VtkStreamWriter writer(reader.mesh(), "/dev/full");
+  EXPECT_THROW(writer.Close(), base::LfException);
+
+  // but the destructor must not throw
+  EXPECT_NO_THROW({ VtkStreamWriter(reader.mesh(), "/dev/full"); });
+}
+#endif
+
+}  // namespace lf::io::test
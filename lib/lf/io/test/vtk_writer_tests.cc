@@ -9,8 +9,16 @@
 #include <gtest/gtest.h>
 #include <lf/io/io.h>
 #include <lf/io/test_utils/read_mesh.h>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
 #include "lf/mesh/utils/lambda_mesh_data_set.h"
 
+#ifdef LF_IO_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
 namespace lf::io::test {
 
 template <class T>
@@ -75,6 +83,130 @@ TEST(lf_io_VtkWriter, writeVtkFile) {
   WriteToFile(vtk_file, "all_features_binary.vtk");
 }
 
+// Read the array that follows the first occurrence of `tag` from a vtu file
+// written by WriteToVtuFile() and decompress it (if necessary)
+template <class T>
+std::vector<T> ReadVtuArray(const std::string& filename,
+                            const std::string& tag) {
+  std::ifstream file(filename, std::ios_base::binary);
+  const std::string content((std::istreambuf_iterator<char>(file)),
+                            std::istreambuf_iterator<char>());
+  const auto tag_pos = content.find(tag);
+  EXPECT_NE(tag_pos, std::string::npos) << tag;
+  const auto offset_pos = content.find("offset=\"", tag_pos) + 8;
+  const std::size_t offset = std::stoull(content.substr(offset_pos));
+  const char* data =
+      content.data() + content.find("<AppendedData encoding=\"raw\">\n_") +
+      31 + offset;
+  auto header = [&](int i) {
+    std::uint64_t value;
+    std::memcpy(&value, data + i * sizeof(value), sizeof(value));
+    return value;
+  };
+
+  std::vector<char> bytes;
+  if (content.find("compressor=") == std::string::npos) {
+    bytes.assign(data + 8, data + 8 + header(0));
+  } else {
+#ifdef LF_IO_HAVE_ZLIB
+    EXPECT_NE(content.find("vtkZLibDataCompressor"), std::string::npos);
+    const std::uint64_t num_blocks = header(0);
+    const char* block = data + (3 + num_blocks) * sizeof(std::uint64_t);
+    for (std::uint64_t b = 0; b < num_blocks; ++b) {
+      uLongf block_bytes = (b + 1 == num_blocks && header(2) != 0)
+                               ? header(2)
+                               : header(1);
+      const std::size_t start = bytes.size();
+      bytes.resize(start + block_bytes);
+      EXPECT_EQ(uncompress(reinterpret_cast<Bytef*>(&bytes[start]),
+                           &block_bytes,
+                           reinterpret_cast<const Bytef*>(block),
+                           header(3 + b)),
+                Z_OK);
+      block += header(3 + b);
+    }
+#else
+    ADD_FAILURE() << "cannot decompress " << filename << " without zlib";
+#endif
+  }
+  std::vector<T> result(bytes.size() / sizeof(T));
+  std::memcpy(result.data(), bytes.data(), bytes.size());
+  return result;
+}
+
+TEST(lf_io_VtkWriter, writeVtuFile) {
+  VtkFile vtk_file;
+  vtk_file.header = "this is my test header :)";
+  // a strip of quads with enough points to fill several compression blocks
+  const unsigned int n = 10000;
+  std::vector<double> u;
+  for (unsigned int i = 0; i <= n; ++i) {
+    vtk_file.unstructured_grid.points.emplace_back(i, 0, 0);
+    vtk_file.unstructured_grid.points.emplace_back(i, 1, 0);
+    u.push_back(i % 7);
+    u.push_back(-1.0 * i);
+  }
+  for (unsigned int i = 0; i < n; ++i) {
+    vtk_file.unstructured_grid.cells.push_back(
+        {2 * i, 2 * i + 2, 2 * i + 3, 2 * i + 1});
+    vtk_file.unstructured_grid.cell_types.push_back(
+        VtkFile::CellType::VTK_QUAD);
+  }
+  vtk_file.field_data.push_back(FieldDataArray<double>("time", {0.5}));
+  vtk_file.point_data.push_back(ScalarData<double>("u", u));
+  vtk_file.point_data.push_back(VectorData<float>(
+      "v", std::vector<Eigen::Vector3f>(u.size(), {1, 2, 3})));
+  vtk_file.cell_data.push_back(
+      ScalarData<int>("index", std::vector<int>(n, 4)));
+
+  std::vector<std::size_t> file_sizes;
+  for (auto compression : {VtuCompression::NONE, VtuCompression::ZLIB}) {
+    if (!VtuCompressionSupported(compression)) {
+      EXPECT_THROW(WriteToVtuFile(vtk_file, "all_features.vtu", compression),
+                   base::LfException);
+      continue;
+    }
+    WriteToVtuFile(vtk_file, "all_features.vtu", compression);
+    file_sizes.push_back(
+        std::ifstream("all_features.vtu", std::ios_base::ate).tellg());
+
+    EXPECT_EQ(ReadVtuArray<double>("all_features.vtu", "Name=\"u\""), u);
+    EXPECT_EQ(ReadVtuArray<double>("all_features.vtu", "Name=\"time\""),
+              std::vector<double>{0.5});
+    EXPECT_EQ(ReadVtuArray<int>("all_features.vtu", "Name=\"index\""),
+              std::vector<int>(n, 4));
+    const auto v = ReadVtuArray<float>("all_features.vtu", "Name=\"v\"");
+    ASSERT_EQ(v.size(), 3 * u.size());
+    EXPECT_EQ(v[3], 1.f);
+    EXPECT_EQ(v[5], 3.f);
+    const auto points = ReadVtuArray<float>("all_features.vtu", "<Points>");
+    ASSERT_EQ(points.size(), 6 * (n + 1));
+    EXPECT_EQ(points[6 * n + 3], static_cast<float>(n));
+    EXPECT_EQ(points[6 * n + 4], 1.f);
+    const auto connectivity = ReadVtuArray<unsigned int>(
+        "all_features.vtu", "Name=\"connectivity\"");
+    ASSERT_EQ(connectivity.size(), 4 * n);
+    EXPECT_EQ(connectivity[4 * n - 2], 2 * n + 1);
+    const auto offsets =
+        ReadVtuArray<std::int64_t>("all_features.vtu", "Name=\"offsets\"");
+    ASSERT_EQ(offsets.size(), n);
+    EXPECT_EQ(offsets.back(), 4 * n);
+    EXPECT_EQ(ReadVtuArray<std::uint8_t>("all_features.vtu", "Name=\"types\""),
+              std::vector<std::uint8_t>(n, 9));
+  }
+  if (VtuCompressionSupported(VtuCompression::ZLIB)) {
+    EXPECT_LT(2 * file_sizes[1], file_sizes[0]);
+  }
+
+  if (VtuCompressionSupported(VtuCompression::LZ4)) {
+    WriteToVtuFile(vtk_file, "all_features_lz4.vtu", VtuCompression::LZ4);
+  } else {
+    EXPECT_THROW(WriteToVtuFile(vtk_file, "all_features_lz4.vtu",
+                                VtuCompression::LZ4),
+                 base::LfException);
+  }
+}
+
 TEST(lf_io_VtkWriter, vtkFilewriteOnlyMesh) {
   VtkFile vtk_file;
   vtk_file.header = "this is my test header :)";
@@ -105,6 +237,37 @@ TEST(lf_io_VtkWriter, twoElementMeshCodim1NoData) {
   VtkWriter writer(reader.mesh(), "two_element_1d_nodata.vtk", 1);
 }
 
+TEST(lf_io_VtkWriter, twoElementMeshVtu) {
+  auto reader = test_utils::getGmshReader("two_element_hybrid_2d.msh", 2);
+  using lf::mesh::utils::make_LambdaMeshDataSet;
+  {
+    VtkWriter writer(reader.mesh(), "two_element.vtu");
+    writer.WritePointData("double", *make_LambdaMeshDataSet([&](const auto& e) {
+                            return static_cast<double>(reader.mesh()->Index(e));
+                          }));
+    writer.WriteCellData("int", *make_LambdaMeshDataSet([&](const auto& e) {
+                           return static_cast<int>(reader.mesh()->Index(e));
+                         }));
+  }
+  EXPECT_EQ(ReadVtuArray<double>("two_element.vtu", "Name=\"double\""),
+            std::vector<double>({0, 1, 2, 3, 4}));
+  EXPECT_EQ(ReadVtuArray<int>("two_element.vtu", "Name=\"int\""),
+            std::vector<int>({0, 1}));
+}
+
+TEST(lf_io_VtkWriter, setCompression) {
+  auto reader = test_utils::getGmshReader("two_element_hybrid_2d.msh", 2);
+  VtkWriter writer(reader.mesh(), "two_element_compression.vtu");
+  writer.setCompression(VtuCompression::NONE);
+  for (auto compression : {VtuCompression::ZLIB, VtuCompression::LZ4}) {
+    if (VtuCompressionSupported(compression)) {
+      writer.setCompression(compression);
+    } else {
+      EXPECT_THROW(writer.setCompression(compression), base::LfException);
+    }
+  }
+}
+
 TEST(lf_io_VtkWriter, twoElementMeshCodim0AllData) {
   auto reader = test_utils::getGmshReader("two_element_hybrid_2d.msh", 2);
 
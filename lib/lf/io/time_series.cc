@@ -0,0 +1,489 @@
+/**
+ * @file
+ * @brief Implementation of TimeSeriesWriter and TimeSeriesReader
+ * @author agent
+ * @date   2026-10-19
+ * @copyright MIT License
+ */
+
+#include "time_series.h"
+#include <lf/base/base.h>
+#include <algorithm>
+#include <iomanip>
+#include <limits>
+#include <type_traits>
+#include "vtk_writer_internal.h"
+
+namespace lf::io {
+
+namespace /*anonymous*/ {
+
+constexpr char kMagic[4] = {'L', 'F', 'T', 'S'};
+constexpr std::uint32_t kVersion = 1;
+
+/// Kinds of the records that follow the mesh
+enum class RecordKind : std::uint8_t {
+  STEP = 0,
+  POINT_DATA = 1,
+  CELL_DATA = 2
+};
+
+template <class T>
+struct IsEigenVector : std::false_type {
+  using scalar_t = T;
+};
+
+template <class SCALAR, int ROWS>
+struct IsEigenVector<Eigen::Matrix<SCALAR, ROWS, 1>> : std::true_type {
+  using scalar_t = SCALAR;
+};
+
+template <class T>
+TimeSeriesReader::DataType DataTypeOf() {
+  if constexpr (std::is_same_v<T, int>) {
+    return TimeSeriesReader::DataType::INT32;
+  } else if constexpr (std::is_same_v<T, float>) {
+    return TimeSeriesReader::DataType::FLOAT32;
+  } else {
+    static_assert(std::is_same_v<T, double>, "unsupported data type");
+    return TimeSeriesReader::DataType::FLOAT64;
+  }
+}
+
+std::uint64_t SizeOf(TimeSeriesReader::DataType type) {
+  switch (type) {
+    case TimeSeriesReader::DataType::INT32:
+    case TimeSeriesReader::DataType::FLOAT32:
+      return 4;
+    case TimeSeriesReader::DataType::FLOAT64:
+      return 8;
+    default:
+      throw base::LfException("Unknown data type in time series file.");
+  }
+}
+
+template <class T>
+T ReadRaw(std::istream& stream) {
+  T value;
+  stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+  return value;
+}
+
+}  // namespace
+
+TimeSeriesWriter::TimeSeriesWriter(std::shared_ptr<const mesh::Mesh> mesh,
+                                   std::string filename, dim_t codim)
+    : mesh_(std::move(mesh)), filename_(std::move(filename)), codim_(codim) {
+  const dim_t dim_mesh = mesh_->DimMesh();
+  const dim_t dim_world = mesh_->DimWorld();
+  LF_ASSERT_MSG(dim_world > 0 && dim_world <= 3,
+                "TimeSeriesWriter supports only dim_world = 1,2 or 3");
+  LF_ASSERT_MSG(codim >= 0 && codim < dim_mesh, "codim out of bounds.");
+
+  file_.open(filename_, std::ios_base::out | std::ios_base::binary |
+                            std::ios_base::trunc);
+  if (!file_.is_open()) {
+    throw base::LfException("Could not open file " + filename_ +
+                            " for writing.");
+  }
+  file_.write(kMagic, sizeof(kMagic));
+  WriteRaw(kVersion);
+  WriteRaw(static_cast<std::uint8_t>(detail::IsLittleEndian() ? 1 : 0));
+
+  // points in the order of their indices:
+  const size_type num_points = mesh_->Size(dim_mesh);
+  const Eigen::Matrix<double, 0, 1> zero;
+  WriteRaw(static_cast<std::uint64_t>(num_points));
+  for (size_type i = 0; i < num_points; ++i) {
+    const Eigen::VectorXd coord{
+        mesh_->EntityByIndex(dim_mesh, i)->Geometry()->Global(zero)};
+    for (int d = 0; d < 3; ++d) {
+      WriteRaw(d < dim_world ? static_cast<float>(coord(d)) : 0.f);
+    }
+  }
+
+  // cells: types and offsets first, then the connectivity list
+  const size_type num_cells = mesh_->Size(codim_);
+  std::uint64_t connectivity_size = 0;
+  for (size_type i = 0; i < num_cells; ++i) {
+    connectivity_size += mesh_->EntityByIndex(codim_, i)->RefEl().NumNodes();
+  }
+  WriteRaw(static_cast<std::uint64_t>(num_cells));
+  WriteRaw(connectivity_size);
+  for (size_type i = 0; i < num_cells; ++i) {
+    const base::RefEl ref_el = mesh_->EntityByIndex(codim_, i)->RefEl();
+    VtkFile::CellType type = VtkFile::CellType::VTK_VERTEX;
+    if (ref_el == base::RefEl::kSegment()) {
+      type = VtkFile::CellType::VTK_LINE;
+    } else if (ref_el == base::RefEl::kTria()) {
+      type = VtkFile::CellType::VTK_TRIANGLE;
+    } else if (ref_el == base::RefEl::kQuad()) {
+      type = VtkFile::CellType::VTK_QUAD;
+    }
+    WriteRaw(static_cast<std::uint8_t>(type));
+  }
+  std::uint64_t offset = 0;
+  for (size_type i = 0; i < num_cells; ++i) {
+    offset += mesh_->EntityByIndex(codim_, i)->RefEl().NumNodes();
+    WriteRaw(offset);
+  }
+  for (size_type i = 0; i < num_cells; ++i) {
+    for (const mesh::Entity& p :
+         mesh_->EntityByIndex(codim_, i)->SubEntities(dim_mesh - codim_)) {
+      WriteRaw(static_cast<std::uint32_t>(mesh_->Index(p)));
+    }
+  }
+  file_.flush();
+  if (!file_) {
+    throw base::LfException("Error while writing " + filename_);
+  }
+}
+
+void TimeSeriesWriter::BeginStep(double time) {
+  WriteRaw(static_cast<std::uint8_t>(RecordKind::STEP));
+  WriteRaw(static_cast<std::uint64_t>(sizeof(double)));
+  WriteRaw(time);
+  file_.flush();
+  ++num_steps_;
+  point_data_names_.clear();
+  cell_data_names_.clear();
+}
+
+void TimeSeriesWriter::WritePointData(
+    const std::string& name, const mesh::utils::MeshDataSet<double>& mds,
+    double undefined_value) {
+  WriteData(name, mesh_->DimMesh(), mds, undefined_value);
+}
+
+void TimeSeriesWriter::WritePointData(
+    const std::string& name, const mesh::utils::MeshDataSet<float>& mds,
+    float undefined_value) {
+  WriteData(name, mesh_->DimMesh(), mds, undefined_value);
+}
+
+void TimeSeriesWriter::WritePointData(const std::string& name,
+                                      const mesh::utils::MeshDataSet<int>& mds,
+                                      int undefined_value) {
+  WriteData(name, mesh_->DimMesh(), mds, undefined_value);
+}
+
+void TimeSeriesWriter::WritePointData(
+    const std::string& name,
+    const mesh::utils::MeshDataSet<Eigen::Vector2d>& mds,
+    const Eigen::Vector2d& undefined_value) {
+  WriteData(name, mesh_->DimMesh(), mds, undefined_value);
+}
+
+void TimeSeriesWriter::WritePointData(
+    const std::string& name,
+    const mesh::utils::MeshDataSet<Eigen::Vector3d>& mds,
+    const Eigen::Vector3d& undefined_value) {
+  WriteData(name, mesh_->DimMesh(), mds, undefined_value);
+}
+
+void TimeSeriesWriter::WriteCellData(
+    const std::string& name, const mesh::utils::MeshDataSet<double>& mds,
+    double undefined_value) {
+  WriteData(name, codim_, mds, undefined_value);
+}
+
+void TimeSeriesWriter::WriteCellData(const std::string& name,
+                                     const mesh::utils::MeshDataSet<float>& mds,
+                                     float undefined_value) {
+  WriteData(name, codim_, mds, undefined_value);
+}
+
+void TimeSeriesWriter::WriteCellData(const std::string& name,
+                                     const mesh::utils::MeshDataSet<int>& mds,
+                                     int undefined_value) {
+  WriteData(name, codim_, mds, undefined_value);
+}
+
+void TimeSeriesWriter::WriteCellData(
+    const std::string& name,
+    const mesh::utils::MeshDataSet<Eigen::Vector2d>& mds,
+    const Eigen::Vector2d& undefined_value) {
+  WriteData(name, codim_, mds, undefined_value);
+}
+
+void TimeSeriesWriter::WriteCellData(
+    const std::string& name,
+    const mesh::utils::MeshDataSet<Eigen::Vector3d>& mds,
+    const Eigen::Vector3d& undefined_value) {
+  WriteData(name, codim_, mds, undefined_value);
+}
+
+template <class T>
+void TimeSeriesWriter::WriteData(const std::string& name, dim_t codim,
+                                 const mesh::utils::MeshDataSet<T>& mds,
+                                 const T& undefined_value) {
+  if (num_steps_ == 0) {
+    throw base::LfException(
+        "BeginStep() must be called before data is written.");
+  }
+  const bool is_cell_data = codim == codim_;
+  auto& names = is_cell_data ? cell_data_names_ : point_data_names_;
+  if (std::find(names.begin(), names.end(), name) != names.end()) {
+    throw base::LfException(
+        "There is already another Point/Cell dataset with the name " + name +
+        " in this time step.");
+  }
+  names.push_back(name);
+
+  using scalar_t = typename IsEigenVector<T>::scalar_t;
+  const std::uint8_t num_components = IsEigenVector<T>::value ? 3 : 1;
+  const std::uint64_t num_entities = mesh_->Size(codim);
+  WriteRaw(static_cast<std::uint8_t>(is_cell_data ? RecordKind::CELL_DATA
+                                                  : RecordKind::POINT_DATA));
+  WriteRaw(static_cast<std::uint64_t>(
+      2 + sizeof(std::uint32_t) + name.size() + sizeof(std::uint64_t) +
+      num_entities * num_components * sizeof(scalar_t)));
+  WriteRaw(static_cast<std::uint8_t>(DataTypeOf<scalar_t>()));
+  WriteRaw(num_components);
+  WriteRaw(static_cast<std::uint32_t>(name.size()));
+  file_.write(name.data(), name.size());
+  WriteRaw(num_entities);
+
+  for (std::uint64_t i = 0; i < num_entities; ++i) {
+    const mesh::Entity& e = *mesh_->EntityByIndex(codim, i);
+    const T value = mds.DefinedOn(e) ? mds(e) : undefined_value;
+    if constexpr (IsEigenVector<T>::value) {
+      // pad with zeros to three components
+      for (int d = 0; d < 3; ++d) {
+        WriteRaw(d < value.rows() ? value(d) : scalar_t(0));
+      }
+    } else {
+      WriteRaw(value);
+    }
+  }
+  file_.flush();
+  if (!file_) {
+    throw base::LfException("Error while writing " + filename_);
+  }
+}
+
+TimeSeriesReader::TimeSeriesReader(const std::string& filename)
+    : filename_(filename) {
+  std::ifstream file(filename_, std::ios_base::in | std::ios_base::binary);
+  if (!file.is_open()) {
+    throw base::LfException("Could not open file " + filename_ +
+                            " for reading.");
+  }
+  char magic[sizeof(kMagic)];
+  file.read(magic, sizeof(magic));
+  if (!file || !std::equal(magic, magic + sizeof(magic), kMagic)) {
+    throw base::LfException(filename_ + " is not a time series file.");
+  }
+  if (ReadRaw<std::uint32_t>(file) != kVersion) {
+    throw base::LfException("Unsupported version of time series file " +
+                            filename_);
+  }
+  if ((ReadRaw<std::uint8_t>(file) == 1) != detail::IsLittleEndian()) {
+    throw base::LfException("The byte order of " + filename_ +
+                            " differs from the one of this machine.");
+  }
+
+  // read the mesh:
+  grid_.points.resize(ReadRaw<std::uint64_t>(file));
+  for (auto& p : grid_.points) {
+    file.read(reinterpret_cast<char*>(p.data()), 3 * sizeof(float));
+  }
+  const auto num_cells = ReadRaw<std::uint64_t>(file);
+  const auto connectivity_size = ReadRaw<std::uint64_t>(file);
+  if (!file) {
+    throw base::LfException("Could not read the mesh from " + filename_);
+  }
+  grid_.cell_types.resize(num_cells);
+  for (auto& type : grid_.cell_types) {
+    type = static_cast<VtkFile::CellType>(ReadRaw<std::uint8_t>(file));
+  }
+  std::vector<std::uint64_t> offsets(num_cells);
+  file.read(reinterpret_cast<char*>(offsets.data()),
+            num_cells * sizeof(std::uint64_t));
+  std::vector<std::uint32_t> connectivity(connectivity_size);
+  file.read(reinterpret_cast<char*>(connectivity.data()),
+            connectivity_size * sizeof(std::uint32_t));
+  if (!file || (num_cells > 0 && offsets.back() != connectivity_size)) {
+    throw base::LfException("Could not read the mesh from " + filename_);
+  }
+  grid_.cells.resize(num_cells);
+  for (std::uint64_t i = 0; i < num_cells; ++i) {
+    grid_.cells[i].assign(connectivity.begin() + (i > 0 ? offsets[i - 1] : 0),
+                          connectivity.begin() + offsets[i]);
+  }
+
+  // index the records, only their headers are read:
+  const std::streamoff records_start = file.tellg();
+  file.seekg(0, std::ios_base::end);
+  const std::streamoff file_size = file.tellg();
+  file.seekg(records_start);
+  while (true) {
+    const auto kind = ReadRaw<std::uint8_t>(file);
+    const auto payload_size = ReadRaw<std::uint64_t>(file);
+    if (!file) {
+      break;
+    }
+    const std::streamoff payload_start = file.tellg();
+    if (payload_start + static_cast<std::streamoff>(payload_size) >
+        file_size) {
+      // incomplete record at the end of the file
+      break;
+    }
+    if (kind == static_cast<std::uint8_t>(RecordKind::STEP)) {
+      steps_.push_back({ReadRaw<double>(file), {}});
+    } else if (kind == static_cast<std::uint8_t>(RecordKind::POINT_DATA) ||
+               kind == static_cast<std::uint8_t>(RecordKind::CELL_DATA)) {
+      if (steps_.empty()) {
+        throw base::LfException("Dataset without time step in " + filename_);
+      }
+      DataSetInfo info;
+      info.cell_data = kind == static_cast<std::uint8_t>(RecordKind::CELL_DATA);
+      info.type = static_cast<DataType>(ReadRaw<std::uint8_t>(file));
+      info.num_components = ReadRaw<std::uint8_t>(file);
+      info.name.resize(ReadRaw<std::uint32_t>(file));
+      file.read(info.name.data(), info.name.size());
+      info.num_entities = ReadRaw<std::uint64_t>(file);
+      info.position = file.tellg();
+      if (!file || info.position - payload_start +
+                           info.num_entities * info.num_components *
+                               SizeOf(info.type) !=
+                       payload_size) {
+        throw base::LfException("Corrupt dataset in " + filename_);
+      }
+      steps_.back().data_sets.push_back(std::move(info));
+    }
+    // records of unknown kind are skipped
+    file.seekg(payload_start + static_cast<std::streamoff>(payload_size));
+  }
+}
+
+const TimeSeriesReader::DataSetInfo& TimeSeriesReader::FindDataSet(
+    size_type step, const std::string& name, bool cell_data) const {
+  const auto& data_sets = DataSets(step);
+  auto it = std::find_if(data_sets.begin(), data_sets.end(), [&](auto& d) {
+    return d.name == name && d.cell_data == cell_data;
+  });
+  if (it == data_sets.end()) {
+    throw base::LfException("Time step " + std::to_string(step) +
+                            " has no dataset with name " + name);
+  }
+  return *it;
+}
+
+template <class T>
+std::vector<T> TimeSeriesReader::ReadData(size_type step,
+                                          const std::string& name,
+                                          bool cell_data) const {
+  const DataSetInfo& info = FindDataSet(step, name, cell_data);
+  if (info.type != DataTypeOf<T>()) {
+    throw base::LfException("Dataset " + name +
+                            " has a different data type.");
+  }
+  std::vector<T> result(info.num_entities * info.num_components);
+  std::ifstream file(filename_, std::ios_base::in | std::ios_base::binary);
+  file.seekg(info.position);
+  file.read(reinterpret_cast<char*>(result.data()), result.size() * sizeof(T));
+  if (!file) {
+    throw base::LfException("Could not read dataset " + name + " from " +
+                            filename_);
+  }
+  return result;
+}
+
+template std::vector<int> TimeSeriesReader::ReadData(size_type,
+                                                     const std::string&,
+                                                     bool) const;
+template std::vector<float> TimeSeriesReader::ReadData(size_type,
+                                                       const std::string&,
+                                                       bool) const;
+template std::vector<double> TimeSeriesReader::ReadData(size_type,
+                                                        const std::string&,
+                                                        bool) const;
+
+namespace /*anonymous*/ {
+
+template <class T>
+void AddAttribute(VtkFile::Attributes& attributes,
+                  const TimeSeriesReader::DataSetInfo& info,
+                  std::vector<T> data) {
+  if (info.num_components == 1) {
+    attributes.push_back(VtkFile::ScalarData<T>(info.name, std::move(data)));
+    return;
+  }
+  if constexpr (std::is_floating_point_v<T>) {
+    if (info.num_components == 3) {
+      std::vector<Eigen::Matrix<T, 3, 1>> vectors(info.num_entities);
+      for (std::size_t i = 0; i < vectors.size(); ++i) {
+        vectors[i] = Eigen::Map<const Eigen::Matrix<T, 3, 1>>(&data[3 * i]);
+      }
+      attributes.push_back(
+          VtkFile::VectorData<T>(info.name, std::move(vectors)));
+      return;
+    }
+  }
+  throw base::LfException("Unsupported number of components of dataset " +
+                          info.name);
+}
+
+}  // namespace
+
+VtkFile TimeSeriesReader::ReadStep(size_type step) const {
+  VtkFile vtk_file;
+  vtk_file.unstructured_grid = grid_;
+  vtk_file.field_data.push_back(
+      VtkFile::FieldDataArray<double>("TIME", {Time(step)}));
+  for (const DataSetInfo& info : DataSets(step)) {
+    auto& attributes =
+        info.cell_data ? vtk_file.cell_data : vtk_file.point_data;
+    switch (info.type) {
+      case DataType::INT32:
+        AddAttribute(attributes, info,
+                     ReadData<int>(step, info.name, info.cell_data));
+        break;
+      case DataType::FLOAT32:
+        AddAttribute(attributes, info,
+                     ReadData<float>(step, info.name, info.cell_data));
+        break;
+      case DataType::FLOAT64:
+        AddAttribute(attributes, info,
+                     ReadData<double>(step, info.name, info.cell_data));
+        break;
+      default:
+        throw base::LfException("Unknown data type of dataset " + info.name);
+    }
+  }
+  return vtk_file;
+}
+
+void WriteTimeSeriesToVtu(const std::string& filename,
+                          const std::string& basename,
+                          VtuCompression compression) {
+  const TimeSeriesReader reader(filename);
+  // the pvd file refers to the vtu files relative to its own location
+  const auto slash = basename.find_last_of("/\\");
+  const std::string local_basename =
+      slash == std::string::npos ? basename : basename.substr(slash + 1);
+
+  std::ofstream pvd(basename + ".pvd");
+  if (!pvd.is_open()) {
+    throw base::LfException("Could not open file " + basename +
+                            ".pvd for writing.");
+  }
+  pvd << "<?xml version=\"1.0\"?>\n"
+      << "<VTKFile type=\"Collection\" version=\"0.1\">\n<Collection>\n"
+      << std::setprecision(std::numeric_limits<double>::max_digits10);
+  for (TimeSeriesReader::size_type step = 0; step < reader.NumSteps();
+       ++step) {
+    const std::string vtu_name = "_" + std::to_string(step) + ".vtu";
+    WriteToVtuFile(reader.ReadStep(step), basename + vtu_name, compression);
+    pvd << "<DataSet timestep=\"" << reader.Time(step)
+        << "\" part=\"0\" file=\"" << local_basename << vtu_name << "\"/>\n";
+  }
+  pvd << "</Collection>\n</VTKFile>\n";
+  pvd.close();
+  if (!pvd) {
+    throw base::LfException("Error while writing " + basename + ".pvd");
+  }
+}
+
+}  // namespace lf::io
@@ -0,0 +1,326 @@
+/**
+ * @file
+ * @brief Declares TimeSeriesWriter and TimeSeriesReader which store the
+ *        results of transient simulations with a single copy of the mesh
+ * @author agent
+ * @date   2026-10-19
+ * @copyright MIT License
+ */
+
+#ifndef __e964202b5dc9479dbd5019544b19319a
+#define __e964202b5dc9479dbd5019544b19319a
+
+#include <lf/mesh/mesh.h>
+#include <lf/mesh/utils/utils.h>
+#include <Eigen/Eigen>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "vtk_writer.h"
+
+namespace lf::io {
+
+/**
+ * @brief Write the point and cell data of many time steps into one file that
+ *        contains the mesh only once.
+ *
+ * A VtkWriter writes the full mesh into every file, so a transient
+ * simulation with many time steps spends most of its output on identical
+ * copies of the mesh. TimeSeriesWriter instead writes the points and cells of
+ * the mesh once when it is constructed. Afterwards every time step only
+ * appends its datasets to the same file, i.e. the cost of a time step is
+ * proportional to the size of the data written for it.
+ *
+ * The datasets are evaluated entity by entity and streamed to the file
+ * directly, nothing is kept in memory. The file is flushed after every
+ * dataset, so it can already be read (by a TimeSeriesReader) while the
+ * simulation is still running. If the simulation is aborted, all completely
+ * written datasets can be read.
+ *
+ * #### Sample usage:
+ * @code
+ * TimeSeriesWriter writer(mesh_p, "solution.lfts");
+ * for (int step = 0; step < num_steps; ++step) {
+ *   // ... compute solution at time t
+ *   writer.BeginStep(t);
+ *   writer.WritePointData("u", u_mds);
+ *   writer.WriteCellData("error", error_mds);
+ * }
+ * @endcode
+ * Use TimeSeriesReader to read the data or WriteTimeSeriesToVtu() to convert
+ * the file into a ParaView collection.
+ *
+ * #### File format
+ * The file starts with the magic bytes `LFTS`, the format version (UInt32),
+ * and a byte that is 1 if the file is little endian. Then follow the number
+ * of points (UInt64), their coordinates (3 x Float32 per point), the number
+ * of cells (UInt64), the length of the connectivity list (UInt64), the VTK
+ * cell types (UInt8 per cell), the end offsets of the cells in the
+ * connectivity list (UInt64 per cell) and the connectivity list (UInt32).
+ *
+ * The rest of the file is a sequence of records, each consisting of a kind
+ * byte, the number of bytes of the payload (UInt64) and the payload. A record
+ * of kind `0` starts a new time step, its payload is the time (Float64).
+ * Records of kind `1` (point data) and `2` (cell data) contain a dataset:
+ * the data type (UInt8, see TimeSeriesReader::DataType), the number of
+ * components (UInt8), the length of the name (UInt32), the name, the number
+ * of entities (UInt64) and the values. All values are stored in the byte
+ * order of the writing machine.
+ */
+class TimeSeriesWriter {
+ public:
+  using dim_t = base::dim_t;
+  using size_type = mesh::Mesh::size_type;
+
+  TimeSeriesWriter(const TimeSeriesWriter&) = delete;
+  TimeSeriesWriter(TimeSeriesWriter&&) = delete;
+  TimeSeriesWriter& operator=(const TimeSeriesWriter&) = delete;
+  TimeSeriesWriter& operator=(TimeSeriesWriter&&) = delete;
+
+  /**
+   * @brief Create a new time series file and write the mesh into it.
+   * @param mesh The underlying mesh
+   * @param filename The name of the file, it is overwritten if it exists.
+   * @param codim (Optional) the codimension of the cells, see
+   *              VtkWriter::VtkWriter()
+   */
+  TimeSeriesWriter(std::shared_ptr<const mesh::Mesh> mesh,
+                   std::string filename, dim_t codim = 0);
+
+  /**
+   * @brief Start a new time step, all following datasets belong to it.
+   * @param time The time of the new step
+   */
+  void BeginStep(double time);
+
+  /**
+   * @brief Append a `double` dataset that attaches data to the points of the
+   *        mesh to the current time step.
+   * @param name The name of the dataset, must be unique within the step.
+   * @param mds The mesh dataset that that attaches the data to the points of
+   *            the mesh.
+   * @param undefined_value The value that should be written for a point to
+   * which `mds` does not attach data (i.e. if `mds.DefinedOn() == false`)
+   */
+  void WritePointData(const std::string& name,
+                      const mesh::utils::MeshDataSet<double>& mds,
+                      double undefined_value = 0.);
+
+  /**
+   * @brief Append a `float` point dataset to the current time step, see
+   *        WritePointData(const std::string&, const mesh::utils::MeshDataSet<double>&, double)
+   */
+  void WritePointData(const std::string& name,
+                      const mesh::utils::MeshDataSet<float>& mds,
+                      float undefined_value = 0.f);
+
+  /**
+   * @brief Append an `int` point dataset to the current time step, see
+   *        WritePointData(const std::string&, const mesh::utils::MeshDataSet<double>&, double)
+   */
+  void WritePointData(const std::string& name,
+                      const mesh::utils::MeshDataSet<int>& mds,
+                      int undefined_value = 0);
+
+  /**
+   * @brief Append a vector dataset to the current time step, see
+   *        WritePointData(const std::string&, const mesh::utils::MeshDataSet<double>&, double)
+   *
+   * The vectors are padded with a zero to three components.
+   */
+  void WritePointData(const std::string& name,
+                      const mesh::utils::MeshDataSet<Eigen::Vector2d>& mds,
+                      const Eigen::Vector2d& undefined_value = {0, 0});
+
+  /**
+   * @brief Append a vector dataset to the current time step, see
+   *        WritePointData(const std::string&, const mesh::utils::MeshDataSet<double>&, double)
+   */
+  void WritePointData(const std::string& name,
+                      const mesh::utils::MeshDataSet<Eigen::Vector3d>& mds,
+                      const Eigen::Vector3d& undefined_value = {0, 0, 0});
+
+  /**
+   * @brief Append a `double` dataset that attaches data to the cells of the
+   *        mesh (i.e. to entities with codim = "codim that was specified in
+   *        the constructor") to the current time step.
+   * @param name The name of the dataset, must be unique within the step.
+   * @param mds The mesh dataset that that attaches the data to the cells of
+   *            the mesh.
+   * @param undefined_value The value that should be written for a cell to
+   * which `mds` does not attach data (i.e. if `mds.DefinedOn() == false`)
+   */
+  void WriteCellData(const std::string& name,
+                     const mesh::utils::MeshDataSet<double>& mds,
+                     double undefined_value = 0.);
+
+  /**
+   * @brief Append a `float` cell dataset to the current time step, see
+   *        WriteCellData(const std::string&, const mesh::utils::MeshDataSet<double>&, double)
+   */
+  void WriteCellData(const std::string& name,
+                     const mesh::utils::MeshDataSet<float>& mds,
+                     float undefined_value = 0.f);
+
+  /**
+   * @brief Append an `int` cell dataset to the current time step, see
+   *        WriteCellData(const std::string&, const mesh::utils::MeshDataSet<double>&, double)
+   */
+  void WriteCellData(const std::string& name,
+                     const mesh::utils::MeshDataSet<int>& mds,
+                     int undefined_value = 0);
+
+  /**
+   * @brief Append a vector cell dataset to the current time step, see
+   *        WriteCellData(const std::string&, const mesh::utils::MeshDataSet<double>&, double)
+   *
+   * The vectors are padded with a zero to three components.
+   */
+  void WriteCellData(const std::string& name,
+                     const mesh::utils::MeshDataSet<Eigen::Vector2d>& mds,
+                     const Eigen::Vector2d& undefined_value = {0, 0});
+
+  /**
+   * @brief Append a vector cell dataset to the current time step, see
+   *        WriteCellData(const std::string&, const mesh::utils::MeshDataSet<double>&, double)
+   */
+  void WriteCellData(const std::string& name,
+                     const mesh::utils::MeshDataSet<Eigen::Vector3d>& mds,
+                     const Eigen::Vector3d& undefined_value = {0, 0, 0});
+
+  /**
+   * @brief The number of time steps that have been started so far.
+   */
+  [[nodiscard]] size_type NumSteps() const { return num_steps_; }
+
+ private:
+  std::shared_ptr<const mesh::Mesh> mesh_;
+  std::string filename_;
+  dim_t codim_;
+  std::ofstream file_;
+  size_type num_steps_ = 0;
+  // names of the datasets of the current time step
+  std::vector<std::string> point_data_names_;
+  std::vector<std::string> cell_data_names_;
+
+  template <class T>
+  void WriteRaw(const T& value) {
+    file_.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  template <class T>
+  void WriteData(const std::string& name, dim_t codim,
+                 const mesh::utils::MeshDataSet<T>& mds,
+                 const T& undefined_value);
+};
+
+/**
+ * @brief Read a file written by TimeSeriesWriter.
+ *
+ * The constructor reads the mesh and an index of all time steps and datasets
+ * in the file. The datasets themselves are only read on request, so the
+ * data of a single time step can be retrieved without reading the whole
+ * file.
+ */
+class TimeSeriesReader {
+ public:
+  using size_type = std::uint64_t;
+
+  /// Data types of datasets, the value is stored in the file
+  enum class DataType : std::uint8_t { INT32 = 0, FLOAT32 = 1, FLOAT64 = 2 };
+
+  /// Describes one dataset of a time step
+  struct DataSetInfo {
+    std::string name;
+    /// true for cell data, false for point data
+    bool cell_data;
+    DataType type;
+    /// 1 for scalar data, 3 for vector data
+    unsigned int num_components;
+    /// number of points or cells
+    size_type num_entities;
+    /// position of the first value in the file
+    std::streamoff position;
+  };
+
+  /**
+   * @brief Open a time series file, read the mesh and index the time steps.
+   * @param filename The name of the file written by TimeSeriesWriter
+   *
+   * A dataset at the end of the file that was not written completely (e.g.
+   * because the simulation crashed) is ignored.
+   */
+  explicit TimeSeriesReader(const std::string& filename);
+
+  /// The number of time steps in the file
+  [[nodiscard]] size_type NumSteps() const { return steps_.size(); }
+
+  /// The time of a time step
+  [[nodiscard]] double Time(size_type step) const {
+    return steps_.at(step).time;
+  }
+
+  /// The datasets of a time step
+  [[nodiscard]] const std::vector<DataSetInfo>& DataSets(
+      size_type step) const {
+    return steps_.at(step).data_sets;
+  }
+
+  /// The points and cells of the mesh
+  [[nodiscard]] const VtkFile::UnstructuredGrid& Grid() const { return grid_; }
+
+  /**
+   * @brief Read the values of a dataset
+   * @tparam T `int`, `float` or `double`, must match DataSetInfo::type
+   * @param step The time step
+   * @param name The name of the dataset
+   * @param cell_data true to read cell data, false to read point data
+   * @return The values of the dataset, for vector data the three
+   *         components of each entity are stored consecutively.
+   */
+  template <class T>
+  std::vector<T> ReadData(size_type step, const std::string& name,
+                          bool cell_data) const;
+
+  /**
+   * @brief Assemble the mesh and all datasets of a time step in a VtkFile,
+   *        e.g. to write it with WriteToVtuFile()
+   *
+   * The time is stored as global data with the name `TIME`.
+   */
+  [[nodiscard]] VtkFile ReadStep(size_type step) const;
+
+ private:
+  struct Step {
+    double time;
+    std::vector<DataSetInfo> data_sets;
+  };
+
+  std::string filename_;
+  VtkFile::UnstructuredGrid grid_;
+  std::vector<Step> steps_;
+
+  [[nodiscard]] const DataSetInfo& FindDataSet(size_type step,
+                                               const std::string& name,
+                                               bool cell_data) const;
+};
+
+/**
+ * @brief Convert a time series file into one `*.vtu` file per time step and
+ *        a ParaView collection file (`*.pvd`) that lists them.
+ * @param filename The name of the file written by TimeSeriesWriter
+ * @param basename The output files are called `<basename>_<step>.vtu` and
+ *                 `<basename>.pvd`
+ * @param compression The compression of the `*.vtu` files
+ *
+ * The `*.vtu` files contain a copy of the mesh each, so this conversion is
+ * meant for post-processing, not for the output of the simulation itself.
+ */
+void WriteTimeSeriesToVtu(const std::string& filename,
+                          const std::string& basename,
+                          VtuCompression compression = DefaultVtuCompression());
+
+}  // namespace lf::io
+
+#endif  // __e964202b5dc9479dbd5019544b19319a
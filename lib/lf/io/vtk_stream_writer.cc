@@ -0,0 +1,405 @@
+/**
+ * @file
+ * @brief Implementation of VtkStreamWriter
+ * @author agent
+ * @date   2026-10-19
+ * @copyright MIT License
+ */
+
+#include "vtk_stream_writer.h"
+#include <lf/base/base.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <limits>
+#include <type_traits>
+#include "vtk_writer_internal.h"
+
+namespace lf::io {
+
+namespace /*anonymous*/ {
+
+template <class T>
+struct IsEigenVector : std::false_type {};
+
+template <class SCALAR, int ROWS>
+struct IsEigenVector<Eigen::Matrix<SCALAR, ROWS, 1>> : std::true_type {};
+
+/// Name of the data type `T` in the legacy vtk format
+template <class T>
+const char* LegacyTypeName() {
+  if constexpr (std::is_same_v<T, char> || std::is_same_v<T, unsigned char>) {
+    return "char";
+  } else if constexpr (std::is_same_v<T, int>) {
+    return "int";
+  } else if constexpr (std::is_same_v<T, unsigned int>) {
+    return "unsigned_int";
+  } else if constexpr (std::is_same_v<T, float>) {
+    return "float";
+  } else {
+    static_assert(std::is_same_v<T, double>, "unsupported data type");
+    return "double";
+  }
+}
+
+}  // namespace
+
+VtkStreamWriter::VtkStreamWriter(std::shared_ptr<const mesh::Mesh> mesh,
+                                 std::string filename, dim_t codim,
+                                 VtkFile::Format format)
+    : mesh_(std::move(mesh)),
+      filename_(std::move(filename)),
+      codim_(codim),
+      binary_(format == VtkFile::Format::BINARY) {
+  const dim_t dim_mesh = mesh_->DimMesh();
+  const dim_t dim_world = mesh_->DimWorld();
+  LF_ASSERT_MSG(dim_world > 0 && dim_world <= 3,
+                "VtkStreamWriter supports only dim_world = 1,2 or 3");
+  LF_ASSERT_MSG(codim >= 0 && codim < dim_mesh, "codim out of bounds.");
+
+  file_.open(filename_, std::ios_base::out | std::ios_base::binary |
+                            std::ios_base::trunc);
+  if (!file_.is_open()) {
+    throw base::LfException("Could not open file " + filename_ +
+                            " for writing.");
+  }
+  file_ << "# vtk DataFile Version 3.0\n\n"
+        << (binary_ ? "BINARY" : "ASCII") << "\nDATASET UNSTRUCTURED_GRID\n";
+
+  // write nodes in the order of their indices:
+  const size_type num_points = mesh_->Size(dim_mesh);
+  const Eigen::Matrix<double, 0, 1> zero;
+  file_ << "POINTS " << num_points << " float\n";
+  for (size_type i = 0; i < num_points; ++i) {
+    const Eigen::VectorXd coord{
+        mesh_->EntityByIndex(dim_mesh, i)->Geometry()->Global(zero)};
+    for (int d = 0; d < 3; ++d) {
+      WriteValue(d < dim_world ? static_cast<float>(coord(d)) : 0.f);
+      if (!binary_) {
+        file_ << (d < 2 ? ' ' : '\n');
+      }
+    }
+  }
+
+  // write cells, first determine the length of the cell list:
+  const size_type num_cells = mesh_->Size(codim_);
+  size_type cell_list_size = num_cells;
+  for (size_type i = 0; i < num_cells; ++i) {
+    cell_list_size += mesh_->EntityByIndex(codim_, i)->RefEl().NumNodes();
+  }
+  file_ << (binary_ ? "\n" : "") << "CELLS " << num_cells << ' '
+        << cell_list_size << '\n';
+  for (size_type i = 0; i < num_cells; ++i) {
+    const mesh::Entity* e = mesh_->EntityByIndex(codim_, i);
+    WriteValue(static_cast<int>(e->RefEl().NumNodes()));
+    for (const mesh::Entity& p : e->SubEntities(dim_mesh - codim_)) {
+      if (!binary_) {
+        file_ << ' ';
+      }
+      WriteValue(static_cast<int>(mesh_->Index(p)));
+    }
+    if (!binary_) {
+      file_ << '\n';
+    }
+  }
+
+  file_ << (binary_ ? "\n" : "") << "CELL_TYPES " << num_cells << '\n';
+  for (size_type i = 0; i < num_cells; ++i) {
+    const base::RefEl ref_el = mesh_->EntityByIndex(codim_, i)->RefEl();
+    VtkFile::CellType type = VtkFile::CellType::VTK_VERTEX;
+    if (ref_el == base::RefEl::kSegment()) {
+      type = VtkFile::CellType::VTK_LINE;
+    } else if (ref_el == base::RefEl::kTria()) {
+      type = VtkFile::CellType::VTK_TRIANGLE;
+    } else if (ref_el == base::RefEl::kQuad()) {
+      type = VtkFile::CellType::VTK_QUAD;
+    }
+    WriteValue(static_cast<int>(type));
+    if (!binary_) {
+      file_ << '\n';
+    }
+  }
+  file_ << (binary_ ? "\n" : "");
+}
+
+void VtkStreamWriter::WritePointData(
+    const std::string& name, const mesh::utils::MeshDataSet<unsigned char>& mds,
+    unsigned char undefined_value) {
+  WriteAttribute(name, mesh_->DimMesh(), mds, undefined_value);
+}
+
+void VtkStreamWriter::WritePointData(const std::string& name,
+                                     const mesh::utils::MeshDataSet<char>& mds,
+                                     char undefined_value) {
+  WriteAttribute(name, mesh_->DimMesh(), mds, undefined_value);
+}
+
+void VtkStreamWriter::WritePointData(
+    const std::string& name, const mesh::utils::MeshDataSet<unsigned>& mds,
+    unsigned undefined_value) {
+  WriteAttribute(name, mesh_->DimMesh(), mds, undefined_value);
+}
+
+void VtkStreamWriter::WritePointData(const std::string& name,
+                                     const mesh::utils::MeshDataSet<int>& mds,
+                                     int undefined_value) {
+  WriteAttribute(name, mesh_->DimMesh(), mds, undefined_value);
+}
+
+void VtkStreamWriter::WritePointData(const std::string& name,
+                                     const mesh::utils::MeshDataSet<float>& mds,
+                                     float undefined_value) {
+  WriteAttribute(name, mesh_->DimMesh(), mds, undefined_value);
+}
+
+void VtkStreamWriter::WritePointData(
+    const std::string& name, const mesh::utils::MeshDataSet<double>& mds,
+    double undefined_value) {
+  WriteAttribute(name, mesh_->DimMesh(), mds, undefined_value);
+}
+
+void VtkStreamWriter::WritePointData(
+    const std::string& name,
+    const mesh::utils::MeshDataSet<Eigen::Vector2d>& mds,
+    const Eigen::Vector2d& undefined_value) {
+  WriteAttribute(name, mesh_->DimMesh(), mds, undefined_value);
+}
+
+void VtkStreamWriter::WritePointData(
+    const std::string& name,
+    const mesh::utils::MeshDataSet<Eigen::Vector2f>& mds,
+    const Eigen::Vector2f& undefined_value) {
+  WriteAttribute(name, mesh_->DimMesh(), mds, undefined_value);
+}
+
+void VtkStreamWriter::WritePointData(
+    const std::string& name,
+    const mesh::utils::MeshDataSet<Eigen::Vector3d>& mds,
+    const Eigen::Vector3d& undefined_value) {
+  WriteAttribute(name, mesh_->DimMesh(), mds, undefined_value);
+}
+
+void VtkStreamWriter::WritePointData(
+    const std::string& name,
+    const mesh::utils::MeshDataSet<Eigen::Vector3f>& mds,
+    const Eigen::Vector3f& undefined_value) {
+  WriteAttribute(name, mesh_->DimMesh(), mds, undefined_value);
+}
+
+void VtkStreamWriter::WriteCellData(
+    const std::string& name, const mesh::utils::MeshDataSet<unsigned char>& mds,
+    unsigned char undefined_value) {
+  WriteAttribute(name, codim_, mds, undefined_value);
+}
+
+void VtkStreamWriter::WriteCellData(const std::string& name,
+                                    const mesh::utils::MeshDataSet<char>& mds,
+                                    char undefined_value) {
+  WriteAttribute(name, codim_, mds, undefined_value);
+}
+
+void VtkStreamWriter::WriteCellData(
+    const std::string& name, const mesh::utils::MeshDataSet<unsigned>& mds,
+    unsigned undefined_value) {
+  WriteAttribute(name, codim_, mds, undefined_value);
+}
+
+void VtkStreamWriter::WriteCellData(const std::string& name,
+                                    const mesh::utils::MeshDataSet<int>& mds,
+                                    int undefined_value) {
+  WriteAttribute(name, codim_, mds, undefined_value);
+}
+
+void VtkStreamWriter::WriteCellData(const std::string& name,
+                                    const mesh::utils::MeshDataSet<float>& mds,
+                                    float undefined_value) {
+  WriteAttribute(name, codim_, mds, undefined_value);
+}
+
+void VtkStreamWriter::WriteCellData(const std::string& name,
+                                    const mesh::utils::MeshDataSet<double>& mds,
+                                    double undefined_value) {
+  WriteAttribute(name, codim_, mds, undefined_value);
+}
+
+void VtkStreamWriter::WriteCellData(
+    const std::string& name,
+    const mesh::utils::MeshDataSet<Eigen::Vector2d>& mds,
+    const Eigen::Vector2d& undefined_value) {
+  WriteAttribute(name, codim_, mds, undefined_value);
+}
+
+void VtkStreamWriter::WriteCellData(
+    const std::string& name,
+    const mesh::utils::MeshDataSet<Eigen::Vector2f>& mds,
+    const Eigen::Vector2f& undefined_value) {
+  WriteAttribute(name, codim_, mds, undefined_value);
+}
+
+void VtkStreamWriter::WriteCellData(
+    const std::string& name,
+    const mesh::utils::MeshDataSet<Eigen::Vector3d>& mds,
+    const Eigen::Vector3d& undefined_value) {
+  WriteAttribute(name, codim_, mds, undefined_value);
+}
+
+void VtkStreamWriter::WriteCellData(
+    const std::string& name,
+    const mesh::utils::MeshDataSet<Eigen::Vector3f>& mds,
+    const Eigen::Vector3f& undefined_value) {
+  WriteAttribute(name, codim_, mds, undefined_value);
+}
+
+void VtkStreamWriter::WriteGlobalData(const std::string& name,
+                                      std::vector<int> data) {
+  WriteFieldData(name, std::move(data));
+}
+
+void VtkStreamWriter::WriteGlobalData(const std::string& name,
+                                      std::vector<float> data) {
+  WriteFieldData(name, std::move(data));
+}
+
+void VtkStreamWriter::WriteGlobalData(const std::string& name,
+                                      std::vector<double> data) {
+  WriteFieldData(name, std::move(data));
+}
+
+void VtkStreamWriter::Close() {
+  if (!file_.is_open()) {
+    return;
+  }
+  if (section_ == Section::MESH) {
+    BeginSection(Section::MESH);
+  }
+  file_.close();
+  if (!file_) {
+    throw base::LfException("Error while writing " + filename_);
+  }
+}
+
+VtkStreamWriter::~VtkStreamWriter() {
+  try {
+    Close();
+  } catch (...) {
+    // A destructor must not throw, call Close() to be notified of errors.
+  }
+}
+
+void VtkStreamWriter::BeginSection(Section section) {
+  if (!file_.is_open()) {
+    throw base::LfException("VtkStreamWriter for " + filename_ +
+                            " has already been closed.");
+  }
+  if (section_ == Section::MESH && !field_data_.empty()) {
+    file_ << "FIELD FieldData " << field_data_.size() << '\n';
+    for (const auto& d : field_data_) {
+      boost::apply_visitor(
+          [&](const auto& array) {
+            using T = typename std::decay_t<decltype(array.data)>::value_type;
+            file_ << array.name << " 1 " << array.data.size() << ' '
+                  << LegacyTypeName<T>() << '\n';
+            for (std::size_t i = 0; i < array.data.size(); ++i) {
+              if (!binary_ && i > 0) {
+                file_ << ' ';
+              }
+              WriteValue(array.data[i]);
+            }
+            file_ << '\n';
+          },
+          d);
+    }
+    field_data_.clear();
+  }
+  if (section != section_) {
+    if (section == Section::POINT_DATA) {
+      file_ << "POINT_DATA " << mesh_->Size(mesh_->DimMesh()) << '\n';
+    } else if (section == Section::CELL_DATA) {
+      file_ << "CELL_DATA " << mesh_->Size(codim_) << '\n';
+    }
+    section_ = section;
+  }
+}
+
+template <class T>
+void VtkStreamWriter::WriteValue(T value) {
+  if (binary_) {
+    // legacy binary vtk files are big endian
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    if (detail::IsLittleEndian()) {
+      std::reverse(bytes, bytes + sizeof(T));
+    }
+    file_.write(bytes, sizeof(T));
+  } else if constexpr (sizeof(T) == 1) {
+    file_ << static_cast<int>(value);
+  } else {
+    file_ << std::setprecision(std::numeric_limits<T>::max_digits10) << value;
+  }
+}
+
+template <class T>
+void VtkStreamWriter::WriteAttribute(const std::string& name, dim_t codim,
+                                     const mesh::utils::MeshDataSet<T>& mds,
+                                     const T& undefined_value) {
+  const bool is_cell_data = codim == codim_;
+  auto& names = is_cell_data ? cell_data_names_ : point_data_names_;
+  detail::CheckAttributeSetName(names, name);
+  names.push_back(name);
+  BeginSection(is_cell_data ? Section::CELL_DATA : Section::POINT_DATA);
+
+  if constexpr (IsEigenVector<T>::value) {
+    file_ << "VECTORS " << name << ' '
+          << LegacyTypeName<typename T::Scalar>() << '\n';
+  } else {
+    file_ << "SCALARS " << name << ' ' << LegacyTypeName<T>()
+          << " 1\nLOOKUP_TABLE default\n";
+  }
+  const size_type num_entities = mesh_->Size(codim);
+  for (size_type i = 0; i < num_entities; ++i) {
+    const mesh::Entity& e = *mesh_->EntityByIndex(codim, i);
+    const T value = mds.DefinedOn(e) ? mds(e) : undefined_value;
+    if constexpr (IsEigenVector<T>::value) {
+      // pad with zeros to three components
+      for (int d = 0; d < 3; ++d) {
+        WriteValue(d < value.rows() ? value(d) : typename T::Scalar(0));
+        if (!binary_) {
+          file_ << (d < 2 ? ' ' : '\n');
+        }
+      }
+    } else {
+      WriteValue(value);
+      if (!binary_) {
+        file_ << '\n';
+      }
+    }
+  }
+  if (binary_) {
+    file_ << '\n';
+  }
+}
+
+template <class T>
+void VtkStreamWriter::WriteFieldData(const std::string& name,
+                                     std::vector<T> data) {
+  if (section_ != Section::MESH || !file_.is_open()) {
+    throw base::LfException(
+        "Global data must be written before any point or cell data.");
+  }
+  for (const auto& d : field_data_) {
+    if (boost::apply_visitor([](const auto& a) { return a.name; }, d) ==
+        name) {
+      throw base::LfException(
+          "There is already another Point/Cell Attribute Set with the name " +
+          name);
+    }
+  }
+  if (name.find(' ') != std::string::npos) {
+    throw base::LfException(
+        "The name of the attribute set cannot contain spaces!");
+  }
+  field_data_.emplace_back(VtkFile::FieldDataArray<T>(name, std::move(data)));
+}
+
+}  // namespace lf::io
@@ -0,0 +1,244 @@
+/**
+ * @file
+ * @brief Declares the VtkStreamWriter which writes vtk files without keeping
+ *        the mesh or the data in memory
+ * @author agent
+ * @date   2026-10-19
+ * @copyright MIT License
+ */
+
+#ifndef __57ec54b237914b5698920e58aaf0e0a0
+#define __57ec54b237914b5698920e58aaf0e0a0
+
+#include <lf/mesh/mesh.h>
+#include <lf/mesh/utils/utils.h>
+#include <Eigen/Eigen>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "vtk_writer.h"
+
+namespace lf::io {
+
+/**
+ * @brief Write a mesh along with mesh data into a legacy vtk file while the
+ *        data is produced.
+ *
+ * VtkStreamWriter has the same interface as VtkWriter and produces equivalent
+ * files, but it never holds a copy of the mesh or of the datasets:
+ * - The constructor writes the points and cells of the mesh to the file.
+ * - Every call to `WritePointData()` or `WriteCellData()` evaluates the
+ *   MeshDataSet entity by entity and appends the values to the file at once.
+ * - The file is closed by Close() (or the destructor).
+ *
+ * Therefore the memory consumption does not depend on the size of the mesh,
+ * which makes this class the right choice for very large meshes. Point and
+ * cell datasets can be written in any order.
+ *
+ * #### Sample usage:
+ * @code
+ * VtkStreamWriter writer(mesh_p, "solution.vtk");
+ * writer.WriteGlobalData("time", std::vector<double>{t});
+ * writer.WritePointData("u", u_mds);
+ * writer.WriteCellData("error", error_mds);
+ * writer.Close();  // throws if the file could not be written
+ * @endcode
+ *
+ * @note Global data (WriteGlobalData()) must be written before the first
+ * point or cell dataset, because the legacy vtk format expects it right after
+ * the mesh.
+ *
+ * @note The XML format (`*.vtu`, see WriteToVtuFile()) stores the position of
+ * every array at the beginning of the file, it cannot be streamed. Use
+ * VtkWriter to produce `*.vtu` files.
+ */
+class VtkStreamWriter {
+ public:
+  using dim_t = base::dim_t;
+  using size_type = mesh::Mesh::size_type;
+
+  VtkStreamWriter(const VtkStreamWriter&) = delete;
+  VtkStreamWriter(VtkStreamWriter&&) = delete;
+  VtkStreamWriter& operator=(const VtkStreamWriter&) = delete;
+  VtkStreamWriter& operator=(VtkStreamWriter&&) = delete;
+
+  /**
+   * @brief Construct a new VtkStreamWriter and write the mesh into the file.
+   * @param mesh The underlying mesh that should be written into the VtkFile.
+   * @param filename The filename of the Vtk File
+   * @param codim (Optional) the codimension of the cells, see
+   *              VtkWriter::VtkWriter()
+   * @param format (Optional) ASCII or BINARY (default) format of the file,
+   *               see VtkWriter::setBinary().
+   */
+  VtkStreamWriter(std::shared_ptr<const mesh::Mesh> mesh, std::string filename,
+                  dim_t codim = 0,
+                  VtkFile::Format format = VtkFile::Format::BINARY);
+
+  /// @copydoc VtkWriter::WritePointData(const std::string&, const mesh::utils::MeshDataSet<unsigned char>&, unsigned char)
+  void WritePointData(const std::string& name,
+                      const mesh::utils::MeshDataSet<unsigned char>& mds,
+                      unsigned char undefined_value = 0);
+
+  /// @copydoc VtkWriter::WritePointData(const std::string&, const mesh::utils::MeshDataSet<char>&, char)
+  void WritePointData(const std::string& name,
+                      const mesh::utils::MeshDataSet<char>& mds,
+                      char undefined_value = 0);
+
+  /// @copydoc VtkWriter::WritePointData(const std::string&, const mesh::utils::MeshDataSet<unsigned int>&, unsigned)
+  void WritePointData(const std::string& name,
+                      const mesh::utils::MeshDataSet<unsigned int>& mds,
+                      unsigned undefined_value = 0);
+
+  /// @copydoc VtkWriter::WritePointData(const std::string&, const mesh::utils::MeshDataSet<int>&, int)
+  void WritePointData(const std::string& name,
+                      const mesh::utils::MeshDataSet<int>& mds,
+                      int undefined_value = 0);
+
+  /// @copydoc VtkWriter::WritePointData(const std::string&, const mesh::utils::MeshDataSet<float>&, float)
+  void WritePointData(const std::string& name,
+                      const mesh::utils::MeshDataSet<float>& mds,
+                      float undefined_value = 0.f);
+
+  /// @copydoc VtkWriter::WritePointData(const std::string&, const mesh::utils::MeshDataSet<double>&, double)
+  void WritePointData(const std::string& name,
+                      const mesh::utils::MeshDataSet<double>& mds,
+                      double undefined_value = 0.);
+
+  /// @copydoc VtkWriter::WritePointData(const std::string&, const mesh::utils::MeshDataSet<Eigen::Vector2d>&, const Eigen::Vector2d&)
+  void WritePointData(const std::string& name,
+                      const mesh::utils::MeshDataSet<Eigen::Vector2d>& mds,
+                      const Eigen::Vector2d& undefined_value = {0, 0});
+
+  /// @copydoc VtkWriter::WritePointData(const std::string&, const mesh::utils::MeshDataSet<Eigen::Vector2f>&, const Eigen::Vector2f&)
+  void WritePointData(const std::string& name,
+                      const mesh::utils::MeshDataSet<Eigen::Vector2f>& mds,
+                      const Eigen::Vector2f& undefined_value = {0, 0});
+
+  /// @copydoc VtkWriter::WritePointData(const std::string&, const mesh::utils::MeshDataSet<Eigen::Vector3d>&, const Eigen::Vector3d&)
+  void WritePointData(const std::string& name,
+                      const mesh::utils::MeshDataSet<Eigen::Vector3d>& mds,
+                      const Eigen::Vector3d& undefined_value = {0, 0, 0});
+
+  /// @copydoc VtkWriter::WritePointData(const std::string&, const mesh::utils::MeshDataSet<Eigen::Vector3f>&, const Eigen::Vector3f&)
+  void WritePointData(const std::string& name,
+                      const mesh::utils::MeshDataSet<Eigen::Vector3f>& mds,
+                      const Eigen::Vector3f& undefined_value = {0, 0, 0});
+
+  /// @copydoc VtkWriter::WriteCellData(const std::string&, const mesh::utils::MeshDataSet<unsigned char>&, unsigned char)
+  void WriteCellData(const std::string& name,
+                     const mesh::utils::MeshDataSet<unsigned char>& mds,
+                     unsigned char undefined_value = 0);
+
+  /// @copydoc VtkWriter::WriteCellData(const std::string&, const mesh::utils::MeshDataSet<char>&, char)
+  void WriteCellData(const std::string& name,
+                     const mesh::utils::MeshDataSet<char>& mds,
+                     char undefined_value = 0);
+
+  /// @copydoc VtkWriter::WriteCellData(const std::string&, const mesh::utils::MeshDataSet<unsigned int>&, unsigned int)
+  void WriteCellData(const std::string& name,
+                     const mesh::utils::MeshDataSet<unsigned int>& mds,
+                     unsigned int undefined_value = 0);
+
+  /// @copydoc VtkWriter::WriteCellData(const std::string&, const mesh::utils::MeshDataSet<int>&, int)
+  void WriteCellData(const std::string& name,
+                     const mesh::utils::MeshDataSet<int>& mds,
+                     int undefined_value = 0);
+
+  /// @copydoc VtkWriter::WriteCellData(const std::string&, const mesh::utils::MeshDataSet<float>&, float)
+  void WriteCellData(const std::string& name,
+                     const mesh::utils::MeshDataSet<float>& mds,
+                     float undefined_value = 0);
+
+  /// @copydoc VtkWriter::WriteCellData(const std::string&, const mesh::utils::MeshDataSet<double>&, double)
+  void WriteCellData(const std::string& name,
+                     const mesh::utils::MeshDataSet<double>& mds,
+                     double undefined_value = 0);
+
+  /// @copydoc VtkWriter::WriteCellData(const std::string&, const mesh::utils::MeshDataSet<Eigen::Vector2d>&, const Eigen::Vector2d&)
+  void WriteCellData(const std::string& name,
+                     const mesh::utils::MeshDataSet<Eigen::Vector2d>& mds,
+                     const Eigen::Vector2d& undefined_value = {0, 0});
+
+  /// @copydoc VtkWriter::WriteCellData(const std::string&, const mesh::utils::MeshDataSet<Eigen::Vector2f>&, const Eigen::Vector2f&)
+  void WriteCellData(const std::string& name,
+                     const mesh::utils::MeshDataSet<Eigen::Vector2f>& mds,
+                     const Eigen::Vector2f& undefined_value = {0, 0});
+
+  /// @copydoc VtkWriter::WriteCellData(const std::string&, const mesh::utils::MeshDataSet<Eigen::Vector3d>&, const Eigen::Vector3d&)
+  void WriteCellData(const std::string& name,
+                     const mesh::utils::MeshDataSet<Eigen::Vector3d>& mds,
+                     const Eigen::Vector3d& undefined_value = {0, 0, 0});
+
+  /// @copydoc VtkWriter::WriteCellData(const std::string&, const mesh::utils::MeshDataSet<Eigen::Vector3f>&, const Eigen::Vector3f&)
+  void WriteCellData(const std::string& name,
+                     const mesh::utils::MeshDataSet<Eigen::Vector3f>& mds,
+                     const Eigen::Vector3f& undefined_value = {0, 0, 0});
+
+  /**
+   * @brief Write global data into the vtk file that is not related to the mesh
+   *        at all, see VtkWriter::WriteGlobalData().
+   *
+   * Global data is kept in memory until the first point or cell dataset is
+   * written (or the file is closed), calling this method afterwards throws a
+   * base::LfException.
+   */
+  void WriteGlobalData(const std::string& name, std::vector<int> data);
+
+  /// @copydoc WriteGlobalData(const std::string&, std::vector<int>)
+  void WriteGlobalData(const std::string& name, std::vector<float> data);
+
+  /// @copydoc WriteGlobalData(const std::string&, std::vector<int>)
+  void WriteGlobalData(const std::string& name, std::vector<double> data);
+
+  /**
+   * @brief Write outstanding global data and close the file. No more data can
+   *        be written afterwards.
+   * @throws base::LfException if the file could not be written completely
+   *
+   * Calling Close() more than once has no effect.
+   */
+  void Close();
+
+  /**
+   * @brief Destructor, closes the file if Close() has not been called.
+   *
+   * The destructor swallows all errors that occur while the file is closed,
+   * call Close() explicitly to find out whether the file was written
+   * successfully.
+   */
+  ~VtkStreamWriter();
+
+ private:
+  /// The part of the legacy vtk file into which data is currently written
+  enum class Section { MESH, POINT_DATA, CELL_DATA };
+
+  std::shared_ptr<const mesh::Mesh> mesh_;
+  std::string filename_;
+  dim_t codim_;
+  bool binary_;
+  std::ofstream file_;
+  Section section_ = Section::MESH;
+  VtkFile::FieldData field_data_;
+  std::vector<std::string> point_data_names_;
+  std::vector<std::string> cell_data_names_;
+
+  // Switch to the given section, writes outstanding global data and the
+  // section header if necessary.
+  void BeginSection(Section section);
+
+  template <class T>
+  void WriteValue(T value);
+
+  template <class T>
+  void WriteAttribute(const std::string& name, dim_t codim,
+                      const mesh::utils::MeshDataSet<T>& mds,
+                      const T& undefined_value);
+
+  template <class T>
+  void WriteFieldData(const std::string& name, std::vector<T> data);
+};
+
+}  // namespace lf::io
+
+#endif  // __57ec54b237914b5698920e58aaf0e0a0
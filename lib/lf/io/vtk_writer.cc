@@ -12,8 +12,21 @@
 #include <boost/phoenix/phoenix.hpp>
 #include <boost/phoenix/scope/let.hpp>
 #include <boost/spirit/include/karma.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
+#include <sstream>
+#include <type_traits>
 #include "eigen_fusion_adapter.h"
+#include "vtk_writer_internal.h"
+
+#ifdef LF_IO_HAVE_ZLIB
+#include <zlib.h>
+#endif
+#ifdef LF_IO_HAVE_LZ4
+#include <lz4.h>
+#endif
 
 template <class RESULT_TYPE, class LAMBDA>
 class VariantVisitor {
@@ -479,6 +492,305 @@ void WriteToFile(const VtkFile& vtk_file, const std::string& filename) {
   }
 }
 
+namespace /*anonymous*/ {
+
+/// Size of the uncompressed blocks into which the arrays of a vtu file are
+/// split before compression (same as in VTK)
+constexpr std::uint64_t kVtuBlockSize = 1 << 15;
+
+/// Error message for a compression that is not supported by this build
+std::string UnsupportedCompressionMessage(VtuCompression compression) {
+  return std::string("LehrFEM++ was built without ") +
+         (compression == VtuCompression::ZLIB ? "zlib" : "LZ4") +
+         " support, check VtuCompressionSupported() or use "
+         "VtuCompression::NONE instead.";
+}
+
+/// Name of the VTK XML data type corresponding to `T`
+template <class T>
+std::string VtuTypeName() {
+  static_assert(std::is_arithmetic_v<T>);
+  if constexpr (std::is_floating_point_v<T>) {
+    return sizeof(T) == 4 ? "Float32" : "Float64";
+  } else {
+    return (std::is_signed_v<T> ? "Int" : "UInt") +
+           std::to_string(8 * sizeof(T));
+  }
+}
+
+std::string XmlEscape(const std::string& str) {
+  std::string result;
+  for (const char c : str) {
+    switch (c) {
+      case '&':
+        result += "&amp;";
+        break;
+      case '<':
+        result += "&lt;";
+        break;
+      case '>':
+        result += "&gt;";
+        break;
+      case '"':
+        result += "&quot;";
+        break;
+      default:
+        result += c;
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief Collects the binary data of all arrays of a vtu file in the layout
+ * of the `AppendedData` section.
+ *
+ * Every array is preceded by a header of `UInt64` values. Uncompressed arrays
+ * have the header `[#bytes]`, compressed arrays are split into blocks of
+ * kVtuBlockSize bytes which are compressed separately and have the header
+ * `[#blocks][block size][size of last block or 0][compressed sizes...]`.
+ */
+class VtuAppendedData {
+ public:
+  explicit VtuAppendedData(VtuCompression compression)
+      : compression_(compression) {}
+
+  /// Append `count` values starting at `data`, returns the offset of the array
+  template <class T>
+  std::uint64_t Append(const T* data, std::uint64_t count) {
+    static_assert(std::is_arithmetic_v<T>);
+    return AppendBytes(reinterpret_cast<const char*>(data), count * sizeof(T));
+  }
+
+  [[nodiscard]] const std::string& Bytes() const { return bytes_; }
+
+ private:
+  std::uint64_t AppendBytes(const char* data, std::uint64_t num_bytes) {
+    const std::uint64_t offset = bytes_.size();
+    if (compression_ == VtuCompression::NONE) {
+      AppendHeader(num_bytes);
+      bytes_.append(data, num_bytes);
+      return offset;
+    }
+    const std::uint64_t num_blocks =
+        (num_bytes + kVtuBlockSize - 1) / kVtuBlockSize;
+    AppendHeader(num_blocks);
+    AppendHeader(kVtuBlockSize);
+    AppendHeader(num_bytes % kVtuBlockSize);
+    // the compressed sizes are filled in below
+    const std::uint64_t sizes_pos = bytes_.size();
+    bytes_.resize(sizes_pos + num_blocks * sizeof(std::uint64_t));
+    for (std::uint64_t b = 0; b < num_blocks; ++b) {
+      const std::uint64_t block_bytes =
+          std::min(kVtuBlockSize, num_bytes - b * kVtuBlockSize);
+      const std::uint64_t compressed_bytes =
+          CompressBlock(data + b * kVtuBlockSize, block_bytes);
+      std::memcpy(&bytes_[sizes_pos + b * sizeof(std::uint64_t)],
+                  &compressed_bytes, sizeof(std::uint64_t));
+    }
+    return offset;
+  }
+
+  void AppendHeader(std::uint64_t value) {
+    bytes_.append(reinterpret_cast<const char*>(&value), sizeof(value));
+  }
+
+  /// Compress one block and append it, returns the compressed size
+  std::uint64_t CompressBlock(const char* data, std::uint64_t num_bytes) {
+    const std::uint64_t start = bytes_.size();
+#ifdef LF_IO_HAVE_ZLIB
+    if (compression_ == VtuCompression::ZLIB) {
+      uLongf compressed_bytes = compressBound(num_bytes);
+      bytes_.resize(start + compressed_bytes);
+      if (compress2(reinterpret_cast<Bytef*>(&bytes_[start]),
+                    &compressed_bytes, reinterpret_cast<const Bytef*>(data),
+                    num_bytes, Z_DEFAULT_COMPRESSION) != Z_OK) {
+        throw base::LfException("zlib compression of vtu data failed.");
+      }
+      bytes_.resize(start + compressed_bytes);
+      return compressed_bytes;
+    }
+#endif
+#ifdef LF_IO_HAVE_LZ4
+    if (compression_ == VtuCompression::LZ4) {
+      const int bound = LZ4_compressBound(static_cast<int>(num_bytes));
+      bytes_.resize(start + bound);
+      const int compressed_bytes = LZ4_compress_default(
+          data, &bytes_[start], static_cast<int>(num_bytes), bound);
+      if (compressed_bytes <= 0) {
+        throw base::LfException("LZ4 compression of vtu data failed.");
+      }
+      bytes_.resize(start + compressed_bytes);
+      return compressed_bytes;
+    }
+#endif
+    throw base::LfException(UnsupportedCompressionMessage(compression_));
+  }
+
+  VtuCompression compression_;
+  std::string bytes_;
+};
+
+/// Writes the `DataArray` elements of a vtu file and appends their data
+class VtuArrayWriter {
+ public:
+  using result_type = void;
+
+  VtuArrayWriter(std::ostream& xml, VtuAppendedData& appended)
+      : xml_(xml), appended_(appended) {}
+
+  template <class T>
+  void Write(const std::string& name, const T* data, std::uint64_t count,
+             int num_components, const char* size_attribute) {
+    xml_ << "<DataArray type=\"" << VtuTypeName<T>() << '"';
+    if (!name.empty()) {
+      xml_ << " Name=\"" << XmlEscape(name) << '"';
+    }
+    xml_ << ' ' << size_attribute << "=\"";
+    if (num_components == 0) {
+      xml_ << count;
+    } else {
+      xml_ << num_components;
+    }
+    xml_ << "\" format=\"appended\" offset=\"" << appended_.Append(data, count)
+         << "\"/>\n";
+  }
+
+  template <class T>
+  void operator()(const VtkFile::ScalarData<T>& d) {
+    Write(d.name, d.data.data(), d.data.size(), 1, "NumberOfComponents");
+  }
+
+  template <class T>
+  void operator()(const VtkFile::VectorData<T>& d) {
+    static_assert(sizeof(Eigen::Matrix<T, 3, 1>) == 3 * sizeof(T));
+    Write(d.name, d.data.empty() ? nullptr : d.data[0].data(),
+          3 * d.data.size(), 3, "NumberOfComponents");
+  }
+
+  template <class T>
+  void operator()(const VtkFile::FieldDataArray<T>& d) {
+    Write(d.name, d.data.data(), d.data.size(), 0, "NumberOfTuples");
+  }
+
+ private:
+  std::ostream& xml_;
+  VtuAppendedData& appended_;
+};
+
+}  // namespace
+
+bool VtuCompressionSupported(VtuCompression compression) {
+  switch (compression) {
+    case VtuCompression::ZLIB:
+#ifdef LF_IO_HAVE_ZLIB
+      return true;
+#else
+      return false;
+#endif
+    case VtuCompression::LZ4:
+#ifdef LF_IO_HAVE_LZ4
+      return true;
+#else
+      return false;
+#endif
+    default:
+      return true;
+  }
+}
+
+VtuCompression DefaultVtuCompression() {
+  return VtuCompressionSupported(VtuCompression::ZLIB) ? VtuCompression::ZLIB
+                                                       : VtuCompression::NONE;
+}
+
+void WriteToVtuFile(const VtkFile& vtk_file, const std::string& filename,
+                    VtuCompression compression) {
+  ValidateVtkFile(vtk_file);
+  if (!VtuCompressionSupported(compression)) {
+    throw base::LfException(UnsupportedCompressionMessage(compression));
+  }
+  const auto& grid = vtk_file.unstructured_grid;
+
+  // flatten the cells:
+  std::vector<VtkFile::size_type> connectivity;
+  std::vector<std::int64_t> offsets;
+  std::vector<std::uint8_t> types;
+  offsets.reserve(grid.cells.size());
+  types.reserve(grid.cells.size());
+  for (std::size_t i = 0; i < grid.cells.size(); ++i) {
+    connectivity.insert(connectivity.end(), grid.cells[i].begin(),
+                        grid.cells[i].end());
+    offsets.push_back(connectivity.size());
+    types.push_back(static_cast<std::uint8_t>(grid.cell_types[i]));
+  }
+
+  std::ostringstream xml;
+  VtuAppendedData appended(compression);
+  VtuArrayWriter array_writer(xml, appended);
+  xml << "<?xml version=\"1.0\"?>\n";
+  if (!vtk_file.header.empty()) {
+    std::string comment = vtk_file.header;
+    for (auto pos = comment.find("--"); pos != std::string::npos;
+         pos = comment.find("--")) {
+      comment.replace(pos, 2, "- ");
+    }
+    xml << "<!-- " << comment << " -->\n";
+  }
+  xml << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\""
+      << (detail::IsLittleEndian() ? "LittleEndian" : "BigEndian")
+      << "\" header_type=\"UInt64\"";
+  if (compression == VtuCompression::ZLIB) {
+    xml << " compressor=\"vtkZLibDataCompressor\"";
+  } else if (compression == VtuCompression::LZ4) {
+    xml << " compressor=\"vtkLZ4DataCompressor\"";
+  }
+  xml << ">\n<UnstructuredGrid>\n";
+  if (!vtk_file.field_data.empty()) {
+    xml << "<FieldData>\n";
+    for (const auto& d : vtk_file.field_data) {
+      boost::apply_visitor(array_writer, d);
+    }
+    xml << "</FieldData>\n";
+  }
+  xml << "<Piece NumberOfPoints=\"" << grid.points.size()
+      << "\" NumberOfCells=\"" << grid.cells.size() << "\">\n";
+  xml << "<PointData>\n";
+  for (const auto& d : vtk_file.point_data) {
+    boost::apply_visitor(array_writer, d);
+  }
+  xml << "</PointData>\n<CellData>\n";
+  for (const auto& d : vtk_file.cell_data) {
+    boost::apply_visitor(array_writer, d);
+  }
+  xml << "</CellData>\n<Points>\n";
+  array_writer.Write("", grid.points.empty() ? nullptr : grid.points[0].data(),
+                     3 * grid.points.size(), 3, "NumberOfComponents");
+  xml << "</Points>\n<Cells>\n";
+  array_writer.Write("connectivity", connectivity.data(), connectivity.size(),
+                     1, "NumberOfComponents");
+  array_writer.Write("offsets", offsets.data(), offsets.size(), 1,
+                     "NumberOfComponents");
+  array_writer.Write("types", types.data(), types.size(), 1,
+                     "NumberOfComponents");
+  xml << "</Cells>\n</Piece>\n</UnstructuredGrid>\n"
+      << "<AppendedData encoding=\"raw\">\n_";
+
+  std::ofstream file(filename, std::ios_base::out | std::ios_base::binary |
+                                   std::ios_base::trunc);
+  if (!file.is_open()) {
+    throw base::LfException("Could not open file " + filename +
+                            " for writing.");
+  }
+  file << xml.str();
+  file.write(appended.Bytes().data(), appended.Bytes().size());
+  file << "\n</AppendedData>\n</VTKFile>\n";
+  file.close();
+  if (!file) {
+    throw base::LfException("Error while writing " + filename);
+  }
+}
+
 VtkWriter::VtkWriter(std::shared_ptr<const mesh::Mesh> mesh,
                      std::string filename, dim_t codim)
     : mesh_(std::move(mesh)), filename_(std::move(filename)), codim_(codim) {
@@ -533,6 +845,24 @@ VtkWriter::VtkWriter(std::shared_ptr<const mesh::Mesh> mesh,
   }
 }
 
+void VtkWriter::setCompression(VtuCompression compression) {
+  if (!VtuCompressionSupported(compression)) {
+    throw base::LfException(UnsupportedCompressionMessage(compression));
+  }
+  compression_ = compression;
+}
+
+VtkWriter::~VtkWriter() {
+  const std::string vtu_extension = ".vtu";
+  if (filename_.size() >= vtu_extension.size() &&
+      filename_.compare(filename_.size() - vtu_extension.size(),
+                        vtu_extension.size(), vtu_extension) == 0) {
+    WriteToVtuFile(vtk_file_, filename_, compression_);
+  } else {
+    WriteToFile(vtk_file_, filename_);
+  }
+}
+
 void VtkWriter::WritePointData(
     const std::string& name, const mesh::utils::MeshDataSet<unsigned char>& mds,
     unsigned char undefined_value) {
@@ -678,18 +1008,9 @@ void VtkWriter::WriteGlobalData(const std::string& name,
 
 template <class DATA>
 void CheckAttributeSetName(const DATA& data, const std::string& name) {
-  if (std::find_if(data.begin(), data.end(), [&](auto& d) {
-        return boost::apply_visitor([&](auto&& d2) { return d2.name; }, d) ==
-               name;
-      }) != data.end()) {
-    throw base::LfException(
-        "There is already another Point/Cell Attribute Set with the name " +
-        name);
-  }
-  if (name.find(' ') != std::string::npos) {
-    throw base::LfException(
-        "The name of the attribute set cannot contain spaces!");
-  }
+  detail::CheckAttributeSetName(data, name, [](auto& d) {
+    return boost::apply_visitor([](auto&& d2) { return d2.name; }, d);
+  });
 }
 
 template <class T>
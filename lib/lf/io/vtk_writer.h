@@ -141,6 +141,52 @@ class VtkFile {
 
 void WriteToFile(const VtkFile& vtk_file, const std::string& filename);
 
+/**
+ * @brief Compression of the binary data in a `*.vtu` file, see
+ * WriteToVtuFile()
+ */
+enum class VtuCompression {
+  NONE,  ///< raw binary data
+  ZLIB,  ///< zlib (deflate) compression (optional)
+  LZ4    ///< LZ4 compression, faster but weaker than zlib (optional)
+};
+
+/**
+ * @brief Tells whether LehrFEM++ was built with support for a certain
+ * compression of `*.vtu` files.
+ *
+ * `ZLIB` and `LZ4` compression are only available if the zlib and LZ4
+ * library, respectively, were found when LehrFEM++ was configured. `NONE` is
+ * always supported.
+ */
+bool VtuCompressionSupported(VtuCompression compression);
+
+/**
+ * @brief The compression used for `*.vtu` files unless specified otherwise:
+ * `ZLIB` if it is supported, `NONE` otherwise.
+ */
+VtuCompression DefaultVtuCompression();
+
+/**
+ * @brief Write a VtkFile in the XML based VTK format for unstructured grids
+ * (`*.vtu`)
+ * @param vtk_file The contents of the file, VtkFile::format is ignored.
+ * @param filename The name of the file (should end with `.vtu`)
+ * @param compression The compression of the binary data.
+ *
+ * All arrays are stored as raw binary data in the `AppendedData` section of
+ * the file with 64-bit headers (`header_type="UInt64"`), so the file may
+ * exceed 4GB. Compared to the binary legacy format written by WriteToFile()
+ * no ASCII conversion or byte swapping is needed and the data can be
+ * compressed blockwise. The resulting files can be read by ParaView 5.x or
+ * any other program based on VTK >= 8.
+ *
+ * @note VtkFile::ScalarData::lookup_table has no counterpart in the XML format
+ * and is ignored.
+ */
+void WriteToVtuFile(const VtkFile& vtk_file, const std::string& filename,
+                    VtuCompression compression = DefaultVtuCompression());
+
 /**
  * @brief Write a mesh along with mesh data into a vtk file.
  *
@@ -172,6 +218,15 @@ void WriteToFile(const VtkFile& vtk_file, const std::string& filename);
  *
  * @note By default, VtkWriter outputs files in text-format. However, for
  * larger meshes you can switch to the more efficient binary mode (setBinary()).
+ *
+ * @note If the filename ends with `.vtu`, the file is written in the XML
+ * based format with compressed binary data instead, see WriteToVtuFile() and
+ * setCompression(). This is the most compact format and should be preferred
+ * for large meshes.
+ *
+ * @note VtkWriter keeps a copy of the mesh and of all datasets in memory
+ * until the file is written. For very large meshes, VtkStreamWriter writes
+ * the same (legacy) files without buffering.
  */
 class VtkWriter {
  public:
@@ -209,6 +264,17 @@ class VtkWriter {
     }
   }
 
+  /**
+   * @brief Sets the compression of the binary data of a `*.vtu` file,
+   *        default is DefaultVtuCompression().
+   * @param compression The compression, see WriteToVtuFile()
+   * @throws base::LfException if the compression is not supported, see
+   *         VtuCompressionSupported()
+   *
+   * Has no effect if the legacy vtk format is written.
+   */
+  void setCompression(VtuCompression compression);
+
   /**
    * @brief Add a new `unsigned char` attribute dataset that attaches data to
    * the points/nodes of the mesh.
@@ -514,13 +580,14 @@ class VtkWriter {
   /**
    * @brief Destructor, writes everything into the file and closes it.
    */
-  ~VtkWriter() { WriteToFile(vtk_file_, filename_); }
+  ~VtkWriter();
 
  private:
   std::shared_ptr<const mesh::Mesh> mesh_;
   VtkFile vtk_file_;
   std::string filename_;
   dim_t codim_;
+  VtuCompression compression_ = DefaultVtuCompression();
 
   template <class T>
   void WriteScalarPointData(const std::string& name,
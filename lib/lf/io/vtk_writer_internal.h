@@ -0,0 +1,65 @@
+/**
+ * @file
+ * @brief Helpers that are shared by VtkWriter, VtkStreamWriter and
+ *        TimeSeriesWriter. Not part of the public interface.
+ * @author agent
+ * @date   2026-10-19
+ * @copyright MIT License
+ */
+
+#ifndef __2a4070b832854327bb5db5fc94b136e5
+#define __2a4070b832854327bb5db5fc94b136e5
+
+#include <lf/base/base.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace lf::io::detail {
+
+/// true if the machine stores multi-byte values little endian
+inline bool IsLittleEndian() {
+  const std::uint16_t one = 1;
+  char first_byte;
+  std::memcpy(&first_byte, &one, 1);
+  return first_byte == 1;
+}
+
+/**
+ * @brief Throw a base::LfException if `name` cannot be used for a new
+ *        point/cell attribute set.
+ * @param data_sets The attribute sets that have been written already
+ * @param name The name of the new attribute set
+ * @param name_of Returns the name of an element of `data_sets`
+ *
+ * The name must not be used by another attribute set and must not contain
+ * spaces.
+ */
+template <class DATA_SETS, class NAME_OF>
+void CheckAttributeSetName(const DATA_SETS& data_sets, const std::string& name,
+                           NAME_OF&& name_of) {
+  if (std::any_of(data_sets.begin(), data_sets.end(),
+                  [&](const auto& d) { return name_of(d) == name; })) {
+    throw base::LfException(
+        "There is already another Point/Cell Attribute Set with the name " +
+        name);
+  }
+  if (name.find(' ') != std::string::npos) {
+    throw base::LfException(
+        "The name of the attribute set cannot contain spaces!");
+  }
+}
+
+/// @copydoc CheckAttributeSetName(const DATA_SETS&, const std::string&, NAME_OF&&)
+template <class NAMES>
+void CheckAttributeSetName(const NAMES& names, const std::string& name) {
+  CheckAttributeSetName(names, name,
+                        [](const std::string& n) -> const std::string& {
+                          return n;
+                        });
+}
+
+}  // namespace lf::io::detail
+
+#endif  // __2a4070b832854327bb5db5fc94b136e5
@@ -12,6 +12,7 @@ MeshFactory::size_type MeshFactory::AddPoint(coord_t coord) {
   LF_ASSERT_MSG(coord.rows() == dim_world_,
                 "coord has incompatible number of rows.");
   // Create default geometry object for a point from location vector
+  const geometry::GeometryArena::Scope scope(arena_.get());
   hybrid2d::Mesh::GeometryPtr point_geo =
       std::make_unique<geometry::Point>(coord);
   nodes_.emplace_back(std::move(point_geo));
@@ -102,14 +103,21 @@ std::shared_ptr<mesh::Mesh> MeshFactory::Build() {
   }
 
   // Obtain points to new mesh object; the actual construction of the
-  // mesh is done by the constructor of that object
-  mesh::Mesh* mesh_ptr = new hybrid2d::Mesh(
-      dim_world_, std::move(nodes_), std::move(edges_), std::move(elements_));
+  // mesh is done by the constructor of that object. Geometries created
+  // there are allocated from the arena as well.
+  mesh::Mesh* mesh_ptr;
+  {
+    const geometry::GeometryArena::Scope scope(arena_.get());
+    mesh_ptr = new hybrid2d::Mesh(dim_world_, std::move(nodes_),
+                                  std::move(edges_), std::move(elements_));
+  }
 
   // Clear all information supplied to the MeshFactory object
   nodes_ = hybrid2d::Mesh::NodeCoordList{};  // .clear();
   edges_ = hybrid2d::Mesh::EdgeList{};       // .clear();
   elements_ = hybrid2d::Mesh::CellList{};    // clear();
+  // The arena stays alive as long as geometries allocated from it
+  arena_ = geometry::GeometryArena::Create();
 
   return std::shared_ptr<mesh::Mesh>(mesh_ptr);
 }
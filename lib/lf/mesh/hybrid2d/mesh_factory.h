@@ -32,7 +32,8 @@ class MeshFactory : public mesh::MeshFactory {
    * @param dim_world The dimension of the euclidean space in which the
    *                  mesh is embedded.
    */
-  explicit MeshFactory(dim_t dim_world) : dim_world_(dim_world) {}
+  explicit MeshFactory(dim_t dim_world)
+      : dim_world_(dim_world), arena_(geometry::GeometryArena::Create()) {}
 
   dim_t DimWorld() const override { return dim_world_; }
 
@@ -48,6 +49,12 @@ class MeshFactory : public mesh::MeshFactory {
 
   std::shared_ptr<mesh::Mesh> Build() override;
 
+  /**
+   * @brief Every mesh built by this factory gets an arena of its own, which
+   *        also holds the geometries created by the mesh itself
+   */
+  geometry::GeometryArena* Arena() const override { return arena_.get(); }
+
   /** @brief output function printing asssembled lists of entity information */
   void PrintLists(std::ostream& o = std::cout) const;
 
@@ -58,6 +65,8 @@ class MeshFactory : public mesh::MeshFactory {
   hybrid2d::Mesh::NodeCoordList nodes_;
   hybrid2d::Mesh::EdgeList edges_;
   hybrid2d::Mesh::CellList elements_;
+  // arena for the geometries of the next mesh
+  std::shared_ptr<geometry::GeometryArena> arena_;
 
  public:
   // Switch for verbosity level of output
@@ -154,4 +154,25 @@ TEST(lf_hybrid2d, EdgeNumbering) {
   EXPECT_EQ(mesh->Index(*mesh->Entities(0).begin()), 0);
 }
 
+TEST(lf_hybrid2d, GeometryArena) {
+  auto factory = std::make_shared<MeshFactory>(2);
+  TPTriagMeshBuilder builder(factory);
+  builder.setBottomLeftCorner(Eigen::Vector2d{0.0, 0.0})
+      .setTopRightCorner(Eigen::Vector2d{1.0, 1.0})
+      .setNoXCells(3)
+      .setNoYCells(2);
+  const geometry::GeometryArena* arena = factory->Arena();
+  ASSERT_NE(arena, nullptr);
+  const std::shared_ptr<mesh::Mesh> mesh = builder.Build();
+  // All geometries of the mesh share one arena, the next mesh gets a new one
+  EXPECT_NE(factory->Arena(), arena);
+  for (dim_t codim = 0; codim <= 2; ++codim) {
+    for (const mesh::Entity& e : mesh->Entities(codim)) {
+      EXPECT_EQ(geometry::GeometryArena::Owner(e.Geometry()), arena);
+    }
+  }
+  EXPECT_EQ(arena->NumObjects(),
+            mesh->Size(0) + mesh->Size(1) + mesh->Size(2));
+}
+
 }  // namespace lf::mesh::hybrid2d::test
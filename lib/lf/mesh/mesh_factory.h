@@ -109,6 +109,20 @@ class MeshFactory {
    */
   virtual std::shared_ptr<Mesh> Build() = 0;
 
+  /**
+   * @brief Arena from which the geometries of the mesh under construction
+   *        should be allocated
+   * @return `nullptr`, if the factory does not provide an arena
+   *
+   * Code creating geometries to be passed to AddPoint() or AddEntity() can
+   * open a geometry::GeometryArena::Scope with this arena, so that the
+   * geometry objects are allocated in bulk and released together with the
+   * mesh.
+   *
+   * @note The arena may change with every call to Build().
+   */
+  virtual geometry::GeometryArena* Arena() const { return nullptr; }
+
   /// @brief Virtual destructor.
   virtual ~MeshFactory() = default;
 };
@@ -0,0 +1,190 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Implementation of point location in meshes
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#include "cell_locator.h"
+#include <algorithm>
+#include <cmath>
+
+namespace lf::mesh::utils {
+
+namespace {
+// Test whether local coordinates belong to a reference element
+bool IsInsideRefEl(lf::base::RefEl ref_el, const Eigen::VectorXd& xi,
+                   double tol) {
+  switch (ref_el) {
+    case lf::base::RefEl::kSegment(): {
+      return (xi[0] >= -tol) && (xi[0] <= 1.0 + tol);
+    }
+    case lf::base::RefEl::kTria(): {
+      return (xi[0] >= -tol) && (xi[1] >= -tol) &&
+             (xi[0] + xi[1] <= 1.0 + tol);
+    }
+    case lf::base::RefEl::kQuad(): {
+      return (xi.array() >= -tol).all() && (xi.array() <= 1.0 + tol).all();
+    }
+    default: {
+      LF_VERIFY_MSG(false, "Illegal cell type " << ref_el.ToString());
+    }
+  }
+  return false;
+}
+}  // namespace
+
+CellLocator::CellLocator(std::shared_ptr<const Mesh> mesh_p, double tol)
+    : mesh_p_(std::move(mesh_p)), tol_(tol) {
+  const Mesh& mesh{*mesh_p_};
+  const Eigen::Index dim = mesh.DimWorld();
+  LF_VERIFY_MSG(mesh.DimMesh() == dim,
+                "Point location requires DimMesh() == DimWorld()");
+  const size_type no_cells = mesh.Size(0);
+  LF_VERIFY_MSG(no_cells > 0, "Empty mesh");
+
+  // Bounding boxes of all cells and of the mesh
+  cells_.resize(no_cells);
+  cell_bbox_.resize(2 * dim, no_cells);
+  for (size_type idx = 0; idx < no_cells; ++idx) {
+    const Entity* cell = mesh.EntityByIndex(0, idx);
+    const Eigen::MatrixXd corners =
+        cell->Geometry()->Global(cell->RefEl().NodeCoords());
+    cells_[idx] = cell;
+    cell_bbox_.col(idx) << corners.rowwise().minCoeff(),
+        corners.rowwise().maxCoeff();
+  }
+  const Eigen::VectorXd lower = cell_bbox_.topRows(dim).rowwise().minCoeff();
+  const Eigen::VectorXd upper =
+      cell_bbox_.bottomRows(dim).rowwise().maxCoeff();
+  const Eigen::VectorXd extent = upper - lower;
+  const double diam = extent.norm();
+  LF_VERIFY_MSG(diam > 0.0, "Degenerate mesh");
+  // Enlarge the cell boxes by the tolerance
+  cell_bbox_.topRows(dim).array() -= tol_ * diam;
+  cell_bbox_.bottomRows(dim).array() += tol_ * diam;
+
+  // Uniform grid with about one bin per cell
+  const double bin_width =
+      std::pow(extent.cwiseMax(1.0E-3 * diam).prod() / no_cells, 1.0 / dim);
+  origin_ = lower.array() - tol_ * diam;
+  bin_size_.resize(dim);
+  no_bins_.resize(dim);
+  long total_bins = 1;
+  for (Eigen::Index d = 0; d < dim; ++d) {
+    no_bins_[d] = std::max(1L, std::lround(extent[d] / bin_width));
+    bin_size_[d] = (extent[d] + 2 * tol_ * diam) / no_bins_[d];
+    total_bins *= no_bins_[d];
+  }
+
+  // Register cells with bins in two passes: count, then fill
+  auto for_each_bin = [this, dim](size_type idx, auto&& action) {
+    std::vector<long> first(dim);
+    std::vector<long> last(dim);
+    for (Eigen::Index d = 0; d < dim; ++d) {
+      const auto bin = [this, d](double x) {
+        return std::clamp(
+            static_cast<long>(std::floor((x - origin_[d]) / bin_size_[d])), 0L,
+            no_bins_[d] - 1);
+      };
+      first[d] = bin(cell_bbox_(d, idx));
+      last[d] = bin(cell_bbox_(dim + d, idx));
+    }
+    std::vector<long> pos(first);
+    while (true) {
+      long lin = 0;
+      for (Eigen::Index d = dim - 1; d >= 0; --d) {
+        lin = lin * no_bins_[d] + pos[d];
+      }
+      action(lin);
+      Eigen::Index d = 0;
+      for (; d < dim; ++d) {
+        if (++pos[d] <= last[d]) {
+          break;
+        }
+        pos[d] = first[d];
+      }
+      if (d == dim) {
+        return;
+      }
+    }
+  };
+  bin_offsets_.assign(total_bins + 1, 0);
+  for (size_type idx = 0; idx < no_cells; ++idx) {
+    for_each_bin(idx, [this](long lin) { ++bin_offsets_[lin + 1]; });
+  }
+  for (long b = 0; b < total_bins; ++b) {
+    bin_offsets_[b + 1] += bin_offsets_[b];
+  }
+  bin_cells_.resize(bin_offsets_.back());
+  std::vector<size_type> fill(bin_offsets_.begin(), bin_offsets_.end() - 1);
+  for (size_type idx = 0; idx < no_cells; ++idx) {
+    for_each_bin(idx, [this, idx, &fill](long lin) {
+      bin_cells_[fill[lin]++] = idx;
+    });
+  }
+}
+
+long CellLocator::BinIndex(const Eigen::VectorXd& x) const {
+  long lin = 0;
+  for (Eigen::Index d = origin_.size() - 1; d >= 0; --d) {
+    const double rel = (x[d] - origin_[d]) / bin_size_[d];
+    if (!(rel >= 0.0) || (rel > no_bins_[d])) {
+      return -1;
+    }
+    lin = lin * no_bins_[d] +
+          std::min(static_cast<long>(rel), no_bins_[d] - 1);
+  }
+  return lin;
+}
+
+std::pair<const Entity*, Eigen::VectorXd> CellLocator::Locate(
+    const Eigen::VectorXd& x) const {
+  LF_ASSERT_MSG(x.size() == origin_.size(),
+                "Point must have " << origin_.size() << " coordinates");
+  const Eigen::Index dim = origin_.size();
+  const long bin = BinIndex(x);
+  if (bin >= 0) {
+    for (size_type k = bin_offsets_[bin]; k < bin_offsets_[bin + 1]; ++k) {
+      const size_type idx = bin_cells_[k];
+      if ((x.array() < cell_bbox_.col(idx).head(dim).array()).any() ||
+          (x.array() > cell_bbox_.col(idx).tail(dim).array()).any()) {
+        continue;
+      }
+      const Entity* cell = cells_[idx];
+      Eigen::VectorXd xi = cell->Geometry()->Local(x);
+      if (IsInsideRefEl(cell->RefEl(), xi, tol_)) {
+        return {cell, std::move(xi)};
+      }
+    }
+  }
+  return {nullptr, Eigen::VectorXd::Zero(dim)};
+}
+
+CellLocator::PointLocations CellLocator::LocatePoints(
+    const Eigen::MatrixXd& points) const {
+  const Eigen::Index n = points.cols();
+  PointLocations result;
+  result.cells.resize(n);
+  result.local.resize(origin_.size(), n);
+  lf::base::ParallelFor(
+      n,
+      [this, &points, &result](std::size_t begin, std::size_t end) {
+        for (std::size_t k = begin; k < end; ++k) {
+          auto [cell, xi] = Locate(points.col(k));
+          result.cells[k] = cell;
+          result.local.col(k) = xi;
+        }
+      },
+      256);
+  return result;
+}
+
+}  // namespace lf::mesh::utils
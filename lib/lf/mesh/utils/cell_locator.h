@@ -0,0 +1,119 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Spatial search structure for locating points in the cells of a mesh
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#ifndef _LF_MESH_CELL_LOCATOR_H_
+#define _LF_MESH_CELL_LOCATOR_H_
+
+#include <lf/mesh/mesh.h>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace lf::mesh::utils {
+
+/**
+ * @brief Finds the cells of a mesh containing given points together with the
+ * local coordinates of the points in these cells
+ *
+ * The bounding box of the mesh is covered by a uniform grid of bins, whose
+ * number roughly agrees with the number of cells. Every cell is registered
+ * with all bins its bounding box overlaps. The bins are stored in compressed
+ * row format, so that setting up the search structure costs
+ * \f$ O(N) \f$ operations for a shape-regular mesh with \f$ N \f$ cells, and
+ * the location of a point is a constant-time operation.
+ *
+ * To locate a point, the cells registered with the bin containing it are
+ * tested: after a cheap bounding box test the point is mapped to the
+ * reference element by lf::geometry::Geometry::Local() and accepted if the
+ * local coordinates lie in the reference element up to a tolerance.
+ *
+ * The local coordinates returned by the locator can directly be passed to
+ * the shape functions of a lf::fe::ScalarReferenceFiniteElement in order to
+ * evaluate a finite element function at the located points.
+ *
+ * @note Only meshes whose dimension agrees with the world dimension are
+ * supported.
+ */
+class CellLocator {
+ public:
+  using size_type = lf::base::size_type;
+
+  /** @brief Result of the location of several points */
+  struct PointLocations {
+    /** cell containing the k-th point, `nullptr` if outside the mesh */
+    std::vector<const Entity*> cells;
+    /** local coordinates of the k-th point in column k, undefined for points
+     * outside the mesh */
+    Eigen::MatrixXd local;
+  };
+
+  /**
+   * @brief Set up the search structure
+   *
+   * @param mesh_p pointer to the mesh, which must not change afterwards
+   * @param tol relative tolerance for the test whether a point belongs to a
+   * cell, which makes points on the boundary of cells and of the mesh be
+   * found despite roundoff.
+   */
+  explicit CellLocator(std::shared_ptr<const Mesh> mesh_p,
+                       double tol = 1.0E-10);
+
+  /** @brief the underlying mesh */
+  std::shared_ptr<const Mesh> getMesh() const { return mesh_p_; }
+
+  /**
+   * @brief Locate a single point
+   *
+   * @param x world coordinates of the point
+   * @return a pointer to a cell containing the point, `nullptr` if the
+   * point lies outside the mesh, and the local coordinates of the point in
+   * that cell. If the point lies on the boundary of several cells, any of
+   * them may be returned.
+   */
+  std::pair<const Entity*, Eigen::VectorXd> Locate(
+      const Eigen::VectorXd& x) const;
+
+  /**
+   * @brief Locate many points simultaneously
+   *
+   * @param points world coordinates of the points passed as the columns of a
+   * matrix
+   * @return cells and local coordinates for all points, see PointLocations
+   *
+   * The points are processed in parallel by lf::base::ParallelFor(). The
+   * result does not depend on the number of threads.
+   */
+  PointLocations LocatePoints(const Eigen::MatrixXd& points) const;
+
+ private:
+  /** @brief linear index of the bin containing a point, -1 if outside */
+  long BinIndex(const Eigen::VectorXd& x) const;
+
+  std::shared_ptr<const Mesh> mesh_p_;
+  double tol_;
+  /** pointers to cells, indexed by cell index */
+  std::vector<const Entity*> cells_;
+  /** lower and upper corners of cell bounding boxes, stacked in columns */
+  Eigen::MatrixXd cell_bbox_;
+  /** lower corner of the grid and size of the bins */
+  Eigen::VectorXd origin_, bin_size_;
+  /** number of bins in every coordinate direction */
+  std::vector<long> no_bins_;
+  /** cells overlapping the bins in compressed row format */
+  std::vector<size_type> bin_offsets_, bin_cells_;
+};
+
+}  // namespace lf::mesh::utils
+
+#endif
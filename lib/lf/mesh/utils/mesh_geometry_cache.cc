@@ -0,0 +1,92 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Implementation of the cache of geometric quantities of a mesh
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#include "mesh_geometry_cache.h"
+#include <lf/base/parallel_for.h>
+#include <algorithm>
+
+namespace lf::mesh::utils {
+
+MeshGeometryCache::MeshGeometryCache(std::shared_ptr<const Mesh> mesh_p)
+    : mesh_p_(std::move(mesh_p)) {
+  LF_VERIFY_MSG(mesh_p_ != nullptr, "No mesh supplied");
+  LF_VERIFY_MSG(mesh_p_->DimMesh() == 2, "Only 2D meshes are supported");
+}
+
+const Eigen::VectorXd& MeshGeometryCache::CellVolumes() const {
+  std::call_once(cell_data_flag_, [this]() { BuildCellData(); });
+  return cell_volumes_;
+}
+
+const Eigen::VectorXd& MeshGeometryCache::CellDiameters() const {
+  std::call_once(cell_data_flag_, [this]() { BuildCellData(); });
+  return cell_diameters_;
+}
+
+const Eigen::MatrixXd& MeshGeometryCache::CellBarycenters() const {
+  std::call_once(cell_data_flag_, [this]() { BuildCellData(); });
+  return cell_barycenters_;
+}
+
+const Eigen::VectorXd& MeshGeometryCache::EdgeLengths() const {
+  std::call_once(edge_data_flag_, [this]() { BuildEdgeData(); });
+  return edge_lengths_;
+}
+
+void MeshGeometryCache::BuildCellData() const {
+  const Mesh& mesh{*mesh_p_};
+  const size_type no_cells = mesh.Size(0);
+  cell_volumes_.resize(no_cells);
+  cell_diameters_.resize(no_cells);
+  cell_barycenters_.resize(mesh.DimWorld(), no_cells);
+  lf::base::ParallelFor(
+      no_cells,
+      [&](std::size_t begin, std::size_t end) {
+        for (std::size_t idx = begin; idx < end; ++idx) {
+          const Entity* cell = mesh.EntityByIndex(0, idx);
+          const lf::geometry::Geometry& geo{*cell->Geometry()};
+          const lf::base::RefEl ref_el = cell->RefEl();
+          const Eigen::MatrixXd& ref_corners = ref_el.NodeCoords();
+          const Eigen::MatrixXd corners = geo.Global(ref_corners);
+          double diam = 0.0;
+          for (Eigen::Index i = 0; i < corners.cols(); ++i) {
+            for (Eigen::Index j = i + 1; j < corners.cols(); ++j) {
+              diam = std::max(diam, (corners.col(i) - corners.col(j)).norm());
+            }
+          }
+          cell_volumes_[idx] = lf::geometry::Volume(geo);
+          cell_diameters_[idx] = diam;
+          cell_barycenters_.col(idx) =
+              geo.Global(ref_corners.rowwise().mean());
+        }
+      },
+      256);
+}
+
+void MeshGeometryCache::BuildEdgeData() const {
+  const Mesh& mesh{*mesh_p_};
+  const size_type no_edges = mesh.Size(1);
+  edge_lengths_.resize(no_edges);
+  lf::base::ParallelFor(
+      no_edges,
+      [&](std::size_t begin, std::size_t end) {
+        for (std::size_t idx = begin; idx < end; ++idx) {
+          edge_lengths_[idx] =
+              lf::geometry::Volume(*mesh.EntityByIndex(1, idx)->Geometry());
+        }
+      },
+      1024);
+}
+
+}  // namespace lf::mesh::utils
@@ -0,0 +1,110 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Lazily computed geometric quantities of the cells and edges of a
+ * mesh
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#ifndef _LF_MESH_GEOMETRY_CACHE_H_
+#define _LF_MESH_GEOMETRY_CACHE_H_
+
+#include <lf/mesh/mesh.h>
+#include <memory>
+#include <mutex>
+
+namespace lf::mesh::utils {
+
+/**
+ * @brief Contiguous arrays of cell volumes, cell diameters, cell barycenters
+ * and edge lengths of a mesh, computed on first use
+ *
+ * Error estimators, CFL conditions and marking strategies need these
+ * quantities for every cell in every step. Calling lf::geometry::Volume() or
+ * evaluating the geometry of every cell over and over again is wasteful,
+ * because meshes in LehrFEM++ cannot be modified once they have been built:
+ * the quantities only change when a new mesh is created, e.g., by
+ * refinement, and a cache bound to the mesh object never becomes stale.
+ *
+ * The arrays are indexed by the mesh index of the entities. The cell
+ * quantities and the edge lengths are built independently of each other the
+ * first time one of them is requested, in parallel by
+ * lf::base::ParallelFor(). Concurrent first requests from several threads
+ * are safe, all of them wait for the single computation.
+ *
+ * The quantities are defined as
+ * - volume: lf::geometry::Volume() of the cell,
+ * - diameter: largest distance of two vertices of the cell, which is the
+ *   diameter for cells with straight edges,
+ * - barycenter: image of the barycenter of the reference element, which is
+ *   the barycenter for affine cells,
+ * - edge length: lf::geometry::Volume() of the edge.
+ *
+ * @note Only meshes of dimension 2 are supported.
+ */
+class MeshGeometryCache {
+ public:
+  using size_type = lf::base::size_type;
+
+  /**
+   * @brief Bind a cache to a mesh; nothing is computed yet
+   *
+   * @param mesh_p pointer to the mesh
+   */
+  explicit MeshGeometryCache(std::shared_ptr<const Mesh> mesh_p);
+
+  MeshGeometryCache(const MeshGeometryCache&) = delete;
+  MeshGeometryCache& operator=(const MeshGeometryCache&) = delete;
+
+  /** @brief the underlying mesh */
+  std::shared_ptr<const Mesh> getMesh() const { return mesh_p_; }
+
+  /** @brief volumes of all cells, indexed by cell index */
+  const Eigen::VectorXd& CellVolumes() const;
+  /** @brief diameters of all cells, indexed by cell index */
+  const Eigen::VectorXd& CellDiameters() const;
+  /** @brief barycenters of all cells, in the column given by the cell index */
+  const Eigen::MatrixXd& CellBarycenters() const;
+  /** @brief lengths of all edges, indexed by edge index */
+  const Eigen::VectorXd& EdgeLengths() const;
+
+  /** @brief volume of a single cell */
+  double CellVolume(const Entity& cell) const {
+    return CellVolumes()[mesh_p_->Index(cell)];
+  }
+  /** @brief diameter of a single cell */
+  double CellDiameter(const Entity& cell) const {
+    return CellDiameters()[mesh_p_->Index(cell)];
+  }
+  /** @brief barycenter of a single cell */
+  Eigen::VectorXd CellBarycenter(const Entity& cell) const {
+    return CellBarycenters().col(mesh_p_->Index(cell));
+  }
+  /** @brief length of a single edge */
+  double EdgeLength(const Entity& edge) const {
+    return EdgeLengths()[mesh_p_->Index(edge)];
+  }
+
+ private:
+  /** @brief compute volumes, diameters and barycenters of all cells */
+  void BuildCellData() const;
+  /** @brief compute the lengths of all edges */
+  void BuildEdgeData() const;
+
+  std::shared_ptr<const Mesh> mesh_p_;
+  mutable std::once_flag cell_data_flag_, edge_data_flag_;
+  mutable Eigen::VectorXd cell_volumes_, cell_diameters_;
+  mutable Eigen::MatrixXd cell_barycenters_;
+  mutable Eigen::VectorXd edge_lengths_;
+};
+
+}  // namespace lf::mesh::utils
+
+#endif
@@ -0,0 +1,232 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Implementation of mesh partitioning and subdomain extraction
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#include "partition.h"
+#include <algorithm>
+#include <map>
+#include <limits>
+#include <numeric>
+
+namespace lf::mesh::utils {
+
+using size_type = lf::base::size_type;
+using glb_idx_t = lf::base::glb_idx_t;
+
+namespace {
+// Recursively bisect the range [first,last) of cell indices into num_parts
+// parts numbered starting from first_part
+void RCBSplit(const Eigen::MatrixXd& centers,
+              std::vector<glb_idx_t>::iterator first,
+              std::vector<glb_idx_t>::iterator last, size_type first_part,
+              size_type num_parts, std::vector<size_type>& cell_part) {
+  if (num_parts == 1) {
+    for (auto it = first; it != last; ++it) {
+      cell_part[*it] = first_part;
+    }
+    return;
+  }
+  // Determine coordinate direction of largest extent
+  const Eigen::Index dim = centers.rows();
+  Eigen::VectorXd lower =
+      Eigen::VectorXd::Constant(dim, std::numeric_limits<double>::max());
+  Eigen::VectorXd upper =
+      Eigen::VectorXd::Constant(dim, std::numeric_limits<double>::lowest());
+  for (auto it = first; it != last; ++it) {
+    lower = lower.cwiseMin(centers.col(*it));
+    upper = upper.cwiseMax(centers.col(*it));
+  }
+  Eigen::Index dir;
+  (upper - lower).maxCoeff(&dir);
+
+  // Split sizes proportional to the number of parts on either side
+  const size_type num_left_parts = num_parts / 2;
+  const auto n = static_cast<size_type>(last - first);
+  const auto mid = first + (static_cast<std::size_t>(n) * num_left_parts +
+                            num_parts / 2) /
+                               num_parts;
+  std::nth_element(first, mid, last,
+                   [&centers, dir](glb_idx_t i, glb_idx_t j) {
+                     const double ci = centers(dir, i);
+                     const double cj = centers(dir, j);
+                     return (ci < cj) || ((ci == cj) && (i < j));
+                   });
+  RCBSplit(centers, first, mid, first_part, num_left_parts, cell_part);
+  RCBSplit(centers, mid, last, first_part + num_left_parts,
+           num_parts - num_left_parts, cell_part);
+}
+}  // namespace
+
+std::vector<size_type> PartitionCellsRCB(const Mesh& mesh,
+                                         size_type num_parts) {
+  const size_type no_cells = mesh.Size(0);
+  LF_VERIFY_MSG((num_parts > 0) && (num_parts <= no_cells),
+                "Cannot split " << no_cells << " cells into " << num_parts
+                                << " parts");
+  // Barycenters of all cells
+  Eigen::MatrixXd centers(mesh.DimWorld(), no_cells);
+  for (const Entity& cell : mesh.Entities(0)) {
+    const lf::base::RefEl ref_el = cell.RefEl();
+    const Eigen::MatrixXd& ref_nodes = ref_el.NodeCoords();
+    const Eigen::VectorXd ref_center =
+        ref_nodes.rowwise().sum() / ref_el.NumNodes();
+    centers.col(mesh.Index(cell)) = cell.Geometry()->Global(ref_center);
+  }
+  std::vector<glb_idx_t> cell_idx(no_cells);
+  std::iota(cell_idx.begin(), cell_idx.end(), 0);
+  std::vector<size_type> cell_part(no_cells, 0);
+  RCBSplit(centers, cell_idx.begin(), cell_idx.end(), 0, num_parts,
+           cell_part);
+  return cell_part;
+}
+
+size_type CountEdgeCut(const Mesh& mesh,
+                       const std::vector<size_type>& cell_part) {
+  LF_ASSERT_MSG(cell_part.size() == mesh.Size(0),
+                "cell_part.size() = " << cell_part.size() << " <-> "
+                                      << mesh.Size(0) << " cells");
+  // For each edge record the part of the first adjacent cell encountered
+  std::vector<size_type> edge_part(mesh.Size(1), lf::base::kIdxNil);
+  std::vector<bool> edge_cut(mesh.Size(1), false);
+  for (const Entity& cell : mesh.Entities(0)) {
+    const size_type part = cell_part[mesh.Index(cell)];
+    for (const Entity& edge : cell.SubEntities(1)) {
+      const glb_idx_t edge_idx = mesh.Index(edge);
+      if (edge_part[edge_idx] == lf::base::kIdxNil) {
+        edge_part[edge_idx] = part;
+      } else if (edge_part[edge_idx] != part) {
+        edge_cut[edge_idx] = true;
+      }
+    }
+  }
+  return std::count(edge_cut.begin(), edge_cut.end(), true);
+}
+
+SubDomainMesh ExtractSubDomainMesh(const std::shared_ptr<const Mesh>& mesh_p,
+                                   const std::vector<size_type>& cell_part,
+                                   size_type part, MeshFactory& factory,
+                                   unsigned int num_ghost_layers) {
+  const Mesh& mesh{*mesh_p};
+  const lf::base::dim_t dim_mesh = mesh.DimMesh();
+  LF_VERIFY_MSG(dim_mesh == 2, "Only implemented for 2D meshes");
+  LF_VERIFY_MSG((factory.DimMesh() == dim_mesh) &&
+                    (factory.DimWorld() == mesh.DimWorld()),
+                "Dimension mismatch of mesh factory");
+  LF_ASSERT_MSG(cell_part.size() == mesh.Size(0),
+                "cell_part.size() = " << cell_part.size() << " <-> "
+                                      << mesh.Size(0) << " cells");
+  const size_type no_cells = mesh.Size(0);
+  const size_type no_nodes = mesh.Size(dim_mesh);
+
+  // Flag cells of the part
+  std::vector<bool> cell_in(no_cells);
+  for (glb_idx_t k = 0; k < no_cells; ++k) {
+    cell_in[k] = (cell_part[k] == part);
+  }
+  // Grow layers of ghost cells: add all cells sharing a vertex with a cell
+  // already selected
+  for (unsigned int layer = 0; layer < num_ghost_layers; ++layer) {
+    std::vector<bool> node_in(no_nodes, false);
+    for (const Entity& cell : mesh.Entities(0)) {
+      if (cell_in[mesh.Index(cell)]) {
+        for (const Entity& node : cell.SubEntities(dim_mesh)) {
+          node_in[mesh.Index(node)] = true;
+        }
+      }
+    }
+    for (const Entity& cell : mesh.Entities(0)) {
+      for (const Entity& node : cell.SubEntities(dim_mesh)) {
+        if (node_in[mesh.Index(node)]) {
+          cell_in[mesh.Index(cell)] = true;
+          break;
+        }
+      }
+    }
+  }
+
+  SubDomainMesh sub;
+  sub.part = part;
+  sub.local_to_global.resize(dim_mesh + 1);
+  sub.global_to_local.resize(dim_mesh + 1);
+  for (lf::base::dim_t codim = 0; codim <= dim_mesh; ++codim) {
+    sub.global_to_local[codim].assign(mesh.Size(codim), lf::base::kIdxNil);
+  }
+  std::vector<glb_idx_t>& node_g2l{sub.global_to_local[dim_mesh]};
+  std::vector<glb_idx_t>& cell_g2l{sub.global_to_local[0]};
+
+  // Nodes of the selected cells, in the order of their global indices
+  for (const Entity& cell : mesh.Entities(0)) {
+    if (cell_in[mesh.Index(cell)]) {
+      for (const Entity& node : cell.SubEntities(dim_mesh)) {
+        node_g2l[mesh.Index(node)] = 0;
+      }
+    }
+  }
+  for (glb_idx_t k = 0; k < no_nodes; ++k) {
+    if (node_g2l[k] != lf::base::kIdxNil) {
+      const Entity* node = mesh.EntityByIndex(dim_mesh, k);
+      node_g2l[k] = factory.AddPoint(node->Geometry()->SubGeometry(0, 0));
+      sub.local_to_global[dim_mesh].push_back(k);
+    }
+  }
+  // Selected cells with copies of their geometries
+  for (glb_idx_t k = 0; k < no_cells; ++k) {
+    if (cell_in[k]) {
+      const Entity* cell = mesh.EntityByIndex(0, k);
+      std::vector<size_type> nodes;
+      for (const Entity& node : cell->SubEntities(dim_mesh)) {
+        nodes.push_back(node_g2l[mesh.Index(node)]);
+      }
+      cell_g2l[k] = factory.AddEntity(
+          cell->RefEl(),
+          lf::base::ForwardRange<const size_type>(nodes.begin(), nodes.end()),
+          cell->Geometry()->SubGeometry(0, 0));
+      sub.local_to_global[0].push_back(k);
+      sub.is_ghost_cell.push_back(cell_part[k] != part);
+      sub.cell_part.push_back(cell_part[k]);
+    }
+  }
+  sub.mesh = factory.Build();
+  LF_VERIFY_MSG(sub.mesh->Size(0) == sub.local_to_global[0].size(),
+                "Cell count mismatch in subdomain mesh");
+
+  // Edges are created by the mesh factory, so they have to be matched via
+  // their endpoints
+  std::map<std::pair<glb_idx_t, glb_idx_t>, glb_idx_t> endpoints_to_edge;
+  for (glb_idx_t k : sub.local_to_global[0]) {
+    for (const Entity& edge : mesh.EntityByIndex(0, k)->SubEntities(1)) {
+      auto endpoints = edge.SubEntities(1);
+      const glb_idx_t p0 = node_g2l[mesh.Index(endpoints[0])];
+      const glb_idx_t p1 = node_g2l[mesh.Index(endpoints[1])];
+      endpoints_to_edge[{std::min(p0, p1), std::max(p0, p1)}] =
+          mesh.Index(edge);
+    }
+  }
+  const Mesh& loc_mesh{*sub.mesh};
+  std::vector<glb_idx_t>& edge_l2g{sub.local_to_global[1]};
+  edge_l2g.resize(loc_mesh.Size(1));
+  for (const Entity& edge : loc_mesh.Entities(1)) {
+    auto endpoints = edge.SubEntities(1);
+    const glb_idx_t p0 = loc_mesh.Index(endpoints[0]);
+    const glb_idx_t p1 = loc_mesh.Index(endpoints[1]);
+    auto it = endpoints_to_edge.find({std::min(p0, p1), std::max(p0, p1)});
+    LF_VERIFY_MSG(it != endpoints_to_edge.end(),
+                  "Edge of subdomain mesh not found in global mesh");
+    const glb_idx_t loc_idx = loc_mesh.Index(edge);
+    edge_l2g[loc_idx] = it->second;
+    sub.global_to_local[1][it->second] = loc_idx;
+  }
+  return sub;
+}
+
+}  // namespace lf::mesh::utils
@@ -0,0 +1,112 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Partitioning of meshes into subdomains and extraction of subdomain
+ * meshes with a layer of ghost cells
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#ifndef _LF_MESH_PARTITION_H_
+#define _LF_MESH_PARTITION_H_
+
+#include <lf/mesh/mesh.h>
+#include <vector>
+
+namespace lf::mesh::utils {
+
+/**
+ * @brief Partition the cells of a mesh by recursive coordinate bisection
+ *
+ * @param mesh the mesh whose cells are to be distributed
+ * @param num_parts number of subdomains, must be positive and must not
+ * exceed the number of cells.
+ * @return vector of length `mesh.Size(0)`, whose k-th entry contains the
+ * number (in the range `0..num_parts-1`) of the part to which the cell with
+ * index k is assigned.
+ *
+ * The cells are represented by their barycenters. The set of barycenters
+ * is split recursively by a hyperplane perpendicular to the coordinate
+ * direction of largest extent. The splitting is done such that the number
+ * of cells in each part is proportional to the number of subdomains it is
+ * to be split into further. Thus the sizes of the parts differ by at most one
+ * cell, also when `num_parts` is not a power of two.
+ *
+ * Since the subdomains are geometrically compact, the number of edges
+ * between cells of different subdomains (the "edge cut") remains small for
+ * shape-regular meshes.
+ *
+ * The result is deterministic: ties in the coordinates are broken by cell
+ * indices.
+ */
+std::vector<lf::base::size_type> PartitionCellsRCB(
+    const Mesh& mesh, lf::base::size_type num_parts);
+
+/**
+ * @brief Number of edges (entities of co-dimension 1) shared by cells
+ * belonging to different parts
+ *
+ * @param mesh underlying mesh
+ * @param cell_part assignment of cells to parts, as returned from
+ * PartitionCellsRCB()
+ * @return the size of the edge cut of the partition
+ */
+lf::base::size_type CountEdgeCut(
+    const Mesh& mesh, const std::vector<lf::base::size_type>& cell_part);
+
+/**
+ * @brief Mesh for a subdomain together with its embedding into the global
+ * mesh
+ *
+ * All index maps are indexed by co-dimension first. An index map from the
+ * global to the local mesh contains lf::base::kIdxNil for all global entities
+ * that are not present in the subdomain mesh.
+ */
+struct SubDomainMesh {
+  /** part number of the subdomain */
+  lf::base::size_type part;
+  /** mesh covering the cells of the part and the ghost cells */
+  std::shared_ptr<Mesh> mesh;
+  /** local entity index -> global entity index */
+  std::vector<std::vector<lf::base::glb_idx_t>> local_to_global;
+  /** global entity index -> local entity index or kIdxNil */
+  std::vector<std::vector<lf::base::glb_idx_t>> global_to_local;
+  /** flags for cells of the local mesh belonging to another part */
+  std::vector<bool> is_ghost_cell;
+  /** part numbers of the cells of the local mesh */
+  std::vector<lf::base::size_type> cell_part;
+};
+
+/**
+ * @brief Extract the mesh for a subdomain of a partitioned mesh
+ *
+ * @param mesh_p pointer to the global mesh
+ * @param cell_part assignment of cells to parts, see PartitionCellsRCB()
+ * @param part number of the part to be extracted
+ * @param factory mesh factory used for building the subdomain mesh; must be
+ * compatible with the dimensions of the global mesh.
+ * @param num_ghost_layers number of layers of ghost cells around the part
+ * @return a SubDomainMesh object holding the local mesh and the index maps
+ *
+ * The local mesh contains all cells of the part and in addition all cells
+ * which can be reached from a cell of the part by crossing at most
+ * `num_ghost_layers` vertices. The latter are the ghost cells.
+ *
+ * Points and cells of the local mesh are numbered in the order of their
+ * global indices. The geometry objects of the local entities are copies of
+ * the global ones.
+ */
+SubDomainMesh ExtractSubDomainMesh(
+    const std::shared_ptr<const Mesh>& mesh_p,
+    const std::vector<lf::base::size_type>& cell_part, lf::base::size_type part,
+    MeshFactory& factory, unsigned int num_ghost_layers = 1);
+
+}  // namespace lf::mesh::utils
+
+#endif
@@ -0,0 +1,94 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Tests for the location of points in meshes
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#include <gtest/gtest.h>
+#include <lf/mesh/hybrid2d/hybrid2d.h>
+#include <lf/mesh/utils/utils.h>
+#include "lf/mesh/test_utils/test_meshes.h"
+
+namespace lf::mesh::utils::test {
+
+// Locate the images of random points of every cell
+void CheckLocateCellPoints(const std::shared_ptr<const Mesh>& mesh_p) {
+  const CellLocator locator(mesh_p);
+  for (const Entity& cell : mesh_p->Entities(0)) {
+    // random points in the reference element
+    Eigen::MatrixXd xi = 0.5 * (Eigen::MatrixXd::Random(2, 10).array() + 1.0);
+    if (cell.RefEl() == lf::base::RefEl::kTria()) {
+      for (Eigen::Index k = 0; k < xi.cols(); ++k) {
+        if (xi.col(k).sum() > 1.0) {
+          xi.col(k) = Eigen::Vector2d::Ones() - xi.col(k);
+        }
+      }
+    }
+    // include the vertices
+    xi.leftCols(cell.RefEl().NumNodes()) = cell.RefEl().NodeCoords();
+    const Eigen::MatrixXd x = cell.Geometry()->Global(xi);
+
+    const CellLocator::PointLocations loc = locator.LocatePoints(x);
+    ASSERT_EQ(loc.cells.size(), x.cols());
+    for (Eigen::Index k = 0; k < x.cols(); ++k) {
+      ASSERT_NE(loc.cells[k], nullptr) << "point " << x.col(k).transpose();
+      // Interior points must be found in their cell, points on the boundary
+      // in some cell mapping the local coordinates to them
+      if (k >= cell.RefEl().NumNodes()) {
+        EXPECT_EQ(loc.cells[k], &cell);
+        EXPECT_TRUE(loc.local.col(k).isApprox(xi.col(k), 1.0E-10));
+      }
+      const Eigen::VectorXd x_k =
+          loc.cells[k]->Geometry()->Global(loc.local.col(k));
+      EXPECT_TRUE(x_k.isApprox(x.col(k), 1.0E-10));
+      // single point version yields the same result
+      auto [c, loc_k] = locator.Locate(x.col(k));
+      EXPECT_EQ(c, loc.cells[k]);
+      EXPECT_TRUE(loc_k.isApprox(loc.local.col(k)));
+    }
+  }
+}
+
+TEST(test_cell_locator, hybrid_meshes) {
+  for (int selector = 0; selector <= 4; ++selector) {
+    CheckLocateCellPoints(
+        lf::mesh::test_utils::GenerateHybrid2DTestMesh(selector));
+  }
+}
+
+TEST(test_cell_locator, outside_and_batched) {
+  hybrid2d::TPTriagMeshBuilder builder(
+      std::make_shared<hybrid2d::MeshFactory>(2));
+  builder.setBottomLeftCorner(Eigen::Vector2d{0, 0})
+      .setTopRightCorner(Eigen::Vector2d{1, 1})
+      .setNoXCells(20)
+      .setNoYCells(20);
+  const CellLocator locator(builder.Build());
+  Eigen::MatrixXd x(2, 4);
+  x << -0.1, 0.5, 1.0 + 1.0E-6, 0.3,  //
+      0.5, 2.0, 0.5, -1.0E-6;
+  const auto loc = locator.LocatePoints(x);
+  for (const Entity* cell : loc.cells) {
+    EXPECT_EQ(cell, nullptr);
+  }
+  // many points: parallel batched location
+  const Eigen::MatrixXd y =
+      0.5 * (Eigen::MatrixXd::Random(2, 5000).array() + 1.0);
+  const auto loc_y = locator.LocatePoints(y);
+  for (Eigen::Index k = 0; k < y.cols(); ++k) {
+    ASSERT_NE(loc_y.cells[k], nullptr);
+    const Eigen::VectorXd x_k =
+        loc_y.cells[k]->Geometry()->Global(loc_y.local.col(k));
+    EXPECT_TRUE(x_k.isApprox(y.col(k), 1.0E-10));
+  }
+}
+
+}  // namespace lf::mesh::utils::test
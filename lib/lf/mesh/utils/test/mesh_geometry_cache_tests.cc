@@ -0,0 +1,80 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Tests for the cache of geometric quantities of a mesh
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#include <gtest/gtest.h>
+#include <lf/mesh/hybrid2d/hybrid2d.h>
+#include <lf/mesh/utils/utils.h>
+#include <thread>
+#include "lf/mesh/test_utils/test_meshes.h"
+
+namespace lf::mesh::utils::test {
+
+TEST(test_mesh_geometry_cache, hybrid_meshes) {
+  for (int selector = 0; selector <= 4; ++selector) {
+    auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh(selector);
+    const MeshGeometryCache cache(mesh_p);
+    ASSERT_EQ(cache.CellVolumes().size(), mesh_p->Size(0));
+    ASSERT_EQ(cache.EdgeLengths().size(), mesh_p->Size(1));
+    double total_volume = 0.0;
+    for (const Entity& cell : mesh_p->Entities(0)) {
+      const lf::geometry::Geometry& geo{*cell.Geometry()};
+      EXPECT_DOUBLE_EQ(cache.CellVolume(cell), lf::geometry::Volume(geo));
+      total_volume += cache.CellVolume(cell);
+      // The diameter is not smaller than any edge and the barycenter
+      // is closer to each vertex than the diameter
+      const Eigen::MatrixXd corners =
+          geo.Global(cell.RefEl().NodeCoords());
+      for (Eigen::Index k = 0; k < corners.cols(); ++k) {
+        EXPECT_LE((corners.col(k) - cache.CellBarycenter(cell)).norm(),
+                  cache.CellDiameter(cell));
+      }
+      for (const Entity& edge : cell.SubEntities(1)) {
+        EXPECT_LE(cache.EdgeLength(edge), cache.CellDiameter(cell) + 1e-14);
+      }
+    }
+    EXPECT_NEAR(total_volume, cache.CellVolumes().sum(), 1.0E-12);
+  }
+}
+
+TEST(test_mesh_geometry_cache, structured_mesh) {
+  hybrid2d::TPQuadMeshBuilder builder(
+      std::make_shared<hybrid2d::MeshFactory>(2));
+  builder.setBottomLeftCorner(Eigen::Vector2d{0, 0})
+      .setTopRightCorner(Eigen::Vector2d{3, 2})
+      .setNoXCells(30)
+      .setNoYCells(40);
+  const MeshGeometryCache cache(builder.Build());
+  // Concurrent first use from several threads
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&cache]() { cache.CellDiameters(); });
+  }
+  for (std::thread& t : threads) {
+    t.join();
+  }
+  EXPECT_NEAR(cache.CellVolumes().sum(), 6.0, 1.0E-12);
+  EXPECT_TRUE((cache.CellDiameters().array() - std::hypot(0.1, 0.05))
+                  .abs()
+                  .maxCoeff() < 1.0E-12);
+  EXPECT_NEAR(cache.CellBarycenters().rowwise().mean()[0], 1.5, 1.0E-12);
+  EXPECT_NEAR(cache.CellBarycenters().rowwise().mean()[1], 1.0, 1.0E-12);
+  // Edges have length 0.1 or 0.05
+  for (Eigen::Index k = 0; k < cache.EdgeLengths().size(); ++k) {
+    const double l = cache.EdgeLengths()[k];
+    EXPECT_TRUE(std::abs(l - 0.1) < 1.0E-12 || std::abs(l - 0.05) < 1.0E-12)
+        << "edge length " << l;
+  }
+}
+
+}  // namespace lf::mesh::utils::test
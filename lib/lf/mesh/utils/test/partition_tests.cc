@@ -0,0 +1,125 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Tests for mesh partitioning and extraction of subdomain meshes
+ * @author agent
+ * @date 2026-10-19
+ * @copyright MIT License
+ */
+
+#include <gtest/gtest.h>
+#include <lf/mesh/hybrid2d/hybrid2d.h>
+#include <lf/mesh/utils/utils.h>
+#include <algorithm>
+#include "lf/mesh/test_utils/check_entity_indexing.h"
+#include "lf/mesh/test_utils/test_meshes.h"
+
+namespace lf::mesh::utils::test {
+
+using size_type = lf::base::size_type;
+
+std::shared_ptr<Mesh> TestSquareMesh(size_type n) {
+  hybrid2d::TPTriagMeshBuilder builder(
+      std::make_shared<hybrid2d::MeshFactory>(2));
+  builder.setBottomLeftCorner(Eigen::Vector2d{0, 0})
+      .setTopRightCorner(Eigen::Vector2d{1, 1})
+      .setNoXCells(n)
+      .setNoYCells(n);
+  return builder.Build();
+}
+
+TEST(test_mesh_partition, rcb_balance) {
+  auto mesh_p = TestSquareMesh(8);
+  const size_type no_cells = mesh_p->Size(0);
+  for (size_type num_parts : {1, 2, 3, 5, 8}) {
+    auto cell_part = PartitionCellsRCB(*mesh_p, num_parts);
+    ASSERT_EQ(cell_part.size(), no_cells);
+    std::vector<size_type> part_size(num_parts, 0);
+    for (size_type p : cell_part) {
+      ASSERT_LT(p, num_parts);
+      part_size[p]++;
+    }
+    const auto [min_it, max_it] =
+        std::minmax_element(part_size.begin(), part_size.end());
+    EXPECT_LE(*max_it - *min_it, 1) << num_parts << " parts unbalanced";
+    // Compact subdomains: cut size of the order of the interface length
+    EXPECT_LE(CountEdgeCut(*mesh_p, cell_part), 8 * 4 * num_parts)
+        << num_parts << " parts";
+  }
+  EXPECT_EQ(CountEdgeCut(*mesh_p, PartitionCellsRCB(*mesh_p, 1)), 0);
+}
+
+void CheckSubDomains(const std::shared_ptr<Mesh>& mesh_p, size_type num_parts,
+                     unsigned int num_ghost_layers) {
+  auto cell_part = PartitionCellsRCB(*mesh_p, num_parts);
+  std::vector<size_type> owned_cnt(mesh_p->Size(0), 0);
+  for (size_type part = 0; part < num_parts; ++part) {
+    hybrid2d::MeshFactory factory(2);
+    SubDomainMesh sub = ExtractSubDomainMesh(mesh_p, cell_part, part, factory,
+                                             num_ghost_layers);
+    const Mesh& loc_mesh{*sub.mesh};
+    lf::mesh::test_utils::checkEntityIndexing(loc_mesh);
+    ASSERT_EQ(sub.is_ghost_cell.size(), loc_mesh.Size(0));
+    for (lf::base::dim_t codim = 0; codim <= 2; ++codim) {
+      ASSERT_EQ(sub.local_to_global[codim].size(), loc_mesh.Size(codim));
+      for (const Entity& e : loc_mesh.Entities(codim)) {
+        const size_type loc_idx = loc_mesh.Index(e);
+        const size_type glb_idx = sub.local_to_global[codim][loc_idx];
+        EXPECT_EQ(sub.global_to_local[codim][glb_idx], loc_idx);
+        const Entity* glb_e = mesh_p->EntityByIndex(codim, glb_idx);
+        EXPECT_EQ(glb_e->RefEl(), e.RefEl());
+        // Entities must have the same vertices, edges may be flipped
+        const Eigen::MatrixXd& ref_nodes = e.RefEl().NodeCoords();
+        const Eigen::MatrixXd loc_corners = e.Geometry()->Global(ref_nodes);
+        const Eigen::MatrixXd glb_corners =
+            glb_e->Geometry()->Global(ref_nodes);
+        EXPECT_TRUE(loc_corners.isApprox(glb_corners) ||
+                    ((codim == 1) &&
+                     loc_corners.rowwise().reverse().isApprox(glb_corners)))
+            << "codim " << static_cast<int>(codim) << " entity " << loc_idx;
+      }
+    }
+    for (size_type k = 0; k < loc_mesh.Size(0); ++k) {
+      const size_type glb_idx = sub.local_to_global[0][k];
+      EXPECT_EQ(sub.is_ghost_cell[k], cell_part[glb_idx] != part);
+      if (!sub.is_ghost_cell[k]) {
+        owned_cnt[glb_idx]++;
+      }
+    }
+    // Every cell of the part is present, ghosts exist if there is more than
+    // one part
+    for (size_type k = 0; k < mesh_p->Size(0); ++k) {
+      if (cell_part[k] == part) {
+        EXPECT_NE(sub.global_to_local[0][k], lf::base::kIdxNil);
+      }
+    }
+    if ((num_parts > 1) && (num_ghost_layers > 0)) {
+      EXPECT_GT(std::count(sub.is_ghost_cell.begin(), sub.is_ghost_cell.end(),
+                           true),
+                0);
+    }
+  }
+  for (size_type cnt : owned_cnt) {
+    EXPECT_EQ(cnt, 1) << "Every cell must be owned by exactly one part";
+  }
+}
+
+TEST(test_mesh_partition, subdomain_tria) {
+  CheckSubDomains(TestSquareMesh(6), 4, 1);
+  CheckSubDomains(TestSquareMesh(6), 3, 2);
+  CheckSubDomains(TestSquareMesh(6), 2, 0);
+}
+
+TEST(test_mesh_partition, subdomain_hybrid) {
+  for (int selector = 0; selector <= 4; ++selector) {
+    auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh(selector);
+    CheckSubDomains(mesh_p, std::min<size_type>(3, mesh_p->Size(0)), 1);
+  }
+}
+
+}  // namespace lf::mesh::utils::test
@@ -21,6 +21,8 @@ CONTROLDECLARECOMMENT(TorusMeshBuilder, output_ctrl_, "torus_output_ctrl",
                       "Diagnostics control for TorusMeshBuilder");
 
 std::shared_ptr<mesh::Mesh> TorusMeshBuilder::Build() {
+  // Geometries are allocated in bulk, if the mesh factory supports it
+  const geometry::GeometryArena::Scope scope(mesh_factory_->Arena());
   using coord_t = Eigen::Vector3d;
 
   const size_type nx = no_of_x_cells_;
@@ -10,6 +10,8 @@ CONTROLDECLARECOMMENT(TPQuadMeshBuilder, output_ctrl_, "tpquad_output_ctrl",
                       "Diagnostics control for TPQuadMeshBuilder");
 
 std::shared_ptr<mesh::Mesh> TPQuadMeshBuilder::Build() {
+  // Geometries are allocated in bulk, if the mesh factory supports it
+  const geometry::GeometryArena::Scope scope(mesh_factory_->Arena());
   using coord_t = Eigen::Vector2d;
   const size_type nx = no_of_x_cells_;
   const size_type ny = no_of_y_cells_;
@@ -10,6 +10,8 @@ CONTROLDECLARECOMMENT(TPTriagMeshBuilder, output_ctrl_, "tpquad_output_ctrl",
                       "Diagnostics control for TPTriagMeshBuilder");
 
 std::shared_ptr<mesh::Mesh> TPTriagMeshBuilder::Build() {
+  // Geometries are allocated in bulk, if the mesh factory supports it
+  const geometry::GeometryArena::Scope scope(mesh_factory_->Arena());
   using coord_t = Eigen::Vector2d;
   const size_type nx = no_of_x_cells_;
   const size_type ny = no_of_y_cells_;
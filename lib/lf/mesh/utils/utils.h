@@ -16,8 +16,11 @@
 namespace lf::mesh::utils {}
 
 #include "all_codim_mesh_data_set.h"
+#include "cell_locator.h"
 #include "codim_mesh_data_set.h"
 #include "mesh_data_set.h"
+#include "mesh_geometry_cache.h"
+#include "partition.h"
 #include "print_info.h"
 #include "special_entity_sets.h"
 #include "structured_mesh_builder.h"
@@ -0,0 +1,173 @@
+/**
+ * @file
+ * @brief Quadrature rules whose number of points is known at compile time
+ * @author agent
+ * @date   2026-10-19
+ * @copyright MIT License
+ */
+
+#ifndef __9c41f7a2d35e4b0e8f6a2c1d7b3e5f80
+#define __9c41f7a2d35e4b0e8f6a2c1d7b3e5f80
+
+#include "quad_rule.h"
+#include "quad_rule_tables.h"
+
+namespace lf::quad {
+
+namespace detail {
+
+/**
+ * @brief Location and size of the static data of a FixedQuadRule
+ *
+ * Every specialization provides the number of points `kNumPoints`, the
+ * order `kOrder` and pointers `kPoints`, `kWeights` to static storage.
+ */
+template <base::RefElType REF_EL, int ORDER>
+struct FixedQuadRuleData;
+
+template <int ORDER>
+struct FixedQuadRuleData<base::RefElType::kSegment, ORDER> {
+  static_assert(ORDER >= 0 &&
+                    ORDER / 2 + 1 <= int(kMaxGaussLegendreTablePoints),
+                "No tabulated Gauss-Legendre rule of this order");
+  static constexpr int kNumPoints = ORDER / 2 + 1;
+  static constexpr quadOrder_t kOrder = 2 * kNumPoints - 1;
+  static constexpr const double* kPoints =
+      kGaussLegendrePoints + GaussLegendreTableOffset(kNumPoints);
+  static constexpr const double* kWeights =
+      kGaussLegendreWeights + GaussLegendreTableOffset(kNumPoints);
+};
+
+/**
+ * @brief Tensor product of the `N`-point Gauss-Legendre rule with itself,
+ * evaluated at compile time
+ *
+ * The points are ordered in the same way as by make_QuadRule(): the point
+ * with index `i*N+j` is \f$ (\xi_i,\xi_j) \f$.
+ */
+template <int N>
+struct GaussLegendreTensorTable {
+  static constexpr std::array<double, 2 * N * N> MakePoints() {
+    const double* p = kGaussLegendrePoints + GaussLegendreTableOffset(N);
+    std::array<double, 2 * N * N> points{};
+    for (int i = 0; i < N; ++i) {
+      for (int j = 0; j < N; ++j) {
+        points[2 * (i * N + j)] = p[i];
+        points[2 * (i * N + j) + 1] = p[j];
+      }
+    }
+    return points;
+  }
+  static constexpr std::array<double, N * N> MakeWeights() {
+    const double* w = kGaussLegendreWeights + GaussLegendreTableOffset(N);
+    std::array<double, N * N> weights{};
+    for (int i = 0; i < N; ++i) {
+      for (int j = 0; j < N; ++j) {
+        weights[i * N + j] = w[i] * w[j];
+      }
+    }
+    return weights;
+  }
+
+  static constexpr std::array<double, 2 * N * N> kPoints = MakePoints();
+  static constexpr std::array<double, N * N> kWeights = MakeWeights();
+};
+
+template <int ORDER>
+struct FixedQuadRuleData<base::RefElType::kQuad, ORDER> {
+  static_assert(ORDER >= 0 &&
+                    ORDER / 2 + 1 <= int(kMaxGaussLegendreTablePoints),
+                "No tabulated Gauss-Legendre rule of this order");
+  static constexpr int kNumPoints1D = ORDER / 2 + 1;
+  static constexpr int kNumPoints = kNumPoints1D * kNumPoints1D;
+  static constexpr quadOrder_t kOrder = 2 * kNumPoints1D - 1;
+  static constexpr const double* kPoints =
+      GaussLegendreTensorTable<kNumPoints1D>::kPoints.data();
+  static constexpr const double* kWeights =
+      GaussLegendreTensorTable<kNumPoints1D>::kWeights.data();
+};
+
+template <int ORDER>
+struct FixedQuadRuleData<base::RefElType::kTria, ORDER> {
+  static_assert(ORDER >= 1 && ORDER <= kMaxTriaRuleOrder,
+                "No hard-coded triangle rule of this order");
+  // There is no rule of order 3, the one of order 4 is used instead
+  static constexpr int kTableOrder = (ORDER == 3) ? 4 : ORDER;
+  static constexpr int kNumPoints = kTriaRuleNumPoints[kTableOrder];
+  static constexpr quadOrder_t kOrder = kTableOrder;
+  static constexpr const double* kPoints =
+      kTriaRulePoints + 2 * TriaRuleOffset(kTableOrder);
+  static constexpr const double* kWeights =
+      kTriaRuleWeights + TriaRuleOffset(kTableOrder);
+};
+
+}  // namespace detail
+
+/**
+ * @brief A quadrature rule whose reference element, order and number of
+ * points are template arguments
+ *
+ * The points and weights are the same as those of
+ * `make_QuadRule(RefEl(REF_EL), ORDER)`. They are not copied but read
+ * directly from static arrays that are initialized at compile time, through
+ * `Eigen::Map` objects of fixed size. Therefore fetching a FixedQuadRule
+ * involves no allocation, and loops over its points can be unrolled by the
+ * compiler.
+ *
+ * @tparam REF_EL The reference element
+ * @tparam ORDER The minimum order of the rule. Supported are orders up to 31
+ * for segments and quadrilaterals and orders 1 to 50 for triangles.
+ *
+ * #### Usage
+ * @code
+ * using qr_t = lf::quad::FixedQuadRule<lf::base::RefEl::kTria(), 4>;
+ * double sum = 0;
+ * for (int k = 0; k < qr_t::kNumPoints; ++k) {
+ *   sum += qr_t::Weights()[k] * f(qr_t::Points().col(k));
+ * }
+ * @endcode
+ */
+template <base::RefElType REF_EL, int ORDER>
+class FixedQuadRule {
+  using data_t = detail::FixedQuadRuleData<REF_EL, ORDER>;
+
+ public:
+  /** @brief dimension of the reference element */
+  static constexpr base::dim_t kDim = base::RefEl(REF_EL).Dimension();
+  /** @brief number of quadrature points */
+  static constexpr int kNumPoints = data_t::kNumPoints;
+  /** @brief the order of the rule, see QuadRule::Order() */
+  static constexpr quadOrder_t kOrder = data_t::kOrder;
+
+  /** @brief Type of the view of the quadrature points */
+  using points_t = Eigen::Map<const Eigen::Matrix<double, kDim, kNumPoints>>;
+  /** @brief Type of the view of the quadrature weights */
+  using weights_t = Eigen::Map<const Eigen::Matrix<double, kNumPoints, 1>>;
+
+  /** @brief The reference element over which this rule integrates */
+  static constexpr base::RefEl RefEl() { return base::RefEl(REF_EL); }
+
+  /** @brief @copybrief QuadRule::Order() */
+  static constexpr quadOrder_t Order() { return kOrder; }
+
+  /** @brief @copybrief QuadRule::NumPoints() */
+  static constexpr base::size_type NumPoints() { return kNumPoints; }
+
+  /**
+   * @brief The quadrature points as columns of a fixed size
+   * `kDim x kNumPoints` matrix
+   */
+  static points_t Points() { return points_t(data_t::kPoints); }
+
+  /** @brief The quadrature weights as a fixed size vector */
+  static weights_t Weights() { return weights_t(data_t::kWeights); }
+
+  /** @brief Copy the rule into an ordinary QuadRule object */
+  static QuadRule ToQuadRule() {
+    return QuadRule(RefEl(), Points(), Weights(), kOrder);
+  }
+};
+
+}  // namespace lf::quad
+
+#endif  // __9c41f7a2d35e4b0e8f6a2c1d7b3e5f80
@@ -8,24 +8,49 @@
 
 #include "make_quad_rule.h"
 #include <Eigen/KroneckerProduct>
+#include <array>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include "fixed_quad_rule.h"
 #include "gauss_quadrature.h"
 
 namespace lf::quad {
 namespace detail {
 template <base::RefElType REF_EL, int Order>
-QuadRule HardcodedQuadRule();
+QuadRule HardcodedQuadRule() {
+  return FixedQuadRule<REF_EL, Order>::ToQuadRule();
 }
 
-QuadRule make_QuadRule(base::RefEl ref_el, unsigned char order) {
+/**
+ * @brief Same as GaussLegendre(), but the rules with few points are read
+ * from kGaussLegendrePoints and kGaussLegendreWeights
+ */
+std::tuple<Eigen::VectorXd, Eigen::VectorXd> TabulatedGaussLegendre(
+    unsigned int num_points) {
+  if (num_points <= kMaxGaussLegendreTablePoints) {
+    const unsigned int offset = GaussLegendreTableOffset(num_points);
+    return {Eigen::Map<const Eigen::VectorXd>(kGaussLegendrePoints + offset,
+                                              num_points),
+            Eigen::Map<const Eigen::VectorXd>(kGaussLegendreWeights + offset,
+                                              num_points)};
+  }
+  return GaussLegendre(num_points);
+}
+
+/**
+ * @brief Actually builds the quadrature rule returned by make_QuadRule()
+ */
+QuadRule ComputeQuadRule(base::RefEl ref_el, quadOrder_t order) {
   if (ref_el == base::RefEl::kSegment()) {
     quadOrder_t n = order / 2 + 1;
-    auto [points, weights] = GaussLegendre(n);
+    auto [points, weights] = TabulatedGaussLegendre(n);
     return QuadRule(base::RefEl::kSegment(), points.transpose(),
                     std::move(weights), 2 * n - 1);
   }
   if (ref_el == base::RefEl::kQuad()) {
     quadOrder_t n = order / 2 + 1;
-    auto [points1d, weights1d] = GaussLegendre(n);
+    auto [points1d, weights1d] = TabulatedGaussLegendre(n);
     Eigen::MatrixXd points2d(2, n * n);
     points2d.row(0) = Eigen::kroneckerProduct(points1d.transpose(),
                                               Eigen::MatrixXd::Ones(1, n));
@@ -138,7 +163,7 @@ QuadRule make_QuadRule(base::RefEl ref_el, unsigned char order) {
         // Create a quadrule using tensor product quadrature rule + duffy
         // transform
         quadOrder_t n = order / 2 + 1;
-        auto [leg_p, leg_w] = GaussLegendre(n);
+        auto [leg_p, leg_w] = TabulatedGaussLegendre(n);
         auto [jac_p, jac_w] = GaussJacobi(n, 1, 0);
         jac_p.array() = (jac_p.array() + 1) / 2.;  // rescale to [0,1]
         jac_w.array() *= 0.25;
@@ -153,4 +178,30 @@ QuadRule make_QuadRule(base::RefEl ref_el, unsigned char order) {
   LF_VERIFY_MSG(
       false, "No Quadrature rules implemented for this reference element yet.");
 }
+}  // namespace detail
+
+const QuadRule& QuadRuleCache(base::RefEl ref_el, quadOrder_t order) {
+  // One slot for every reference element type and every possible order.
+  // Function-local statics are initialized thread-safely, and the
+  // std::once_flag of a slot makes sure that its rule is built only once.
+  struct Slot {
+    std::once_flag flag;
+    std::optional<QuadRule> rule;
+  };
+  static constexpr std::size_t kNumOrders =
+      std::numeric_limits<quadOrder_t>::max() + 1;
+  static std::array<std::array<Slot, kNumOrders>, 4> slots;
+
+  const auto type =
+      static_cast<std::size_t>(static_cast<base::RefElType>(ref_el));
+  Slot& slot = slots[type][order];
+  std::call_once(slot.flag, [&slot, ref_el, order]() {
+    slot.rule.emplace(detail::ComputeQuadRule(ref_el, order));
+  });
+  return *slot.rule;
+}
+
+QuadRule make_QuadRule(base::RefEl ref_el, unsigned char order) {
+  return QuadRuleCache(ref_el, order);
+}
 }  // namespace lf::quad
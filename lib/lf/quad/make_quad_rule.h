@@ -24,6 +24,27 @@ namespace lf::quad {
  * 50, afterwards, the Duffy-Transform to map a tensor Gaussian Quadrature on a
  * Square to the triangle.
  * - For Quadrilaterals it uses tensor products of Gauss-Legendre rules
+ *
+ * The returned object is a copy of the rule held by QuadRuleCache(), so
+ * the quadrature points and weights are only computed once per process.
  */
 QuadRule make_QuadRule(base::RefEl ref_el, unsigned char order);
+
+/**
+ * @brief Returns a reference to a shared, immutable QuadRule object for the
+ * given Reference Element and Order
+ * @param ref_el The type of reference element
+ * @param order The minimum order that the QuadRule object should have.
+ * @return The same QuadRule as make_QuadRule(), but without copying it.
+ *
+ * The rule for a pair `(ref_el, order)` is built on the first call and kept
+ * until the program terminates; all later calls with the same arguments
+ * return a reference to the same object. The function is thread-safe: if
+ * several threads request a rule that has not been built yet, exactly one
+ * of them builds it and the others wait.
+ *
+ * Prefer this function over make_QuadRule() in code that fetches quadrature
+ * rules repeatedly, e.g., inside loops over the cells of a mesh.
+ */
+const QuadRule& QuadRuleCache(base::RefEl ref_el, quadOrder_t order);
 }  // namespace lf::quad
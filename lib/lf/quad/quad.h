@@ -9,6 +9,7 @@
 #ifndef __1f1e78e74a804e5490813ec6a9148231
 #define __1f1e78e74a804e5490813ec6a9148231
 
+#include "fixed_quad_rule.h"
 #include "make_quad_rule.h"
 
 /** @brief Rules for numerical quadrature on reference entity shapes
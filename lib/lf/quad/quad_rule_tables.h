@@ -0,0 +1,391 @@
+/**
+ * @file
+ * @brief Quadrature points and weights stored in static arrays
+ * @author agent
+ * @date   2026-10-19
+ * @copyright MIT License
+ */
+
+#ifndef __5e2b8d0c41a74f3c9a6e1b7d3f08c2a9
+#define __5e2b8d0c41a74f3c9a6e1b7d3f08c2a9
+
+#include <array>
+#include "quad_rule.h"
+
+namespace lf::quad::detail {
+
+/**
+ * @brief Largest number of points for which the Gauss-Legendre rule on
+ * \f$ [0,1] \f$ is tabulated in kGaussLegendrePoints and
+ * kGaussLegendreWeights.
+ */
+constexpr unsigned int kMaxGaussLegendreTablePoints = 16;
+
+/**
+ * @brief Position of the first point/weight of the `num_points`-point
+ * Gauss-Legendre rule in kGaussLegendrePoints and kGaussLegendreWeights.
+ */
+constexpr unsigned int GaussLegendreTableOffset(unsigned int num_points) {
+  return num_points * (num_points - 1) / 2;
+}
+
+// clang-format off
+
+/**
+ * @brief Nodes of the Gauss-Legendre rules on \f$ [0,1] \f$ with
+ * \f$ 1,\ldots,16 \f$ points, one rule after the other.
+ *
+ * The values have been computed with GaussLegendre().
+ */
+inline constexpr double kGaussLegendrePoints[] = {
+    // 1 point
+    0.5,
+    // 2 points
+    0.21132486540518713447,
+    0.78867513459481286553,
+    // 3 points
+    0.11270166537925831174,
+    0.5,
+    0.88729833462074170214,
+    // 4 points
+    0.069431844202973713731,
+    0.33000947820757187134,
+    0.66999052179242812866,
+    0.93056815579702623076,
+    // 5 points
+    0.046910077030668004272,
+    0.23076534494715844614,
+    0.5,
+    0.76923465505284149835,
+    0.95308992296933203736,
+    // 6 points
+    0.033765242898423988849,
+    0.16939530676686775923,
+    0.38069040695840156152,
+    0.61930959304159849399,
+    0.83060469323313224077,
+    0.96623475710157602503,
+    // 7 points
+    0.025446043828620739519,
+    0.12923440720030276996,
+    0.29707742431130140792,
+    0.5,
+    0.70292257568869853657,
+    0.87076559279969723004,
+    0.97455395617137929865,
+    // 8 points
+    0.01985507175123188417,
+    0.10166676129318663602,
+    0.23723379504183550459,
+    0.40828267875217510996,
+    0.59171732124782494555,
+    0.76276620495816449541,
+    0.89833323870681336398,
+    0.98014492824876808807,
+    // 9 points
+    0.015919880246186953604,
+    0.081984446336682101353,
+    0.19331428364970479339,
+    0.33787328829809554209,
+    0.5,
+    0.66212671170190451342,
+    0.80668571635029517886,
+    0.91801555366331788477,
+    0.98408011975381304293,
+    // 10 points
+    0.013046735741414142162,
+    0.067468316655507745705,
+    0.16029521585048778221,
+    0.2833023029353763933,
+    0.4255628305091844199,
+    0.5744371694908155801,
+    0.7166976970646236067,
+    0.83970478414951221779,
+    0.93253168334449221266,
+    0.98695326425858587172,
+    // 11 points
+    0.010885670926971503097,
+    0.056468700115952348562,
+    0.13492399721297534954,
+    0.24045193539659409643,
+    0.36522842202382749255,
+    0.5,
+    0.63477157797617245194,
+    0.75954806460340584806,
+    0.86507600278702467822,
+    0.94353129988404760287,
+    0.98911432907302854201,
+    // 12 points
+    0.0092196828766403782218,
+    0.047941371814762573367,
+    0.11504866290284765373,
+    0.20634102285669128629,
+    0.31608425050090988018,
+    0.43738329574426554336,
+    0.56261670425573440113,
+    0.68391574949909006431,
+    0.79365897714330868595,
+    0.88495133709715234627,
+    0.95205862818523745439,
+    0.99078031712335956627,
+    // 13 points
+    0.0079084726407059255382,
+    0.041200800388511017724,
+    0.099210954633345047049,
+    0.17882533027982988605,
+    0.27575362448177659358,
+    0.38477084202243261313,
+    0.5,
+    0.61522915797756738687,
+    0.72424637551822346193,
+    0.82117466972017005844,
+    0.90078904536665493907,
+    0.95879919961148896146,
+    0.99209152735929406752,
+    // 14 points
+    0.0068580956515938325257,
+    0.035782558168213240979,
+    0.086399342465117504042,
+    0.15635354759415726056,
+    0.24237568182092295022,
+    0.34044381553605512769,
+    0.44597252564632816618,
+    0.55402747435367183382,
+    0.65955618446394492782,
+    0.75762431817907704978,
+    0.84364645240584268393,
+    0.91360065753488250984,
+    0.96421744183178681453,
+    0.99314190434840621258,
+    // 15 points
+    0.006003740989757287011,
+    0.031363303799647052061,
+    0.075896708294786396909,
+    0.13779113431991496519,
+    0.21451391369573058476,
+    0.3029243264612183073,
+    0.39940295300128275668,
+    0.5,
+    0.60059704699871729883,
+    0.69707567353878163718,
+    0.78548608630426941524,
+    0.86220886568008503481,
+    0.9241032917052136586,
+    0.96863669620035297569,
+    0.9939962590102426887,
+    // 16 points
+    0.0052995325041750342143,
+    0.027712488463383710274,
+    0.067184398806084122402,
+    0.1222977958224984868,
+    0.19106187779867811471,
+    0.27099161117138631516,
+    0.35919822461037054229,
+    0.45249374508118128668,
+    0.54750625491881876883,
+    0.64080177538962945771,
+    0.72900838882861374035,
+    0.80893812220132188529,
+    0.87770220417750155484,
+    0.93281560119391582209,
+    0.97228751153661630013,
+    0.99470046749582496926,
+};
+
+/** @brief Weights belonging to kGaussLegendrePoints */
+inline constexpr double kGaussLegendreWeights[] = {
+    // 1 point
+    1,
+    // 2 points
+    0.5,
+    0.5,
+    // 3 points
+    0.27777777777777779011,
+    0.44444444444444441977,
+    0.27777777777777779011,
+    // 4 points
+    0.17392742256872692486,
+    0.32607257743127304739,
+    0.32607257743127304739,
+    0.17392742256872692486,
+    // 5 points
+    0.11846344252809454245,
+    0.23931433524968323545,
+    0.2844444444444444442,
+    0.23931433524968323545,
+    0.11846344252809454245,
+    // 6 points
+    0.085662246189585192213,
+    0.18038078652406930313,
+    0.23395696728634551853,
+    0.23395696728634551853,
+    0.18038078652406930313,
+    0.085662246189585192213,
+    // 7 points
+    0.06474248308443483757,
+    0.13985269574463832232,
+    0.19091502525255946154,
+    0.20897959183673470163,
+    0.19091502525255946154,
+    0.13985269574463832232,
+    0.06474248308443483757,
+    // 8 points
+    0.050614268145188129333,
+    0.11119051722668722715,
+    0.15685332293894363453,
+    0.18134189168918099511,
+    0.18134189168918099511,
+    0.15685332293894363453,
+    0.11119051722668722715,
+    0.050614268145188129333,
+    // 9 points
+    0.04063719418078722001,
+    0.090324080347428697957,
+    0.1303053482014677189,
+    0.15617353852000143144,
+    0.16511967750062989113,
+    0.15617353852000143144,
+    0.1303053482014677189,
+    0.090324080347428697957,
+    0.04063719418078722001,
+    // 10 points
+    0.033335672154344055118,
+    0.074725674575290293444,
+    0.10954318125799102079,
+    0.13463335965499817481,
+    0.14776211235737643501,
+    0.14776211235737643501,
+    0.13463335965499817481,
+    0.10954318125799102079,
+    0.074725674575290293444,
+    0.033335672154344055118,
+    // 11 points
+    0.027834283558086852367,
+    0.062790184732452306027,
+    0.093145105463867131079,
+    0.11659688229599524112,
+    0.13140227225512335352,
+    0.13646254338895030811,
+    0.13140227225512335352,
+    0.11659688229599524112,
+    0.093145105463867131079,
+    0.062790184732452306027,
+    0.027834283558086852367,
+    // 12 points
+    0.023587668193255900001,
+    0.053469662997659213322,
+    0.08003916427167311054,
+    0.10158371336153296238,
+    0.11674626826917740285,
+    0.12457352290670140049,
+    0.12457352290670140049,
+    0.11674626826917740285,
+    0.10158371336153296238,
+    0.08003916427167311054,
+    0.053469662997659213322,
+    0.023587668193255900001,
+    // 13 points
+    0.02024200238265794205,
+    0.046060749918864225816,
+    0.06943675510989362476,
+    0.089072990380972869029,
+    0.10390802376844424093,
+    0.1131415901314486161,
+    0.11627577661543694876,
+    0.1131415901314486161,
+    0.10390802376844424093,
+    0.089072990380972869029,
+    0.06943675510989362476,
+    0.046060749918864225816,
+    0.02024200238265794205,
+    // 14 points
+    0.017559730165875916258,
+    0.040079043579880103965,
+    0.060759285343951585645,
+    0.078601583579096759302,
+    0.092769198738968911,
+    0.10259923186064780209,
+    0.10763192673157889745,
+    0.10763192673157889745,
+    0.10259923186064780209,
+    0.092769198738968911,
+    0.078601583579096759302,
+    0.060759285343951585645,
+    0.040079043579880103965,
+    0.017559730165875916258,
+    // 15 points
+    0.01537662099805862416,
+    0.035183023744054062187,
+    0.053579610233585962809,
+    0.069785338963077162,
+    0.083134602908496973983,
+    0.093080500007781105665,
+    0.099215742663555789305,
+    0.10128912096278064325,
+    0.099215742663555789305,
+    0.093080500007781105665,
+    0.083134602908496973983,
+    0.069785338963077162,
+    0.053579610233585962809,
+    0.035183023744054062187,
+    0.01537662099805862416,
+    // 16 points
+    0.013576229705877030859,
+    0.031126761969323943346,
+    0.047579255841246392844,
+    0.062314485627766938447,
+    0.074797994408288367985,
+    0.084578259697501267933,
+    0.091301707522461791888,
+    0.094725305227534251085,
+    0.094725305227534251085,
+    0.091301707522461791888,
+    0.084578259697501267933,
+    0.074797994408288367985,
+    0.062314485627766938447,
+    0.047579255841246392844,
+    0.031126761969323943346,
+    0.013576229705877030859,
+};
+
+// clang-format on
+
+/** @brief Largest order of the hard-coded quadrature rules for triangles */
+constexpr int kMaxTriaRuleOrder = 50;
+
+/**
+ * @brief Number of points of the hard-coded triangle rule of a given order,
+ * 0 if there is no rule of exactly this order.
+ */
+constexpr std::array<unsigned int, kMaxTriaRuleOrder + 1> kTriaRuleNumPoints =
+    {0, 1, 3, 0, 6, 7, 12, 15, 16, 19, 25, 28, 33, 37, 42, 49, 55, 60, 67, 73, 79, 87, 96, 103, 112, 120, 130, 141, 150, 159, 171, 181, 193, 204, 214, 228, 243, 252, 267, 282, 295, 309, 324, 339, 354, 370, 385, 399, 423, 435, 453};
+
+/**
+ * @brief Position of the first point/weight of the hard-coded triangle rule
+ * of the given order in kTriaRulePoints and kTriaRuleWeights.
+ */
+constexpr unsigned int TriaRuleOffset(int order) {
+  unsigned int offset = 0;
+  for (int k = 0; k < order; ++k) {
+    offset += kTriaRuleNumPoints[k];
+  }
+  return offset;
+}
+
+/** @brief Total number of points of all hard-coded triangle rules */
+constexpr unsigned int kTriaRuleTotalPoints =
+    TriaRuleOffset(kMaxTriaRuleOrder + 1);
+
+/**
+ * @brief Nodes of all hard-coded triangle rules, ordered by the order of the
+ * rule. The nodes are stored one after the other as (x,y) pairs, i.e., the
+ * part belonging to one rule is the column major `2 x n` matrix of the nodes.
+ */
+extern const double kTriaRulePoints[2 * kTriaRuleTotalPoints];
+
+/** @brief Weights of all hard-coded triangle rules, same order as the nodes */
+extern const double kTriaRuleWeights[kTriaRuleTotalPoints];
+
+}  // namespace lf::quad::detail
+
+#endif  // __5e2b8d0c41a74f3c9a6e1b7d3f08c2a9
@@ -7,8 +7,11 @@
  */
 
 #include <gtest/gtest.h>
+#include <lf/quad/gauss_quadrature.h>
 #include <lf/quad/quad.h>
 #include <boost/math/special_functions/factorials.hpp>
+#include <thread>
+#include <utility>
 
 namespace lf::quad::test {
 
@@ -113,4 +116,128 @@ TEST(qr_IntegrationTest, Tria) {
   }
 }
 
+TEST(qr_Cache, SharedAndThreadSafe) {
+  // Request the same rules from several threads at the same time
+  std::vector<std::thread> threads;
+  std::vector<const QuadRule*> first(8, nullptr);
+  for (int t = 0; t < 8; ++t) {
+    threads.emplace_back([&first, t]() {
+      first[t] = &QuadRuleCache(base::RefEl::kTria(), 17);
+      QuadRuleCache(base::RefEl::kQuad(), 5 + t % 2);
+    });
+  }
+  for (std::thread& t : threads) {
+    t.join();
+  }
+  for (const QuadRule* qr : first) {
+    EXPECT_EQ(qr, first[0]);
+  }
+  checkQuadRule(*first[0]);
+
+  // make_QuadRule() returns a copy of the shared object
+  for (auto ref_el : {base::RefEl::kSegment(), base::RefEl::kTria(),
+                      base::RefEl::kQuad()}) {
+    const QuadRule& cached = QuadRuleCache(ref_el, 4);
+    EXPECT_EQ(&cached, &QuadRuleCache(ref_el, 4));
+    const QuadRule copy = make_QuadRule(ref_el, 4);
+    EXPECT_EQ(copy.Order(), cached.Order());
+    EXPECT_EQ(copy.Points(), cached.Points());
+    EXPECT_EQ(copy.Weights(), cached.Weights());
+  }
+}
+
+template <base::RefElType REF_EL, int... ORDERS>
+void checkFixedQuadRules(std::integer_sequence<int, ORDERS...> /*unused*/) {
+  auto check = [](auto fixed_qr) {
+    using qr_t = decltype(fixed_qr);
+    const QuadRule& qr = QuadRuleCache(qr_t::RefEl(), qr_t::kOrder);
+    EXPECT_EQ(qr_t::kOrder, qr.Order());
+    ASSERT_EQ(qr_t::kNumPoints, qr.NumPoints());
+    EXPECT_EQ(qr_t::Points(), qr.Points());
+    EXPECT_EQ(qr_t::Weights(), qr.Weights());
+  };
+  (check(FixedQuadRule<REF_EL, ORDERS + 1>()), ...);
+}
+
+TEST(qr_FixedQuadRule, SameAsMakeQuadRule) {
+  checkFixedQuadRules<base::RefEl::kSegment()>(
+      std::make_integer_sequence<int, 31>());
+  checkFixedQuadRules<base::RefEl::kQuad()>(
+      std::make_integer_sequence<int, 31>());
+  checkFixedQuadRules<base::RefEl::kTria()>(
+      std::make_integer_sequence<int, 50>());
+
+  // The tables contain exactly the values computed by GaussLegendre()
+  for (unsigned int n = 1; n <= 16; ++n) {
+    auto [points, weights] = GaussLegendre(n);
+    const QuadRule& qr = QuadRuleCache(base::RefEl::kSegment(), 2 * n - 1);
+    EXPECT_EQ(qr.Points(), points.transpose());
+    EXPECT_EQ(qr.Weights(), weights);
+  }
+
+  using qr_t = FixedQuadRule<base::RefEl::kTria(), 3>;
+  static_assert(qr_t::kOrder == 4 && qr_t::kNumPoints == 6);
+  checkQuadRule(qr_t::ToQuadRule());
+  checkQuadRule(FixedQuadRule<base::RefEl::kQuad(), 5>::ToQuadRule());
+}
+
+// The triangle rules are read from the same tables by make_QuadRule() and
+// FixedQuadRule, so comparing the two does not validate the tables. Check
+// the exactness of the FixedQuadRule tables for all orders instead ...
+template <int... ORDERS>
+void checkFixedTriaRulesExact(
+    std::integer_sequence<int, ORDERS...> /*unused*/) {
+  (checkQuadRule(FixedQuadRule<base::RefEl::kTria(), ORDERS + 1>::ToQuadRule(),
+                 1e-12, ORDERS + 1 < 10),
+   ...);
+}
+
+TEST(qr_FixedQuadRule, TriaTablesExact) {
+  checkFixedTriaRulesExact(std::make_integer_sequence<int, 50>());
+}
+
+// ... and compare a few entries with those of the rules that were hard-coded
+// as separate functions before the tables were introduced
+template <int ORDER>
+void checkTriaBaseline(int num_points, Eigen::Vector2d first_point,
+                       double first_weight, Eigen::Vector2d last_point,
+                       double last_weight) {
+  using qr_t = FixedQuadRule<base::RefEl::kTria(), ORDER>;
+  ASSERT_EQ(qr_t::kNumPoints, num_points) << "order " << ORDER;
+  EXPECT_DOUBLE_EQ(qr_t::Points()(0, 0), first_point[0]);
+  EXPECT_DOUBLE_EQ(qr_t::Points()(1, 0), first_point[1]);
+  EXPECT_DOUBLE_EQ(qr_t::Weights()[0], first_weight);
+  EXPECT_DOUBLE_EQ(qr_t::Points()(0, num_points - 1), last_point[0]);
+  EXPECT_DOUBLE_EQ(qr_t::Points()(1, num_points - 1), last_point[1]);
+  EXPECT_DOUBLE_EQ(qr_t::Weights()[num_points - 1], last_weight);
+}
+
+TEST(qr_FixedQuadRule, TriaTablesMatchBaseline) {
+  checkTriaBaseline<1>(1, {0.33333333333333325932, 0.33333333333333342585},
+                       0.5, {0.33333333333333325932, 0.33333333333333342585},
+                       0.5);
+  checkTriaBaseline<2>(3, {0.1666666666666666019, 0.16666666666666679619},
+                       0.16666666666666665741,
+                       {0.1666666666666668517, 0.66666666666666674068},
+                       0.16666666666666665741);
+  // There is no rule of order 3, the one of order 4 is used
+  checkTriaBaseline<3>(6, {0.4459484909159648347, 0.10810301816807028896},
+                       0.11169079483900574978,
+                       {0.091576213509770965082, 0.81684757298045851392},
+                       0.054975871827660942326);
+  checkTriaBaseline<10>(25, {0.49517345980117044579, 0.0096530803976590546372},
+                        0.0048962952492091517398,
+                        {0.14353035811256226184, 0.42823482094371900786},
+                        0.037623663984271998872);
+  checkTriaBaseline<25>(
+      120, {0.38764203040456335358, 0.22471593919087323732},
+      0.0068449257741361232282,
+      {0.00089146431749798082933, 0.27941618864926098809},
+      0.00075585103922944020961);
+  checkTriaBaseline<50>(453, {0.25635586338479082746, 0.256355863384790994},
+                        0.001664347587356614349,
+                        {0.0022261525470098145196, 0.074059074679851275014},
+                        0.00018525277440708607236);
+}
+
 }  // namespace lf::quad::test
@@ -4,7 +4,9 @@
  */
 
 #include "mesh_hierarchy.h"
+#include <algorithm>
 #include <iostream>
+#include <numeric>
 
 namespace lf::refinement {
 
@@ -19,6 +21,199 @@ bool checkValidIndex(const std::vector<glb_idx_t> &idx_vec) {
   return true;
 }
 
+namespace {
+// Minimal number of entities processed by a thread during refinement
+constexpr std::size_t kMinChunkSize = 256;
+
+// Index ranges for the children of the entities of one co-dimension.
+// Children are distinguished by their co-dimension relative to the parent.
+class ChildOffsets {
+ public:
+  explicit ChildOffsets(size_type no_entities) {
+    for (std::vector<glb_idx_t> &offsets : offsets_) {
+      offsets.assign(no_entities + 1, 0);
+    }
+  }
+  // Set number of children, may be called concurrently for different entities
+  void Set(glb_idx_t idx, size_type no_rel_codim0, size_type no_rel_codim1,
+           size_type no_rel_codim2) {
+    offsets_[0][idx + 1] = no_rel_codim0;
+    offsets_[1][idx + 1] = no_rel_codim1;
+    offsets_[2][idx + 1] = no_rel_codim2;
+  }
+  // Convert numbers of children into index ranges starting at given indices
+  void PrefixSum(glb_idx_t first0, glb_idx_t first1, glb_idx_t first2) {
+    const std::array<glb_idx_t, 3> first{first0, first1, first2};
+    for (int rel_codim = 0; rel_codim < 3; ++rel_codim) {
+      std::vector<glb_idx_t> &offsets(offsets_[rel_codim]);
+      offsets[0] = first[rel_codim];
+      std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    }
+  }
+  // First index of a child of an entity, also end of range for idx-1
+  glb_idx_t First(glb_idx_t idx, int rel_codim) const {
+    return offsets_[rel_codim][idx];
+  }
+  // End of index range for all entities
+  glb_idx_t Total(int rel_codim) const { return offsets_[rel_codim].back(); }
+
+ private:
+  std::array<std::vector<glb_idx_t>, 3> offsets_;
+};
+
+// Child entities with reserved indices waiting to be passed to a MeshFactory.
+// Different indices may be filled concurrently.
+class ChildEntityStore {
+ public:
+  ChildEntityStore(size_type no_points, size_type no_edges,
+                   size_type no_cells)
+      : points_(no_points), edges_(no_edges), cells_(no_cells) {}
+
+  // The following methods store an entity at position `next` and increment it
+  glb_idx_t AddPoint(glb_idx_t &next,
+                     std::unique_ptr<geometry::Geometry> &&geo) {
+    LF_ASSERT_MSG(next < points_.size(), "Point index " << next);
+    points_[next] = std::move(geo);
+    return next++;
+  }
+  glb_idx_t AddEdge(glb_idx_t &next, const std::array<glb_idx_t, 2> &nodes,
+                    std::unique_ptr<geometry::Geometry> &&geo) {
+    LF_ASSERT_MSG(next < edges_.size(), "Edge index " << next);
+    edges_[next] = {nodes, std::move(geo)};
+    return next++;
+  }
+  glb_idx_t AddCell(glb_idx_t &next, lf::base::RefEl ref_el,
+                    const std::array<glb_idx_t, 4> &nodes,
+                    std::unique_ptr<geometry::Geometry> &&geo) {
+    LF_ASSERT_MSG(next < cells_.size(), "Cell index " << next);
+    cells_[next] = {ref_el, nodes, std::move(geo)};
+    return next++;
+  }
+
+  // Sequential registration of all entities, in the order of their indices
+  void Register(mesh::MeshFactory &factory) {
+    for (glb_idx_t idx = 0; idx < points_.size(); ++idx) {
+      LF_VERIFY_MSG(points_[idx], "No child point with index " << idx);
+      const size_type new_idx = factory.AddPoint(std::move(points_[idx]));
+      LF_VERIFY_MSG(new_idx == idx, "Point index " << new_idx << " != " << idx);
+    }
+    for (glb_idx_t idx = 0; idx < edges_.size(); ++idx) {
+      Edge &edge(edges_[idx]);
+      LF_VERIFY_MSG(edge.geo, "No child edge with index " << idx);
+      const size_type new_idx = factory.AddEntity(
+          lf::base::RefEl::kSegment(), {edge.nodes[0], edge.nodes[1]},
+          std::move(edge.geo));
+      LF_VERIFY_MSG(new_idx == idx, "Edge index " << new_idx << " != " << idx);
+    }
+    for (glb_idx_t idx = 0; idx < cells_.size(); ++idx) {
+      Cell &cell(cells_[idx]);
+      LF_VERIFY_MSG(cell.geo, "No child cell with index " << idx);
+      const std::array<glb_idx_t, 4> &n(cell.nodes);
+      const size_type new_idx =
+          (cell.ref_el == lf::base::RefEl::kTria())
+              ? factory.AddEntity(cell.ref_el, {n[0], n[1], n[2]},
+                                  std::move(cell.geo))
+              : factory.AddEntity(cell.ref_el, {n[0], n[1], n[2], n[3]},
+                                  std::move(cell.geo));
+      LF_VERIFY_MSG(new_idx == idx, "Cell index " << new_idx << " != " << idx);
+    }
+  }
+
+ private:
+  struct Edge {
+    std::array<glb_idx_t, 2> nodes;
+    std::unique_ptr<geometry::Geometry> geo;
+  };
+  struct Cell {
+    lf::base::RefEl ref_el{lf::base::RefEl::kTria()};
+    std::array<glb_idx_t, 4> nodes;
+    std::unique_ptr<geometry::Geometry> geo;
+  };
+  std::vector<std::unique_ptr<geometry::Geometry>> points_;
+  std::vector<Edge> edges_;
+  std::vector<Cell> cells_;
+};
+
+// Check the refinement patterns of all entities of the parent mesh before
+// child entities are generated concurrently. The checks run sequentially in
+// index order, so an inconsistent pattern is always reported for the same
+// entity and before any worker thread has been started.
+void VerifyRefinementPatterns(
+    const mesh::Mesh &parent_mesh,
+    const std::vector<PointChildInfo> &pt_child_info,
+    const std::vector<EdgeChildInfo> &ed_child_info,
+    const std::vector<CellChildInfo> &cell_child_info) {
+  for (glb_idx_t edge_index = 0; edge_index < ed_child_info.size();
+       ++edge_index) {
+    const RefPat edge_refpat = ed_child_info[edge_index].ref_pat_;
+    LF_VERIFY_MSG(
+        (edge_refpat == RefPat::rp_copy) || (edge_refpat == RefPat::rp_split),
+        "Refinement pattern " << static_cast<int>(edge_refpat)
+                              << " illegal for edge " << edge_index);
+  }
+  for (glb_idx_t cell_index = 0; cell_index < cell_child_info.size();
+       ++cell_index) {
+    const mesh::Entity &cell{*parent_mesh.EntityByIndex(0, cell_index)};
+    const lf::base::RefEl ref_el(cell.RefEl());
+    const RefPat cell_refpat = cell_child_info[cell_index].ref_pat_;
+    const sub_idx_t anchor = cell_child_info[cell_index].anchor_;
+    bool legal = false;
+    bool needs_anchor = false;
+    if (ref_el == lf::base::RefEl::kTria()) {
+      legal = (cell_refpat == RefPat::rp_copy) ||
+              (cell_refpat == RefPat::rp_bisect) ||
+              (cell_refpat == RefPat::rp_trisect) ||
+              (cell_refpat == RefPat::rp_trisect_left) ||
+              (cell_refpat == RefPat::rp_quadsect) ||
+              (cell_refpat == RefPat::rp_barycentric) ||
+              (cell_refpat == RefPat::rp_regular);
+      needs_anchor = (cell_refpat == RefPat::rp_bisect) ||
+                     (cell_refpat == RefPat::rp_trisect) ||
+                     (cell_refpat == RefPat::rp_trisect_left) ||
+                     (cell_refpat == RefPat::rp_quadsect);
+    } else if (ref_el == lf::base::RefEl::kQuad()) {
+      legal = (cell_refpat == RefPat::rp_copy) ||
+              (cell_refpat == RefPat::rp_trisect) ||
+              (cell_refpat == RefPat::rp_quadsect) ||
+              (cell_refpat == RefPat::rp_bisect) ||
+              (cell_refpat == RefPat::rp_split) ||
+              (cell_refpat == RefPat::rp_threeedge) ||
+              (cell_refpat == RefPat::rp_barycentric) ||
+              (cell_refpat == RefPat::rp_regular);
+      needs_anchor = legal && (cell_refpat != RefPat::rp_copy) &&
+                     (cell_refpat != RefPat::rp_barycentric) &&
+                     (cell_refpat != RefPat::rp_regular);
+    }
+    LF_VERIFY_MSG(legal, "Refinement pattern "
+                             << static_cast<int>(cell_refpat) << " illegal for "
+                             << ref_el.ToString() << " " << cell_index);
+    LF_VERIFY_MSG(!needs_anchor || (anchor < ref_el.NumSubEntities(1)),
+                  "Refinement pattern " << static_cast<int>(cell_refpat)
+                                        << " of " << ref_el.ToString() << " "
+                                        << cell_index
+                                        << " needs a valid anchor edge");
+    for (const mesh::Entity &vertex : cell.SubEntities(2)) {
+      LF_VERIFY_MSG(
+          pt_child_info[parent_mesh.Index(vertex)].ref_pat == RefPat::rp_copy,
+          "Vertex must have been copied!");
+    }
+  }
+}
+
+// Templates for the regular refinement of triangles and quadrilaterals.
+// Local numbering of nodes: vertices first, then edge midpoints, then the
+// center of a quadrilateral. The ordering of child cells and interior edges
+// and of their nodes agrees with MeshHierarchy::PerformRefinement().
+constexpr std::array<std::array<sub_idx_t, 3>, 4> kTriaRegularCells{
+    {{0, 3, 5}, {1, 3, 4}, {2, 5, 4}, {3, 4, 5}}};
+constexpr std::array<std::array<sub_idx_t, 2>, 3> kTriaRegularEdges{
+    {{3, 5}, {3, 4}, {5, 4}}};
+constexpr std::array<std::array<sub_idx_t, 4>, 4> kQuadRegularCells{
+    {{0, 4, 8, 7}, {1, 5, 8, 4}, {2, 5, 8, 6}, {3, 6, 8, 7}}};
+constexpr std::array<std::array<sub_idx_t, 2>, 4> kQuadRegularEdges{
+    {{4, 8}, {5, 8}, {6, 8}, {7, 8}}};
+}  // namespace
+
 CONTROLDECLARECOMMENT(MeshHierarchy, output_ctrl_, "MeshHierarchy_output_ctrl",
                       "Diagnostics control for MeshHierarchy");
 
@@ -57,14 +252,16 @@ MeshHierarchy::MeshHierarchy(std::shared_ptr<mesh::Mesh> base_mesh,  // NOLINT
                              std::move(edge_parent_info),
                              std::move(point_parent_info)});
   }
-  edge_marked_.push_back(
-      std::move(std::vector<bool>(base_mesh->Size(1), false)));
+  edge_marked_.emplace_back(NoFlagWords(base_mesh->Size(1)), 0);
 }
 
 void MeshHierarchy::RefineRegular(RefPat ref_pat) {
   LF_VERIFY_MSG(
       ref_pat == RefPat::rp_regular || ref_pat == RefPat::rp_barycentric,
       "Only regular or barycentric uniform refinement possible");
+  if ((ref_pat == RefPat::rp_regular) && RefineRegularStraight()) {
+    return;
+  }
   // Retrieve the finest mesh in the hierarchy
   const mesh::Mesh &finest_mesh(*meshes_.back());
   // Arrays containing refinement information for finest mesh
@@ -102,6 +299,281 @@ void MeshHierarchy::RefineRegular(RefPat ref_pat) {
   PerformRefinement();
 }
 
+bool MeshHierarchy::RefineRegularStraight() {
+  const mesh::Mesh &parent_mesh(*meshes_.back());
+  const size_type no_nodes = parent_mesh.Size(2);
+  const size_type no_edges = parent_mesh.Size(1);
+  const size_type no_cells = parent_mesh.Size(0);
+  // Check whether all edges and cells are straight
+  for (const mesh::Entity &edge : parent_mesh.Entities(1)) {
+    if (dynamic_cast<const geometry::SegmentO1 *>(edge.Geometry()) ==
+        nullptr) {
+      return false;
+    }
+  }
+  for (const mesh::Entity &cell : parent_mesh.Entities(0)) {
+    const geometry::Geometry *geo_ptr = cell.Geometry();
+    if ((dynamic_cast<const geometry::TriaO1 *>(geo_ptr) == nullptr) &&
+        (dynamic_cast<const geometry::QuadO1 *>(geo_ptr) == nullptr) &&
+        (dynamic_cast<const geometry::Parallelogram *>(geo_ptr) == nullptr)) {
+      return false;
+    }
+  }
+  std::vector<PointChildInfo> &pt_child_info(point_child_infos_.back());
+  std::vector<EdgeChildInfo> &ed_child_info(edge_child_infos_.back());
+  std::vector<CellChildInfo> &cell_child_info(cell_child_infos_.back());
+
+  // Index ranges: points are copies of nodes, followed by edge midpoints and
+  // centers of quadrilaterals; edges are halves of edges followed by interior
+  // edges of cells; every cell has four children.
+  ChildOffsets cell_offsets(no_cells);
+  for (glb_idx_t cell_index = 0; cell_index < no_cells; ++cell_index) {
+    const bool is_tria =
+        parent_mesh.EntityByIndex(0, cell_index)->RefEl() ==
+        lf::base::RefEl::kTria();
+    cell_offsets.Set(cell_index, 4, is_tria ? 3 : 4, is_tria ? 0 : 1);
+  }
+  cell_offsets.PrefixSum(0, 2 * no_edges, no_nodes + no_edges);
+  ChildEntityStore store(cell_offsets.Total(2), cell_offsets.Total(1),
+                         cell_offsets.Total(0));
+  const unsigned int num_threads = (output_ctrl_ > 0) ? 1 : 0;
+  // Child geometries are allocated from the arena of the mesh factory
+  geometry::GeometryArena *const arena = mesh_factory_->Arena();
+
+  // Positions of all points of the fine mesh
+  Eigen::MatrixXd coords(parent_mesh.DimWorld(), cell_offsets.Total(2));
+  lf::base::ParallelFor(
+      no_nodes,
+      [&](std::size_t first, std::size_t last) {
+        const Eigen::MatrixXd origin(0, 1);
+        for (glb_idx_t node_index = first; node_index < last; ++node_index) {
+          coords.col(node_index) =
+              parent_mesh.EntityByIndex(2, node_index)->Geometry()->Global(
+                  origin);
+        }
+      },
+      kMinChunkSize, num_threads);
+  // Node indices of the endpoints of the edges
+  std::vector<std::array<glb_idx_t, 2>> edge_nodes(no_edges);
+  lf::base::ParallelFor(
+      no_edges,
+      [&](std::size_t first, std::size_t last) {
+        for (glb_idx_t edge_index = first; edge_index < last; ++edge_index) {
+          auto nodes = parent_mesh.EntityByIndex(1, edge_index)->SubEntities(1);
+          edge_nodes[edge_index] = {parent_mesh.Index(nodes[0]),
+                                    parent_mesh.Index(nodes[1])};
+          coords.col(no_nodes + edge_index) =
+              0.5 * (coords.col(edge_nodes[edge_index][0]) +
+                     coords.col(edge_nodes[edge_index][1]));
+        }
+      },
+      kMinChunkSize, num_threads);
+
+  // Children of nodes and edges
+  lf::base::ParallelFor(
+      no_nodes,
+      [&](std::size_t first, std::size_t last) {
+        const geometry::GeometryArena::Scope scope(arena);
+        for (glb_idx_t node_index = first; node_index < last; ++node_index) {
+          pt_child_info[node_index].ref_pat = RefPat::rp_copy;
+          glb_idx_t next_point = node_index;
+          pt_child_info[node_index].child_point_idx = store.AddPoint(
+              next_point,
+              std::make_unique<geometry::Point>(coords.col(node_index)));
+        }
+      },
+      kMinChunkSize, num_threads);
+  lf::base::ParallelFor(
+      no_edges,
+      [&](std::size_t first, std::size_t last) {
+        const geometry::GeometryArena::Scope scope(arena);
+        Eigen::Matrix<double, Eigen::Dynamic, 2> seg_coords(coords.rows(), 2);
+        for (glb_idx_t edge_index = first; edge_index < last; ++edge_index) {
+          EdgeChildInfo &edge_ci(ed_child_info[edge_index]);
+          edge_ci.ref_pat_ = RefPat::rp_split;
+          const glb_idx_t midpoint_idx = no_nodes + edge_index;
+          glb_idx_t next_point = midpoint_idx;
+          edge_ci.child_point_idx.assign(
+              1, store.AddPoint(next_point, std::make_unique<geometry::Point>(
+                                                coords.col(midpoint_idx))));
+          glb_idx_t next_edge = 2 * edge_index;
+          edge_ci.child_edge_idx.resize(2);
+          for (int k = 0; k < 2; ++k) {
+            // Halves: [endpoint 0, midpoint] and [midpoint, endpoint 1]
+            const std::array<glb_idx_t, 2> nodes{
+                (k == 0) ? edge_nodes[edge_index][0] : midpoint_idx,
+                (k == 0) ? midpoint_idx : edge_nodes[edge_index][1]};
+            seg_coords << coords.col(nodes[0]), coords.col(nodes[1]);
+            edge_ci.child_edge_idx[k] = store.AddEdge(
+                next_edge, nodes,
+                std::make_unique<geometry::SegmentO1>(seg_coords));
+          }
+        }
+      },
+      kMinChunkSize, num_threads);
+
+  // Children of cells
+  lf::base::ParallelFor(
+      no_cells,
+      [&](std::size_t first, std::size_t last) {
+        const geometry::GeometryArena::Scope scope(arena);
+        Eigen::Matrix<double, Eigen::Dynamic, 2> seg_coords(coords.rows(), 2);
+        Eigen::Matrix<double, Eigen::Dynamic, 3> tria_coords(coords.rows(), 3);
+        Eigen::Matrix<double, Eigen::Dynamic, 4> quad_coords(coords.rows(), 4);
+        for (glb_idx_t cell_index = first; cell_index < last; ++cell_index) {
+          const mesh::Entity &cell{*parent_mesh.EntityByIndex(0, cell_index)};
+          const bool is_tria = (cell.RefEl() == lf::base::RefEl::kTria());
+          const size_type num_vertices = is_tria ? 3 : 4;
+          // Fine mesh indices of nodes in local numbering of the templates
+          std::array<glb_idx_t, 9> local_nodes{};
+          auto vertices = cell.SubEntities(2);
+          auto edges = cell.SubEntities(1);
+          for (sub_idx_t k = 0; k < num_vertices; ++k) {
+            local_nodes[k] = parent_mesh.Index(vertices[k]);
+            local_nodes[num_vertices + k] =
+                no_nodes + parent_mesh.Index(edges[k]);
+          }
+          CellChildInfo &cell_ci(cell_child_info[cell_index]);
+          cell_ci.ref_pat_ = RefPat::rp_regular;
+          cell_ci.child_point_idx.clear();
+          if (!is_tria) {
+            // Center of the quadrilateral
+            glb_idx_t next_point = cell_offsets.First(cell_index, 2);
+            local_nodes[8] = next_point;
+            coords.col(next_point) =
+                0.25 * (coords.col(local_nodes[0]) +
+                        coords.col(local_nodes[1]) +
+                        coords.col(local_nodes[2]) +
+                        coords.col(local_nodes[3]));
+            cell_ci.child_point_idx.push_back(store.AddPoint(
+                next_point,
+                std::make_unique<geometry::Point>(coords.col(local_nodes[8]))));
+          }
+          // Interior edges
+          glb_idx_t next_edge = cell_offsets.First(cell_index, 1);
+          cell_ci.child_edge_idx.resize(is_tria ? 3 : 4);
+          for (std::size_t k = 0; k < cell_ci.child_edge_idx.size(); ++k) {
+            const std::array<sub_idx_t, 2> &loc(is_tria ? kTriaRegularEdges[k]
+                                                        : kQuadRegularEdges[k]);
+            const std::array<glb_idx_t, 2> nodes{local_nodes[loc[0]],
+                                                 local_nodes[loc[1]]};
+            seg_coords << coords.col(nodes[0]), coords.col(nodes[1]);
+            cell_ci.child_edge_idx[k] = store.AddEdge(
+                next_edge, nodes,
+                std::make_unique<geometry::SegmentO1>(seg_coords));
+          }
+          // Child cells, the children of a parallelogram are parallelograms
+          // as in lf::geometry::Parallelogram::ChildGeometry(), so that they
+          // remain affine
+          const bool is_parallelogram =
+              !is_tria && (dynamic_cast<const geometry::Parallelogram *>(
+                               cell.Geometry()) != nullptr);
+          glb_idx_t next_cell = cell_offsets.First(cell_index, 0);
+          cell_ci.child_cell_idx.resize(4);
+          for (int k = 0; k < 4; ++k) {
+            std::array<glb_idx_t, 4> nodes{idx_nil, idx_nil, idx_nil, idx_nil};
+            std::unique_ptr<geometry::Geometry> geo_ptr;
+            if (is_tria) {
+              for (int j = 0; j < 3; ++j) {
+                nodes[j] = local_nodes[kTriaRegularCells[k][j]];
+                tria_coords.col(j) = coords.col(nodes[j]);
+              }
+              geo_ptr = std::make_unique<geometry::TriaO1>(tria_coords);
+            } else {
+              for (int j = 0; j < 4; ++j) {
+                nodes[j] = local_nodes[kQuadRegularCells[k][j]];
+                quad_coords.col(j) = coords.col(nodes[j]);
+              }
+              if (is_parallelogram) {
+                geo_ptr =
+                    std::make_unique<geometry::Parallelogram>(quad_coords);
+              } else {
+                geo_ptr = std::make_unique<geometry::QuadO1>(quad_coords);
+              }
+            }
+            cell_ci.child_cell_idx[k] = store.AddCell(
+                next_cell, cell.RefEl(), nodes, std::move(geo_ptr));
+          }
+        }
+      },
+      kMinChunkSize, num_threads);
+
+  store.Register(*mesh_factory_);
+  CompleteRefinement();
+  return true;
+}
+
+void MeshHierarchy::MarkEdgesByIndex(
+    const std::vector<glb_idx_t> &edge_indices) {
+  const size_type no_edges = meshes_.back()->Size(1);
+  std::vector<std::uint64_t> &flags(edge_marked_.back());
+  std::fill(flags.begin(), flags.end(), 0);
+  for (const glb_idx_t edge_index : edge_indices) {
+    LF_VERIFY_MSG(edge_index < no_edges,
+                  "Edge index " << edge_index << " out of range");
+    flags[edge_index / kFlagBits] |= std::uint64_t(1)
+                                     << (edge_index % kFlagBits);
+  }
+}
+
+void MeshHierarchy::MarkEdges(const Eigen::VectorXd &cell_estimators,
+                              MarkingStrategy strategy, double theta) {
+  const mesh::Mesh &finest_mesh(*meshes_.back());
+  const size_type no_cells = finest_mesh.Size(0);
+  LF_VERIFY_MSG(cell_estimators.size() == no_cells,
+                cell_estimators.size() << " estimators for " << no_cells
+                                       << " cells");
+  LF_VERIFY_MSG((theta >= 0.0) && (theta <= 1.0),
+                "Marking parameter " << theta << " outside [0,1]");
+  std::vector<glb_idx_t> marked_cells;
+  switch (strategy) {
+    case MarkingStrategy::kMaximum: {
+      const double threshold =
+          (no_cells > 0) ? theta * cell_estimators.maxCoeff() : 0.0;
+      for (glb_idx_t cell_index = 0; cell_index < no_cells; ++cell_index) {
+        if (cell_estimators[cell_index] >= threshold) {
+          marked_cells.push_back(cell_index);
+        }
+      }
+      break;
+    }
+    case MarkingStrategy::kDoerfler: {
+      // Sort cells by decreasing indicators and take the smallest leading
+      // set, whose contributions exceed the prescribed fraction
+      std::vector<glb_idx_t> order(no_cells);
+      std::iota(order.begin(), order.end(), 0);
+      std::sort(order.begin(), order.end(),
+                [&cell_estimators](glb_idx_t i, glb_idx_t j) {
+                  return (cell_estimators[i] > cell_estimators[j]) ||
+                         ((cell_estimators[i] == cell_estimators[j]) &&
+                          (i < j));
+                });
+      const double bulk = theta * cell_estimators.squaredNorm();
+      double sum = 0.0;
+      for (const glb_idx_t cell_index : order) {
+        if (sum >= bulk) {
+          break;
+        }
+        marked_cells.push_back(cell_index);
+        sum += cell_estimators[cell_index] * cell_estimators[cell_index];
+      }
+      break;
+    }
+    default: {
+      LF_VERIFY_MSG(false, "Unknown marking strategy");
+    }
+  }
+  // Mark all edges of the selected cells
+  std::vector<glb_idx_t> edge_indices;
+  for (const glb_idx_t cell_index : marked_cells) {
+    for (const mesh::Entity &edge :
+         finest_mesh.EntityByIndex(0, cell_index)->SubEntities(1)) {
+      edge_indices.push_back(finest_mesh.Index(edge));
+    }
+  }
+  MarkEdgesByIndex(edge_indices);
+}
+
 void MeshHierarchy::RefineMarked() {
   // Target the finest mesh
   const lf::mesh::Mesh &finest_mesh(*meshes_.back());
@@ -133,7 +605,7 @@ void MeshHierarchy::RefineMarked() {
     EdgeChildInfo &ed_ci(finest_edge_ci[edge_index]);
     LF_VERIFY_MSG(ed_ci.ref_pat_ == RefPat::rp_nil,
                   "Edge " << edge_index << " already refined!");
-    if ((edge_marked_.back())[edge_index]) {
+    if (EdgeMarked(edge_index)) {
       // Edge is to be refined
       ed_ci.ref_pat_ = RefPat::rp_split;
     } else {
@@ -143,201 +615,244 @@ void MeshHierarchy::RefineMarked() {
   }
   // Now all edges are initially marked to be split or copied
 
-  // To keep the mesh conforming refinement might have to propagate
-  // This is achieved in the following REPEAT ... UNTIL loop.
-  bool refinement_complete;
-  do {
-    refinement_complete = true;
-    // Visit all cells and update their refinement patterns
-    for (const lf::mesh::Entity &cell : finest_mesh.Entities(0)) {
-      const glb_idx_t cell_index = finest_mesh.Index(cell);
-      CellChildInfo &cell_child_info(finest_cell_ci[cell_index]);
-
-      // Global indices of edges
-      std::array<glb_idx_t, 4> cell_edge_indices{};
-
-      // Find edges which are marked as split
-      std::array<bool, 4> edge_split{{false, false, false, false}};
-      // Local indices of edges marked as split
-      std::array<sub_idx_t, 4> split_edge_idx{};
-      // Array of references to edge sub-entities of current cell
-      base::RandomAccessRange<const lf::mesh::Entity> sub_edges(
-          cell.SubEntities(1));
-      const size_type num_edges = cell.RefEl().NumSubEntities(1);
-      LF_VERIFY_MSG(num_edges <= 4, "Too many edges = " << num_edges);
-      // Obtain information about current splitting pattern of
-      // the edges of the cell
-      size_type split_edge_cnt = 0;
-      for (int k = 0; k < num_edges; k++) {
-        const glb_idx_t edge_index = finest_mesh.Index(sub_edges[k]);
-        cell_edge_indices[k] = edge_index;
-        edge_split[k] =
-            (finest_edge_ci[edge_index].ref_pat_ == RefPat::rp_split);
-        if (edge_split[k]) {
-          split_edge_idx[split_edge_cnt] = k;
-          split_edge_cnt++;
-        }
+  // Update the refinement pattern of a cell according to the splitting status
+  // of its edges. Returns the index of an edge that has to be split in
+  // addition, idx_nil if there is none.
+  auto update_cell_refpat = [&](const lf::mesh::Entity &cell) -> glb_idx_t {
+    glb_idx_t newly_split_edge = idx_nil;
+    const glb_idx_t cell_index = finest_mesh.Index(cell);
+
+    // Global indices of edges
+    std::array<glb_idx_t, 4> cell_edge_indices{};
+
+    // Find edges which are marked as split
+    std::array<bool, 4> edge_split{{false, false, false, false}};
+    // Local indices of edges marked as split
+    std::array<sub_idx_t, 4> split_edge_idx{};
+    // Array of references to edge sub-entities of current cell
+    base::RandomAccessRange<const lf::mesh::Entity> sub_edges(
+        cell.SubEntities(1));
+    const size_type num_edges = cell.RefEl().NumSubEntities(1);
+    LF_VERIFY_MSG(num_edges <= 4, "Too many edges = " << num_edges);
+    // Obtain information about current splitting pattern of
+    // the edges of the cell
+    size_type split_edge_cnt = 0;
+    for (size_type k = 0; k < num_edges; k++) {
+      const glb_idx_t edge_index = finest_mesh.Index(sub_edges[k]);
+      cell_edge_indices[k] = edge_index;
+      edge_split[k] =
+          (finest_edge_ci[edge_index].ref_pat_ == RefPat::rp_split);
+      if (edge_split[k]) {
+        split_edge_idx[split_edge_cnt] = k;
+        split_edge_cnt++;
       }
-      switch (cell.RefEl()) {
-        case lf::base::RefEl::kTria(): {
-          // Case of a triangular cell: In this case bisection refinement
-          // is performed starting with the refinement edge.
-          // Local index of refinement edge for the current triangle, also
-          // called the "anchor edge" in the case of repeated  bisection
-          const sub_idx_t anchor = refinement_edges_.back()[cell_index];
-          LF_VERIFY_MSG(anchor < 3, "Illegal anchor = " << anchor);
-
-          // Refinement edge will always be the anchor edge
-          finest_cell_ci[cell_index].anchor_ = anchor;
-          const sub_idx_t mod_0 = anchor;
-          const sub_idx_t mod_1 = (anchor + 1) % 3;
-          const sub_idx_t mod_2 = (anchor + 2) % 3;
-          // Flag tuple indicating splitting status of an edge: true <-> split
-          std::tuple<bool, bool, bool> split_status(
-              {edge_split[mod_0], edge_split[mod_1], edge_split[mod_2]});
-
-          // Determine updated refinement pattern for triangle depending on the
-          // splitting status of its edges. If the triangle is subdivided, the
-          // refinement must always be split in a first bisection step, even if
-          // it may not have been marked as split. In this case refinement may
-          // spread to neighboring cells and we have to iterative once more.
-          // Therefore the refinement_complete flag has to be set to 'false'.
-
-          if (split_status ==
-              std::tuple<bool, bool, bool>({false, false, false})) {
-            // No edge to be split: just copy triangle
-            LF_VERIFY_MSG(split_edge_cnt == 0, "Wrong number of split edges");
+    }
+    switch (cell.RefEl()) {
+      case lf::base::RefEl::kTria(): {
+        // Case of a triangular cell: In this case bisection refinement
+        // is performed starting with the refinement edge.
+        // Local index of refinement edge for the current triangle, also
+        // called the "anchor edge" in the case of repeated  bisection
+        const sub_idx_t anchor = refinement_edges_.back()[cell_index];
+        LF_VERIFY_MSG(anchor < 3, "Illegal anchor = " << anchor);
+
+        // Refinement edge will always be the anchor edge
+        finest_cell_ci[cell_index].anchor_ = anchor;
+        const sub_idx_t mod_0 = anchor;
+        const sub_idx_t mod_1 = (anchor + 1) % 3;
+        const sub_idx_t mod_2 = (anchor + 2) % 3;
+        // Flag tuple indicating splitting status of an edge: true <-> split
+        std::tuple<bool, bool, bool> split_status(
+            {edge_split[mod_0], edge_split[mod_1], edge_split[mod_2]});
+
+        // Determine updated refinement pattern for triangle depending on the
+        // splitting status of its edges. If the triangle is subdivided, the
+        // refinement must always be split in a first bisection step, even if
+        // it may not have been marked as split. In this case refinement may
+        // spread to neighboring cells, which have to be visited once more.
+
+        if (split_status ==
+            std::tuple<bool, bool, bool>({false, false, false})) {
+          // No edge to be split: just copy triangle
+          LF_VERIFY_MSG(split_edge_cnt == 0, "Wrong number of split edges");
+          finest_cell_ci[cell_index].ref_pat_ = RefPat::rp_copy;
+        } else if (split_status ==
+                   std::tuple<bool, bool, bool>({true, false, false})) {
+          // Only refinement edge has to be split by a single bisection
+          // No additional edge will be split
+          LF_VERIFY_MSG(split_edge_cnt == 1, "Wrong number of split edges");
+          finest_cell_ci[cell_index].ref_pat_ = RefPat::rp_bisect;
+        } else if (split_status ==
+                   std::tuple<bool, bool, bool>({true, true, false})) {
+          // Trisection refinement, no extra splitting of edges
+          LF_VERIFY_MSG(split_edge_cnt == 2, "Wrong number of split edges");
+          finest_cell_ci[cell_index].ref_pat_ = RefPat::rp_trisect;
+        } else if (split_status ==
+                   std::tuple<bool, bool, bool>({false, true, false})) {
+          // Trisection refinement, triggering splitting of refinement edge
+          LF_VERIFY_MSG(split_edge_cnt == 1, "Wrong number of split edges");
+          finest_cell_ci[cell_index].ref_pat_ = RefPat::rp_trisect;
+          finest_edge_ci[cell_edge_indices[anchor]].ref_pat_ =
+              RefPat::rp_split;
+          newly_split_edge = cell_edge_indices[anchor];
+        } else if (split_status ==
+                   std::tuple<bool, bool, bool>({true, false, true})) {
+          // Trisection refinement (other side), no extra splitting of edges
+          LF_VERIFY_MSG(split_edge_cnt == 2, "Wrong number of split edges");
+          finest_cell_ci[cell_index].ref_pat_ = RefPat::rp_trisect_left;
+        } else if (split_status ==
+                   std::tuple<bool, bool, bool>({false, false, true})) {
+          // Trisection refinement (other side), triggering splitting of
+          // refinement edge
+          LF_VERIFY_MSG(split_edge_cnt == 1, "Wrong number of split edges");
+          finest_cell_ci[cell_index].ref_pat_ = RefPat::rp_trisect_left;
+          finest_edge_ci[cell_edge_indices[anchor]].ref_pat_ =
+              RefPat::rp_split;
+          newly_split_edge = cell_edge_indices[anchor];
+        } else if (split_status ==
+                   std::tuple<bool, bool, bool>({true, true, true})) {
+          // Quadsection refinement, no extra splitting of edges
+          LF_VERIFY_MSG(split_edge_cnt == 3, "Wrong number of split edges");
+          finest_cell_ci[cell_index].ref_pat_ = RefPat::rp_quadsect;
+        } else if (split_status ==
+                   std::tuple<bool, bool, bool>({false, true, true})) {
+          // Quadsection refinement requiring splitting of refinement edge
+          LF_VERIFY_MSG(split_edge_cnt == 2, "Wrong number of split edges");
+          finest_cell_ci[cell_index].ref_pat_ = RefPat::rp_quadsect;
+          finest_edge_ci[cell_edge_indices[anchor]].ref_pat_ =
+              RefPat::rp_split;
+          newly_split_edge = cell_edge_indices[anchor];
+        } else {
+          LF_VERIFY_MSG(false, "Impossible case");
+        }
+        break;
+      }  // end case of a triangle
+      case lf::base::RefEl::kQuad(): {
+        // There is no refinement edge for quadrilaterals and so no extra edge
+        // splitting will be necessary. The refinement pattern for a
+        // quadrilateral will be determined from the number of edges split and
+        // their location to each other.
+        switch (split_edge_cnt) {
+          case 0: {
+            // No edge split: quadrilateral has to be copied
             finest_cell_ci[cell_index].ref_pat_ = RefPat::rp_copy;
-          } else if (split_status ==
-                     std::tuple<bool, bool, bool>({true, false, false})) {
-            // Only refinement edge has to be split by a single bisection
-            // No additional edge will be split
-            LF_VERIFY_MSG(split_edge_cnt == 1, "Wrong number of split edges");
-            finest_cell_ci[cell_index].ref_pat_ = RefPat::rp_bisect;
-          } else if (split_status ==
-                     std::tuple<bool, bool, bool>({true, true, false})) {
-            // Trisection refinement, no extra splitting of edges
-            LF_VERIFY_MSG(split_edge_cnt == 2, "Wrong number of split edges");
-            finest_cell_ci[cell_index].ref_pat_ = RefPat::rp_trisect;
-          } else if (split_status ==
-                     std::tuple<bool, bool, bool>({false, true, false})) {
-            // Trisection refinement, triggering splitting of refinement edge
-            LF_VERIFY_MSG(split_edge_cnt == 1, "Wrong number of split edges");
+            break;
+          }
+          case 1: {
+            // One edge split: trisection refinement of the quadrilateral
+            // Anchor edge is the split edge
             finest_cell_ci[cell_index].ref_pat_ = RefPat::rp_trisect;
-            finest_edge_ci[cell_edge_indices[anchor]].ref_pat_ =
-                RefPat::rp_split;
-            refinement_complete = false;
-          } else if (split_status ==
-                     std::tuple<bool, bool, bool>({true, false, true})) {
-            // Trisection refinement (other side), no extra splitting of edges
-            LF_VERIFY_MSG(split_edge_cnt == 2, "Wrong number of split edges");
-            finest_cell_ci[cell_index].ref_pat_ = RefPat::rp_trisect_left;
-          } else if (split_status ==
-                     std::tuple<bool, bool, bool>({false, false, true})) {
-            // Trisection refinement (other side), triggering splitting of
-            // refinement edge
-            LF_VERIFY_MSG(split_edge_cnt == 1, "Wrong number of split edges");
-            finest_cell_ci[cell_index].ref_pat_ = RefPat::rp_trisect_left;
-            finest_edge_ci[cell_edge_indices[anchor]].ref_pat_ =
-                RefPat::rp_split;
-            refinement_complete = false;
-          } else if (split_status ==
-                     std::tuple<bool, bool, bool>({true, true, true})) {
-            // Quadsection refinement, no extra splitting of edges
-            LF_VERIFY_MSG(split_edge_cnt == 3, "Wrong number of split edges");
-            finest_cell_ci[cell_index].ref_pat_ = RefPat::rp_quadsect;
-          } else if (split_status ==
-                     std::tuple<bool, bool, bool>({false, true, true})) {
-            // Quadsection refinement requiring splitting of refinement edge
-            LF_VERIFY_MSG(split_edge_cnt == 2, "Wrong number of split edges");
-            finest_cell_ci[cell_index].ref_pat_ = RefPat::rp_quadsect;
-            finest_edge_ci[cell_edge_indices[anchor]].ref_pat_ =
-                RefPat::rp_split;
-            refinement_complete = false;
-          } else {
-            LF_VERIFY_MSG(false, "Impossible case");
+            finest_cell_ci[cell_index].anchor_ = split_edge_idx[0];
+            break;
           }
-          break;
-        }  // end case of a triangle
-        case lf::base::RefEl::kQuad(): {
-          // There is no refinement edge for quadrilaterals and so no extra edge
-          // splitting will be necessary. The refinement pattern for a
-          // quadrilateral will be determined from the number of edges split and
-          // their location to each other.
-          switch (split_edge_cnt) {
-            case 0: {
-              // No edge split: quadrilateral has to be copied
-              finest_cell_ci[cell_index].ref_pat_ = RefPat::rp_copy;
-              break;
-            }
-            case 1: {
-              // One edge split: trisection refinement of the quadrilateral
-              // Anchor edge is the split edge
-              finest_cell_ci[cell_index].ref_pat_ = RefPat::rp_trisect;
+          case 2: {
+            if ((split_edge_idx[1] - split_edge_idx[0]) == 2) {
+              // If the two split edges are opposite to each other, then
+              // bisection of the quadrilateral is the right refinement
+              // pattern.
+              finest_cell_ci[cell_index].ref_pat_ = RefPat::rp_bisect;
               finest_cell_ci[cell_index].anchor_ = split_edge_idx[0];
-              break;
-            }
-            case 2: {
-              if ((split_edge_idx[1] - split_edge_idx[0]) == 2) {
-                // If the two split edges are opposite to each other, then
-                // bisection of the quadrilateral is the right refinement
-                // pattern.
-                finest_cell_ci[cell_index].ref_pat_ = RefPat::rp_bisect;
+            } else {
+              // Tthe two split edges are adjacent, this case can be
+              // accommodated by quadsection refinement. Anchor is the split
+              // edge with the lower index (modulo 4).
+              finest_cell_ci[cell_index].ref_pat_ = RefPat::rp_quadsect;
+              if (((split_edge_idx[0] + 1) % 4) == split_edge_idx[1]) {
                 finest_cell_ci[cell_index].anchor_ = split_edge_idx[0];
+              } else if (((split_edge_idx[1] + 1) % 4) == split_edge_idx[0]) {
+                finest_cell_ci[cell_index].anchor_ = split_edge_idx[1];
               } else {
-                // Tthe two split edges are adjacent, this case can be
-                // accommodated by quadsection refinement. Anchor is the split
-                // edge with the lower index (modulo 4).
-                finest_cell_ci[cell_index].ref_pat_ = RefPat::rp_quadsect;
-                if (((split_edge_idx[0] + 1) % 4) == split_edge_idx[1]) {
-                  finest_cell_ci[cell_index].anchor_ = split_edge_idx[0];
-                } else if (((split_edge_idx[1] + 1) % 4) == split_edge_idx[0]) {
-                  finest_cell_ci[cell_index].anchor_ = split_edge_idx[1];
-                } else {
-                  LF_VERIFY_MSG(false,
-                                "Quad: impossible situation for 2 split edges");
-                }
+                LF_VERIFY_MSG(false,
+                              "Quad: impossible situation for 2 split edges");
               }
-              break;
             }
-            case 3: {
-              // Three edges of the quadrilateral are split, which can be
-              // accommodated only by the rp_threeedge refinement pattern
-              // anchor is the edge with the middle index
-              finest_cell_ci[cell_index].ref_pat_ = RefPat::rp_threeedge;
-              if (!edge_split[0]) {  // Split edges 1,2,3, middle edge 2
-                finest_cell_ci[cell_index].anchor_ = 2;
-              } else if (!edge_split[1]) {  // Split edges 0,2,3, middle edge 3
-                finest_cell_ci[cell_index].anchor_ = 3;
-              } else if (!edge_split[2]) {  // Split edges 0,1,3, middle edge 0
-                finest_cell_ci[cell_index].anchor_ = 0;
-              } else if (!edge_split[3]) {  // Split edges 0,1,2, middle edge 1
-                finest_cell_ci[cell_index].anchor_ = 1;
-              } else {
-                LF_VERIFY_MSG(false, "Inconsistent split pattern");
-              }
-              break;
-            }
-            case 4: {
-              // All edges are split => regular refinement
-              finest_cell_ci[cell_index].ref_pat_ = RefPat::rp_regular;
-              break;
-            }
-            default: {
-              LF_VERIFY_MSG(false, "Illegal number " << split_edge_cnt
-                                                     << " of split edges");
-              break;
+            break;
+          }
+          case 3: {
+            // Three edges of the quadrilateral are split, which can be
+            // accommodated only by the rp_threeedge refinement pattern
+            // anchor is the edge with the middle index
+            finest_cell_ci[cell_index].ref_pat_ = RefPat::rp_threeedge;
+            if (!edge_split[0]) {  // Split edges 1,2,3, middle edge 2
+              finest_cell_ci[cell_index].anchor_ = 2;
+            } else if (!edge_split[1]) {  // Split edges 0,2,3, middle edge 3
+              finest_cell_ci[cell_index].anchor_ = 3;
+            } else if (!edge_split[2]) {  // Split edges 0,1,3, middle edge 0
+              finest_cell_ci[cell_index].anchor_ = 0;
+            } else if (!edge_split[3]) {  // Split edges 0,1,2, middle edge 1
+              finest_cell_ci[cell_index].anchor_ = 1;
+            } else {
+              LF_VERIFY_MSG(false, "Inconsistent split pattern");
             }
-          }  // end switch split_edge_cnt
-          break;
-        }  // end case of a quadrilateral
-        default: {
-          LF_VERIFY_MSG(false, "Illegal cell type");
-          break;
+            break;
+          }
+          case 4: {
+            // All edges are split => regular refinement
+            finest_cell_ci[cell_index].ref_pat_ = RefPat::rp_regular;
+            break;
+          }
+          default: {
+            LF_VERIFY_MSG(false, "Illegal number " << split_edge_cnt
+                                                   << " of split edges");
+            break;
+          }
+        }  // end switch split_edge_cnt
+        break;
+      }  // end case of a quadrilateral
+      default: {
+        LF_VERIFY_MSG(false, "Illegal cell type");
+        break;
+      }
+    }  // end switch cell type
+    return newly_split_edge;
+  };  // end update_cell_refpat
+
+  // To keep the mesh conforming refinement might have to propagate.
+  // This is achieved by a worklist of cells, whose refinement patterns have
+  // to be updated. It is seeded with the cells adjacent to marked edges.
+  // Whenever an extra edge has to be split, the cells sharing it are added.
+  // Thus the cost of the closure is proportional to the size of the refined
+  // region, apart from the setup of the edge-cell adjacency.
+  std::vector<std::array<glb_idx_t, 2>> edge_cells(
+      finest_mesh.Size(1), std::array<glb_idx_t, 2>{{idx_nil, idx_nil}});
+  std::vector<glb_idx_t> worklist;
+  std::vector<bool> in_worklist(finest_mesh.Size(0), false);
+  for (const lf::mesh::Entity &cell : finest_mesh.Entities(0)) {
+    const glb_idx_t cell_index = finest_mesh.Index(cell);
+    bool has_split_edge = false;
+    for (const lf::mesh::Entity &edge : cell.SubEntities(1)) {
+      const glb_idx_t edge_index = finest_mesh.Index(edge);
+      std::array<glb_idx_t, 2> &adj_cells(edge_cells[edge_index]);
+      adj_cells[(adj_cells[0] == idx_nil) ? 0 : 1] = cell_index;
+      has_split_edge = has_split_edge || EdgeMarked(edge_index);
+    }
+    // Cells without split edges are copied; the anchor of a triangle is
+    // always its refinement edge
+    CellChildInfo &cell_ci(finest_cell_ci[cell_index]);
+    cell_ci.ref_pat_ = RefPat::rp_copy;
+    if (cell.RefEl() == lf::base::RefEl::kTria()) {
+      cell_ci.anchor_ = refinement_edges_.back()[cell_index];
+    }
+    if (has_split_edge) {
+      worklist.push_back(cell_index);
+      in_worklist[cell_index] = true;
+    }
+  }
+  while (!worklist.empty()) {
+    const glb_idx_t cell_index = worklist.back();
+    worklist.pop_back();
+    in_worklist[cell_index] = false;
+    const glb_idx_t edge_index =
+        update_cell_refpat(*finest_mesh.EntityByIndex(0, cell_index));
+    if (edge_index != idx_nil) {
+      for (const glb_idx_t adj_cell_index : edge_cells[edge_index]) {
+        if ((adj_cell_index != idx_nil) && !in_worklist[adj_cell_index]) {
+          worklist.push_back(adj_cell_index);
+          in_worklist[adj_cell_index] = true;
         }
-      }  // end switch cell type
-    }    // end loop over cells
-  } while (!refinement_complete);
+      }
+    }
+  }
 
   PerformRefinement();
 }  // end RefineMarked
@@ -359,41 +874,121 @@ void MeshHierarchy::PerformRefinement() {
   // First run through the vertices, create child vertices and register
   // them with the mesh factory
   // Store child indices in an auxiliary array
+  // Refinement proceeds in three stages:
+  // (i) The number of children of every entity is obtained from its
+  // refinement pattern and index ranges for the children are reserved by
+  // prefix sums. Child points are numbered in the order: copies of nodes,
+  // midpoints of edges, interior points of cells; child edges are numbered
+  // in the order: children of edges, interior edges of cells. This numbering
+  // is deterministic and agrees with that of sequential processing.
+  // (ii) Child geometries and connectivity are generated concurrently for all
+  // entities of a particular co-dimension, see lf::base::ParallelFor().
+  // (iii) The child entities are registered with the mesh factory in the
+  // order of their indices.
   {
     std::vector<PointChildInfo> &pt_child_info(point_child_infos_.back());
-    size_type new_node_cnt = 0;
+    std::vector<EdgeChildInfo> &ed_child_info(edge_child_infos_.back());
+    std::vector<CellChildInfo> &cell_child_info(cell_child_infos_.back());
+    const size_type no_nodes = parent_mesh.Size(2);
+    const size_type no_edges = parent_mesh.Size(1);
+    const size_type no_cells = parent_mesh.Size(0);
+    LF_VERIFY_MSG(pt_child_info.size() == no_nodes,
+                  "Size mismatch for PointChildInfos");
+    LF_VERIFY_MSG(ed_child_info.size() == no_edges,
+                  "Size mismatch for EdgeChildInfos");
+    LF_VERIFY_MSG(cell_child_info.size() == no_cells,
+                  "Size mismatch for CellChildInfos");
+    // All checks of the input data are done here, the checks in the
+    // concurrent stages below only guard the consistency of this function.
+    VerifyRefinementPatterns(parent_mesh, pt_child_info, ed_child_info,
+                             cell_child_info);
+    // Diagnostic output is only sensible for sequential execution
+    const unsigned int num_threads = (output_ctrl_ > 0) ? 1 : 0;
+
+    // Stage (i): count children of all entities
+    ChildOffsets node_offsets(no_nodes);
+    ChildOffsets edge_offsets(no_edges);
+    ChildOffsets cell_offsets(no_cells);
+    auto count_children = [&parent_mesh, num_threads](
+                              dim_t codim, ChildOffsets &offsets,
+                              auto &&get_refpat) {
+      lf::base::ParallelFor(
+          parent_mesh.Size(codim),
+          [&](std::size_t first, std::size_t last) {
+            for (std::size_t idx = first; idx < last; ++idx) {
+              const mesh::Entity &e{*parent_mesh.EntityByIndex(codim, idx)};
+              const auto [ref_pat, anchor] = get_refpat(idx);
+              if (ref_pat == RefPat::rp_nil) {
+                continue;  // no children, invalid patterns caught below
+              }
+              const Hybrid2DRefinementPattern rp(e.RefEl(), ref_pat, anchor);
+              const dim_t dim = e.RefEl().Dimension();
+              offsets.Set(idx, rp.noChildren(0),
+                          (dim > 0) ? rp.noChildren(1) : 0,
+                          (dim > 1) ? rp.noChildren(2) : 0);
+            }
+          },
+          kMinChunkSize, num_threads);
+    };
+    count_children(2, node_offsets, [&pt_child_info](std::size_t idx) {
+      return std::make_pair(pt_child_info[idx].ref_pat, sub_idx_t(idx_nil));
+    });
+    count_children(1, edge_offsets, [&ed_child_info](std::size_t idx) {
+      return std::make_pair(ed_child_info[idx].ref_pat_, sub_idx_t(idx_nil));
+    });
+    count_children(0, cell_offsets, [&cell_child_info](std::size_t idx) {
+      return std::make_pair(cell_child_info[idx].ref_pat_,
+                            cell_child_info[idx].anchor_);
+    });
+    // Prefix sums: child points of nodes come first, then those of edges, and
+    // finally those of cells; the same for child edges
+    node_offsets.PrefixSum(0, 0, 0);
+    edge_offsets.PrefixSum(0, node_offsets.Total(0), 0);
+    cell_offsets.PrefixSum(0, edge_offsets.Total(0), edge_offsets.Total(1));
+    ChildEntityStore store(cell_offsets.Total(2), cell_offsets.Total(1),
+                           cell_offsets.Total(0));
+
+    // Stage (ii): create child nodes of nodes. Every thread allocates the
+    // child geometries from the arena of the mesh factory.
+    geometry::GeometryArena *const arena = mesh_factory_->Arena();
     const Hybrid2DRefinementPattern rp_copy_node(lf::base::RefEl::kPoint(),
                                                  RefPat::rp_copy);
-    for (const mesh::Entity &node : parent_mesh.Entities(2)) {
-      // Obtain index of node in coarse mesh
-      const lf::base::glb_idx_t node_index = parent_mesh.Index(node);
-      LF_VERIFY_MSG(node_index < pt_child_info.size(),
-                    "Node index " << node_index << " out of range");
-      // Find position of node in physical coordinates
-      const lf::geometry::Geometry &pt_geo(*node.Geometry());
-      if (pt_child_info[node_index].ref_pat != RefPat::rp_nil) {
-        // Generate a node for the fine mesh at the same position
-        std::vector<std::unique_ptr<geometry::Geometry>> pt_child_geo_ptrs(
-            pt_geo.ChildGeometry(rp_copy_node, 0));
-        LF_VERIFY_MSG(pt_child_geo_ptrs.size() == 1,
-                      "A point can only have one chile");
-        pt_child_info[node_index].child_point_idx =
-            mesh_factory_->AddPoint(std::move(pt_child_geo_ptrs[0]));
-        new_node_cnt++;
-      }
-    }  // end loop over nodes
-    CONTROLLEDSTATEMENT(
-        output_ctrl_, 10,
-        std::cout << new_node_cnt << " new nodes added" << std::endl;)
+    lf::base::ParallelFor(
+        no_nodes,
+        [&](std::size_t first, std::size_t last) {
+          const geometry::GeometryArena::Scope scope(arena);
+          for (glb_idx_t node_index = first; node_index < last;
+               ++node_index) {
+            const mesh::Entity &node{
+                *parent_mesh.EntityByIndex(2, node_index)};
+            // Find position of node in physical coordinates
+            const lf::geometry::Geometry &pt_geo(*node.Geometry());
+            if (pt_child_info[node_index].ref_pat != RefPat::rp_nil) {
+              // Generate a node for the fine mesh at the same position
+              std::vector<std::unique_ptr<geometry::Geometry>>
+                  pt_child_geo_ptrs(pt_geo.ChildGeometry(rp_copy_node, 0));
+              LF_VERIFY_MSG(pt_child_geo_ptrs.size() == 1,
+                            "A point can only have one chile");
+              glb_idx_t next_point = node_offsets.First(node_index, 0);
+              pt_child_info[node_index].child_point_idx = store.AddPoint(
+                  next_point, std::move(pt_child_geo_ptrs[0]));
+            }
+          }  // end loop over nodes
+        },
+        kMinChunkSize, num_threads);
+    CONTROLLEDSTATEMENT(output_ctrl_, 10,
+                        std::cout << node_offsets.Total(0)
+                                  << " new nodes added" << std::endl;)
 
     // Now traverse the edges. Depending on the refinement pattern,
     // either copy them or split them.
     // Supplement the refinement information for edges accordingly.
-    std::vector<EdgeChildInfo> &ed_child_info(edge_child_infos_.back());
-    size_type new_edge_cnt = 0;
-    for (const mesh::Entity &edge : parent_mesh.Entities(1)) {
-      // Fetch global index of edge
-      lf::base::glb_idx_t edge_index = parent_mesh.Index(edge);
+    // Stage (ii): create child nodes and edges of edges
+    auto refine_edge = [&](glb_idx_t edge_index) -> void {
+      const mesh::Entity &edge{*parent_mesh.EntityByIndex(1, edge_index)};
+      // Running indices of child points and edges of the current edge
+      glb_idx_t next_point = edge_offsets.First(edge_index, 1);
+      glb_idx_t next_edge = edge_offsets.First(edge_index, 0);
 
       // Get indices of endpoints in parent mesh
       auto ed_nodes(edge.SubEntities(1));
@@ -427,11 +1022,9 @@ void MeshHierarchy::PerformRefinement() {
                                         << "," << ed_p1_fine_idx << "] "
                                         << std::endl;)
 
-          edge_ci.child_edge_idx.push_back(mesh_factory_->AddEntity(
-              edge.RefEl(),
-              lf::base::ForwardRange<const lf::base::glb_idx_t>(
-                  {ed_p0_fine_idx, ed_p1_fine_idx}),
-              std::move(ed_copy[0])));
+          edge_ci.child_edge_idx.push_back(
+              store.AddEdge(next_edge, {ed_p0_fine_idx, ed_p1_fine_idx},
+                            std::move(ed_copy[0])));
           break;
         }  // end rp_copy
         case rp_split: {
@@ -445,7 +1038,7 @@ void MeshHierarchy::PerformRefinement() {
                                            << " child nodes!");
           // Register midpoint as new node
           const lf::base::glb_idx_t midpoint_fine_idx =
-              mesh_factory_->AddPoint(std::move(edge_nodes_geo_ptrs[0]));
+              store.AddPoint(next_point, std::move(edge_nodes_geo_ptrs[0]));
           edge_ci.child_point_idx.push_back(midpoint_fine_idx);
           // Next get the geometry objects for the two child edges (co-dim == 0)
           std::vector<std::unique_ptr<geometry::Geometry>> edge_child_geo_ptrs(
@@ -463,16 +1056,12 @@ void MeshHierarchy::PerformRefinement() {
                                         << midpoint_fine_idx << ","
                                         << ed_p1_fine_idx << "] " << std::endl;)
 
-          edge_ci.child_edge_idx.push_back(mesh_factory_->AddEntity(
-              edge.RefEl(),
-              lf::base::ForwardRange<const lf::base::glb_idx_t>(
-                  {ed_p0_fine_idx, midpoint_fine_idx}),
-              std::move(edge_child_geo_ptrs[0])));
-          edge_ci.child_edge_idx.push_back(mesh_factory_->AddEntity(
-              edge.RefEl(),
-              lf::base::ForwardRange<const lf::base::glb_idx_t>(
-                  {midpoint_fine_idx, ed_p1_fine_idx}),
-              std::move(edge_child_geo_ptrs[1])));
+          edge_ci.child_edge_idx.push_back(
+              store.AddEdge(next_edge, {ed_p0_fine_idx, midpoint_fine_idx},
+                            std::move(edge_child_geo_ptrs[0])));
+          edge_ci.child_edge_idx.push_back(
+              store.AddEdge(next_edge, {midpoint_fine_idx, ed_p1_fine_idx},
+                            std::move(edge_child_geo_ptrs[1])));
           break;
         }  // end rp_split
         default: {
@@ -482,25 +1071,38 @@ void MeshHierarchy::PerformRefinement() {
           break;
         }
       }  // end switch refpat
-      new_edge_cnt++;
-    }  // end edge loop
+      LF_VERIFY_MSG((next_point == edge_offsets.First(edge_index + 1, 1)) &&
+                        (next_edge == edge_offsets.First(edge_index + 1, 0)),
+                    "Wrong number of children for edge " << edge_index);
+    };  // end refine_edge
+    lf::base::ParallelFor(
+        no_edges,
+        [&refine_edge, arena](std::size_t first, std::size_t last) {
+          const geometry::GeometryArena::Scope scope(arena);
+          for (std::size_t edge_index = first; edge_index < last;
+               ++edge_index) {
+            refine_edge(edge_index);
+          }
+        },
+        kMinChunkSize, num_threads);
 
-    CONTROLLEDSTATEMENT(
-        output_ctrl_, 50,
-        std::cout << new_edge_cnt << " edges added " << std::endl;)
+    CONTROLLEDSTATEMENT(output_ctrl_, 50,
+                        std::cout << edge_offsets.Total(0) << " edges added "
+                                  << std::endl;)
 
     // Visit all cells, examine their refinement patterns, retrieve indices of
     // their sub-entities, and those of the children.
-    std::vector<CellChildInfo> &cell_child_info(cell_child_infos_.back());
-    LF_VERIFY_MSG(cell_child_info.size() == parent_mesh.Size(0),
-                  "Size mismatch for CellChildInfos");
-    for (const mesh::Entity &cell : parent_mesh.Entities(0)) {
+    // Stage (ii): create child nodes, edges and cells of cells
+    auto refine_cell = [&](glb_idx_t cell_index) -> void {
+      const mesh::Entity &cell{*parent_mesh.EntityByIndex(0, cell_index)};
       // type of cell
       const lf::base::RefEl ref_el(cell.RefEl());
       const lf::base::size_type num_edges = ref_el.NumSubEntities(1);
       const lf::base::size_type num_vertices = ref_el.NumSubEntities(2);
-      // fetch index of current cell
-      const lf::base::glb_idx_t cell_index(parent_mesh.Index(cell));
+      // Running indices of child entities of the current cell
+      glb_idx_t next_point = cell_offsets.First(cell_index, 2);
+      glb_idx_t next_edge = cell_offsets.First(cell_index, 1);
+      glb_idx_t next_cell = cell_offsets.First(cell_index, 0);
 
       // Set up refinement object -> variable rp
       CellChildInfo &cell_ci(cell_child_info[cell_index]);
@@ -786,8 +1388,8 @@ void MeshHierarchy::PerformRefinement() {
                               << cell_center_geo_ptrs.size()
                               << " interior child nodes ??");
             // Register midpoint as new node
-            const glb_idx_t center_fine_idx =
-                mesh_factory_->AddPoint(std::move(cell_center_geo_ptrs[0]));
+            const glb_idx_t center_fine_idx = store.AddPoint(
+                next_point, std::move(cell_center_geo_ptrs[0]));
             cell_ci.child_point_idx.push_back(center_fine_idx);
 
             tria_ccn_tmp[0] = vertex_child_idx[0];
@@ -1121,8 +1723,8 @@ void MeshHierarchy::PerformRefinement() {
                               << cell_center_geo_ptrs.size()
                               << " interior child nodes!");
             // Register midpoint as new node
-            const glb_idx_t center_fine_idx =
-                mesh_factory_->AddPoint(std::move(cell_center_geo_ptrs[0]));
+            const glb_idx_t center_fine_idx = store.AddPoint(
+                next_point, std::move(cell_center_geo_ptrs[0]));
             cell_ci.child_point_idx.push_back(center_fine_idx);
 
             // Set the node indices (w.r.t. fine mesh) of the four sub-quads
@@ -1208,9 +1810,8 @@ void MeshHierarchy::PerformRefinement() {
                                   << ": new edge " << k << "[" << cen[0] << ","
                                   << cen[1] << "]" << std::endl;)
 
-          const glb_idx_t new_edge_index = mesh_factory_->AddEntity(
-              lf::base::RefEl::kSegment(), {cen[0], cen[1]},
-              std::move(cell_edge_geo_ptrs[k]));
+          const glb_idx_t new_edge_index = store.AddEdge(
+              next_edge, {cen[0], cen[1]}, std::move(cell_edge_geo_ptrs[k]));
           cell_ci.child_edge_idx.push_back(new_edge_index);
         }  // end loop over new edges
       }    // end register new edges
@@ -1234,8 +1835,9 @@ void MeshHierarchy::PerformRefinement() {
                           << ": new triangle " << k << " [" << ccn[0] << ","
                           << ccn[1] << "," << ccn[2] << "]" << std::endl;)
 
-            new_cell_index = mesh_factory_->AddEntity(
-                lf::base::RefEl::kTria(), {ccn[0], ccn[1], ccn[2]},
+            new_cell_index = store.AddCell(
+                next_cell, lf::base::RefEl::kTria(),
+                {ccn[0], ccn[1], ccn[2], idx_nil},
                 std::move(childcell_geo_ptrs[k]));
           } else if (ccn.size() == 4) {
             // New cell is a quadrilateral
@@ -1247,8 +1849,9 @@ void MeshHierarchy::PerformRefinement() {
                                     << "," << ccn[1] << "," << ccn[2] << ","
                                     << ccn[3] << "]" << std::endl;)
 
-            new_cell_index = mesh_factory_->AddEntity(
-                lf::base::RefEl::kQuad(), {ccn[0], ccn[1], ccn[2], ccn[3]},
+            new_cell_index = store.AddCell(
+                next_cell, lf::base::RefEl::kQuad(),
+                {ccn[0], ccn[1], ccn[2], ccn[3]},
                 std::move(childcell_geo_ptrs[k]));
           } else {
             LF_VERIFY_MSG(false,
@@ -1257,8 +1860,32 @@ void MeshHierarchy::PerformRefinement() {
           cell_ci.child_cell_idx.push_back(new_cell_index);
         }  // end loop over new cells
       }    // end register new cells
-    }      // end loop over cells
+      LF_VERIFY_MSG((next_point == cell_offsets.First(cell_index + 1, 2)) &&
+                        (next_edge == cell_offsets.First(cell_index + 1, 1)) &&
+                        (next_cell == cell_offsets.First(cell_index + 1, 0)),
+                    "Wrong number of children for cell " << cell_index);
+    };  // end refine_cell
+    lf::base::ParallelFor(
+        no_cells,
+        [&refine_cell, arena](std::size_t first, std::size_t last) {
+          const geometry::GeometryArena::Scope scope(arena);
+          for (std::size_t cell_index = first; cell_index < last;
+               ++cell_index) {
+            refine_cell(cell_index);
+          }
+        },
+        kMinChunkSize, num_threads);
+
+    // Stage (iii): register the new entities with the mesh factory in the
+    // order of their indices
+    store.Register(*mesh_factory_);
   }
+  CompleteRefinement();
+}
+
+void MeshHierarchy::CompleteRefinement() {
+  // The current finest mesh is the parent of the mesh to be built
+  const mesh::Mesh &parent_mesh(*meshes_.back());
   // At this point the MeshFactory has complete information to generate the new
   // finest mesh
   meshes_.push_back(mesh_factory_->Build());  // MESH CONSTRUCTION
@@ -1293,7 +1920,7 @@ void MeshHierarchy::PerformRefinement() {
         std::move(std::vector<sub_idx_t>(child_mesh.Size(0), idx_nil)));
 
     // Finally set up vector for edge flags
-    edge_marked_.emplace_back(child_mesh.Size(1), false);
+    edge_marked_.emplace_back(NoFlagWords(child_mesh.Size(1)), 0);
   }
 
   // Finally, we have to initialize the parent pointers for the entities of the
@@ -1668,6 +2295,56 @@ void MeshHierarchy::PerformRefinement() {
       }
     }
   }
+  // Respect bound on the depth of the hierarchy
+  DropCoarsestLevels();
+}
+
+void MeshHierarchy::Coarsen() {
+  const size_type num_levels = NumLevels();
+  LF_VERIFY_MSG(num_levels > 1, "Cannot remove the base mesh");
+  meshes_.pop_back();
+  point_child_infos_.pop_back();
+  edge_child_infos_.pop_back();
+  cell_child_infos_.pop_back();
+  parent_infos_.pop_back();
+  edge_marked_.pop_back();
+  refinement_edges_.pop_back();
+  // The new finest mesh has no children
+  const mesh::Mesh &finest_mesh(*meshes_.back());
+  point_child_infos_.back().assign(finest_mesh.Size(2), PointChildInfo());
+  edge_child_infos_.back().assign(finest_mesh.Size(1), EdgeChildInfo());
+  cell_child_infos_.back().assign(finest_mesh.Size(0), CellChildInfo());
+  edge_marked_.back().assign(NoFlagWords(finest_mesh.Size(1)), 0);
+}
+
+void MeshHierarchy::setMaxNumLevels(size_type max_num_levels) {
+  max_num_levels_ = max_num_levels;
+  DropCoarsestLevels();
+}
+
+void MeshHierarchy::DropCoarsestLevels() {
+  if ((max_num_levels_ == 0) || (NumLevels() <= max_num_levels_)) {
+    return;
+  }
+  const auto num_drop =
+      static_cast<std::ptrdiff_t>(NumLevels() - max_num_levels_);
+  meshes_.erase(meshes_.begin(), meshes_.begin() + num_drop);
+  point_child_infos_.erase(point_child_infos_.begin(),
+                           point_child_infos_.begin() + num_drop);
+  edge_child_infos_.erase(edge_child_infos_.begin(),
+                          edge_child_infos_.begin() + num_drop);
+  cell_child_infos_.erase(cell_child_infos_.begin(),
+                          cell_child_infos_.begin() + num_drop);
+  parent_infos_.erase(parent_infos_.begin(), parent_infos_.begin() + num_drop);
+  edge_marked_.erase(edge_marked_.begin(), edge_marked_.begin() + num_drop);
+  refinement_edges_.erase(refinement_edges_.begin(),
+                          refinement_edges_.begin() + num_drop);
+  // Parents of entities on the new coarsest level are gone
+  const mesh::Mesh &base_mesh(*meshes_.front());
+  for (dim_t codim = 0; codim < 3; ++codim) {
+    std::vector<ParentInfo> &parent_info(parent_infos_.front()[codim]);
+    parent_info.assign(base_mesh.Size(codim), ParentInfo());
+  }
 }
 
 sub_idx_t MeshHierarchy::LongestEdge(const lf::mesh::Entity &T) const {
@@ -7,10 +7,27 @@
  *
  */
 
+#include <lf/base/base.h>
+#include <Eigen/Core>
+#include <algorithm>
+#include <cstdint>
 #include "hybrid2d_refinement_pattern.h"
 
 namespace lf::refinement {
 
+/**
+ * @brief Strategies for selecting cells to be refined based on local error
+ * indicators, see MeshHierarchy::MarkEdges()
+ */
+enum class MarkingStrategy {
+  /** cells whose indicator is at least `theta` times the maximal one */
+  kMaximum,
+  /** smallest set of cells with largest indicators, whose squared indicators
+      add up to at least `theta` times the sum of all squared indicators
+      (Doerfler or bulk criterion) */
+  kDoerfler
+};
+
 /**
  * @brief Information about the refinement status of a point
  *
@@ -228,9 +245,67 @@ class MeshHierarchy {
    * finest level is provided to the marker object by the `MeshHierarchy`.
    *
    * Of course, marking will always affect the finest mesh in hierarchy.
+   *
+   * The marker is invoked once for every edge in the order of
+   * mesh::Mesh::Entities(). See MarkEdgesParallel() for a concurrent
+   * variant.
    */
   template <typename Marker>
   void MarkEdges(Marker &&marker);
+  /**
+   * @brief Mark the edges of a mesh based on a predicate that is evaluated
+   *        concurrently for different edges
+   *
+   * @param marker predicate as for MarkEdges(Marker &&)
+   * @param num_threads number of threads, 0 for
+   * lf::base::DefaultNumThreads(), see lf::base::ParallelFor()
+   *
+   * The result agrees with that of MarkEdges(Marker &&).
+   *
+   * @note The marker is called from several threads at the same time and
+   * in no particular order, so it must be thread-safe. This is the case for a
+   * marker that merely reads data, but not for one that modifies state
+   * shared between calls (e.g. counts the marked edges) without
+   * synchronization.
+   */
+  template <typename Marker>
+  void MarkEdgesParallel(Marker &&marker, unsigned int num_threads = 0);
+  /**
+   * @brief Mark the edges of the finest mesh with given indices
+   *
+   * @param edge_indices indices of the edges to be marked, all other edges
+   * are unmarked
+   *
+   * The cost is proportional to the number of marked edges, apart from
+   * clearing the packed flags of all edges.
+   */
+  void MarkEdgesByIndex(const std::vector<glb_idx_t> &edge_indices);
+  /**
+   * @brief Mark the edges of cells selected from local error indicators
+   *
+   * @param cell_estimators local error indicators for all cells of the
+   * finest mesh, indexed by cell index
+   * @param strategy rule for selecting cells, see MarkingStrategy
+   * @param theta parameter in [0,1] of the marking strategy
+   *
+   * All edges of the selected cells are marked, all other edges are unmarked.
+   * Ties between cells with equal indicators are resolved by the cell index,
+   * which makes the selection deterministic.
+   */
+  void MarkEdges(const Eigen::VectorXd &cell_estimators,
+                 MarkingStrategy strategy, double theta);
+  /**
+   * @brief Check whether an edge of the finest mesh is marked for refinement
+   *
+   * @param edge_index index of an edge of the finest mesh
+   */
+  bool EdgeMarked(glb_idx_t edge_index) const {
+    LF_ASSERT_MSG(edge_index < meshes_.back()->Size(1),
+                  "Edge index " << edge_index << " out of range");
+    return ((edge_marked_.back()[edge_index / kFlagBits] >>
+             (edge_index % kFlagBits)) &
+            1U) != 0;
+  }
 
   /**
    * @brief Conduct local refinement of the mesh splitting all marked edges
@@ -260,11 +335,34 @@ class MeshHierarchy {
   /**
    * @brief _Destroy_ the mesh on the finest level unless it is the base mesh
    *
+   * The mesh on the finest level and all information about its entities are
+   * removed from the hierarchy. The refinement information for the entities of
+   * the mesh on the level above is reset, as is done by the constructor for
+   * the base mesh, so that this mesh can be refined anew, for instance with a
+   * different set of marked edges.
+   *
    * @note the use of shared pointers prevents destruction if the finest mesh
    *       is still in use somewhere else in the code.
    */
   void Coarsen();
 
+  /**
+   * @brief Limit the number of levels kept in the hierarchy
+   *
+   * @param max_num_levels maximal number of levels, 0 means no limit
+   *
+   * Whenever the number of levels exceeds `max_num_levels`, the coarsest
+   * levels are removed from the hierarchy together with all information about
+   * their entities. The coarsest remaining mesh becomes the mesh on level 0,
+   * which has no parents. Hence level numbers shift after refinement.
+   *
+   * This mode is meant for long-running adaptive computations, in which only
+   * the most recent meshes are needed.
+   */
+  void setMaxNumLevels(size_type max_num_levels);
+  /** @brief maximal number of levels, 0 if not limited */
+  size_type MaxNumLevels() const { return max_num_levels_; }
+
   virtual ~MeshHierarchy() = default;
 
  private:
@@ -306,10 +404,47 @@ class MeshHierarchy {
   std::vector<std::vector<CellChildInfo>> cell_child_infos_;
   /** @brief information about parent entities on each level */
   std::vector<std::array<std::vector<ParentInfo>, 3>> parent_infos_;
-  /** @brief Information about marked edges */
-  std::vector<std::vector<bool>> edge_marked_;
+  /** @brief number of edge flags packed into one word */
+  static constexpr size_type kFlagBits = 64;
+  /** @brief Information about marked edges, one bit per edge */
+  std::vector<std::vector<std::uint64_t>> edge_marked_;
+  /** @brief number of words for packed flags of a number of edges */
+  static size_type NoFlagWords(size_type no_edges) {
+    return (no_edges + kFlagBits - 1) / kFlagBits;
+  }
   /** @brief Information about local refinement edges of triangles */
   std::vector<std::vector<sub_idx_t>> refinement_edges_;
+  /** @brief maximal number of levels kept, 0 for no limit */
+  size_type max_num_levels_{0};
+
+  /**
+   * @brief Remove coarsest levels until the bound set by setMaxNumLevels()
+   *        is met
+   */
+  void DropCoarsestLevels();
+  /**
+   * @brief Build the new finest mesh from the entities passed to the mesh
+   *        factory and set up parent information and refinement edges for it
+   *
+   * Expects that the `ChildInfo` vectors of the current finest mesh contain
+   * the indices of all child entities. Called at the end of
+   * PerformRefinement() and RefineRegularStraight().
+   */
+  void CompleteRefinement();
+  /**
+   * @brief Regular refinement of meshes with straight edges and cells
+   *
+   * If all cells of the finest mesh are described by lf::geometry::TriaO1,
+   * lf::geometry::QuadO1 or lf::geometry::Parallelogram objects, regular
+   * refinement is a purely combinatorial operation: child entities are
+   * created from fixed templates and their vertex coordinates are obtained
+   * as midpoints. This avoids lf::geometry::Geometry::ChildGeometry() and
+   * the refinement pattern machinery. The resulting mesh and the child
+   * information agree with those created by PerformRefinement().
+   *
+   * @return false, if the finest mesh does not qualify; nothing is done then
+   */
+  bool RefineRegularStraight();
 
   /**
    * @brief Finds the index of the longest edge of a triangle
@@ -328,17 +463,55 @@ template <typename Marker>
 void MeshHierarchy::MarkEdges(Marker &&marker) {
   // Retrieve the finest mesh in the hierarchy
   const mesh::Mesh &finest_mesh(*meshes_.back());
+  std::vector<std::uint64_t> &flags(edge_marked_.back());
 
-  LF_VERIFY_MSG(edge_marked_.back().size() == finest_mesh.Size(1),
+  LF_VERIFY_MSG(flags.size() * kFlagBits >= finest_mesh.Size(1),
                 "Length  mismatch for edge flag array");
 
   // Run through the edges = entities of co-dimension 1
+  std::fill(flags.begin(), flags.end(), 0);
   for (const mesh::Entity &edge : finest_mesh.Entities(1)) {
-    glb_idx_t edge_index = finest_mesh.Index(edge);
-    (edge_marked_.back())[edge_index] = marker(finest_mesh, edge);
+    const glb_idx_t edge_index = finest_mesh.Index(edge);
+    if (marker(finest_mesh, edge)) {
+      flags[edge_index / kFlagBits] |= std::uint64_t(1)
+                                       << (edge_index % kFlagBits);
+    }
   }
 }
 
+template <typename Marker>
+void MeshHierarchy::MarkEdgesParallel(Marker &&marker,
+                                      unsigned int num_threads) {
+  // Retrieve the finest mesh in the hierarchy
+  const mesh::Mesh &finest_mesh(*meshes_.back());
+  const size_type no_edges = finest_mesh.Size(1);
+  std::vector<std::uint64_t> &flags(edge_marked_.back());
+
+  LF_VERIFY_MSG(flags.size() * kFlagBits >= no_edges,
+                "Length  mismatch for edge flag array");
+
+  // Run through the edges = entities of co-dimension 1. Every thread fills
+  // whole words of the packed flag array.
+  lf::base::ParallelFor(
+      flags.size(),
+      [&](std::size_t first, std::size_t last) {
+        for (std::size_t word = first; word < last; ++word) {
+          std::uint64_t bits = 0;
+          const glb_idx_t end =
+              std::min<glb_idx_t>(no_edges, (word + 1) * kFlagBits);
+          for (glb_idx_t edge_index = word * kFlagBits; edge_index < end;
+               ++edge_index) {
+            const mesh::Entity &edge{*finest_mesh.EntityByIndex(1, edge_index)};
+            if (marker(finest_mesh, edge)) {
+              bits |= std::uint64_t(1) << (edge_index % kFlagBits);
+            }
+          }
+          flags[word] = bits;
+        }
+      },
+      16, num_threads);
+}
+
 }  // namespace lf::refinement
 
 #endif
@@ -0,0 +1,86 @@
+/**
+ * @file
+ * @brief Tests for the removal of levels from a MeshHierarchy
+ * @author agent
+ * @date   2026-10-19
+ * @copyright MIT License
+ */
+
+#include <lf/mesh/test_utils/test_meshes.h>
+#include "refinement_test_utils.h"
+
+namespace lf::refinement::test {
+
+// Mark edges close to a point
+void MarkEdgesNear(MeshHierarchy &mh, const Eigen::Vector2d &c) {
+  mh.MarkEdges([&c](const mesh::Mesh & /*mesh*/, const mesh::Entity &edge) {
+    const Eigen::MatrixXd mp =
+        edge.Geometry()->Global((Eigen::MatrixXd(1, 1) << 0.5).finished());
+    return (mp - c).norm() < 1.0;
+  });
+}
+
+TEST(lf_refinement, Coarsen) {
+  auto base_mesh = mesh::test_utils::GenerateHybrid2DTestMesh(0);
+  MeshHierarchy mh(base_mesh, std::make_shared<mesh::hybrid2d::MeshFactory>(2));
+  mh.RefineRegular();
+  const std::shared_ptr<const mesh::Mesh> mesh1 = mh.getMesh(1);
+  MarkEdgesNear(mh, Eigen::Vector2d(1.0, 1.0));
+  mh.RefineMarked();
+  ASSERT_EQ(mh.NumLevels(), 3);
+
+  // Remove the finest level: the mesh is only kept alive by our pointer
+  std::weak_ptr<const mesh::Mesh> mesh2 = mh.getMesh(2);
+  mh.Coarsen();
+  EXPECT_EQ(mh.NumLevels(), 2);
+  EXPECT_TRUE(mesh2.expired());
+  EXPECT_EQ(mh.getMesh(1), mesh1);
+  for (const EdgeChildInfo &eci : mh.EdgeChildInfos(1)) {
+    EXPECT_EQ(eci.ref_pat_, RefPat::rp_nil);
+    EXPECT_TRUE(eci.child_edge_idx.empty());
+  }
+
+  // Refine differently and check the relations between the levels
+  MarkEdgesNear(mh, Eigen::Vector2d(2.0, 2.0));
+  mh.RefineMarked();
+  ASSERT_EQ(mh.NumLevels(), 3);
+  checkFatherChildRelations(mh, 1);
+
+  mh.Coarsen();
+  mh.Coarsen();
+  EXPECT_EQ(mh.NumLevels(), 1);
+  EXPECT_EQ(mh.getMesh(0), base_mesh);
+}
+
+TEST(lf_refinement, MaxNumLevels) {
+  auto base_mesh = mesh::test_utils::GenerateHybrid2DTestMesh(0);
+  MeshHierarchy mh(base_mesh, std::make_shared<mesh::hybrid2d::MeshFactory>(2));
+  mh.RefineRegular();
+  mh.RefineRegular();
+  std::weak_ptr<const mesh::Mesh> mesh0 = mh.getMesh(0);
+  const std::shared_ptr<const mesh::Mesh> mesh2 = mh.getMesh(2);
+  base_mesh.reset();
+
+  mh.setMaxNumLevels(2);
+  EXPECT_EQ(mh.NumLevels(), 2);
+  EXPECT_TRUE(mesh0.expired());
+  EXPECT_EQ(mh.getMesh(1), mesh2);
+  // No parents on the coarsest level
+  for (base::dim_t codim = 0; codim < 3; ++codim) {
+    for (const ParentInfo &pi : mh.ParentInfos(0, codim)) {
+      EXPECT_EQ(pi.parent_ptr, nullptr);
+    }
+  }
+
+  for (int step = 0; step < 3; ++step) {
+    MarkEdgesNear(mh, Eigen::Vector2d(1.0, 1.0));
+    mh.RefineMarked();
+    EXPECT_EQ(mh.NumLevels(), 2);
+    checkFatherChildRelations(mh, 0);
+  }
+  mh.setMaxNumLevels(0);
+  mh.RefineRegular();
+  EXPECT_EQ(mh.NumLevels(), 3);
+}
+
+}  // namespace lf::refinement::test
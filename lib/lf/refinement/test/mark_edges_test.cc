@@ -0,0 +1,124 @@
+/**
+ * @file
+ * @brief Tests for the marking of edges of the finest mesh in a hierarchy
+ * @author agent
+ * @date   2026-10-19
+ * @copyright MIT License
+ */
+
+#include <numeric>
+#include "refinement_test_utils.h"
+
+namespace lf::refinement::test {
+
+std::shared_ptr<mesh::Mesh> BuildTriagMesh(base::size_type n) {
+  mesh::hybrid2d::TPTriagMeshBuilder builder(
+      std::make_shared<mesh::hybrid2d::MeshFactory>(2));
+  builder.setBottomLeftCorner(Eigen::Vector2d{0.0, 0.0})
+      .setTopRightCorner(Eigen::Vector2d{1.0, 1.0})
+      .setNoXCells(n)
+      .setNoYCells(n);
+  return builder.Build();
+}
+
+// Check that exactly the edges of the given cells are marked
+void CheckMarkedCells(const MeshHierarchy &mh,
+                      const std::vector<base::glb_idx_t> &cells) {
+  const mesh::Mesh &mesh(*mh.getMesh(mh.NumLevels() - 1));
+  std::vector<bool> expected(mesh.Size(1), false);
+  for (const base::glb_idx_t cell_index : cells) {
+    for (const mesh::Entity &edge :
+         mesh.EntityByIndex(0, cell_index)->SubEntities(1)) {
+      expected[mesh.Index(edge)] = true;
+    }
+  }
+  for (base::glb_idx_t edge_index = 0; edge_index < mesh.Size(1);
+       ++edge_index) {
+    EXPECT_EQ(mh.EdgeMarked(edge_index), expected[edge_index])
+        << "edge " << edge_index;
+  }
+}
+
+TEST(lf_refinement, MarkEdgesPredicate) {
+  auto base_mesh = BuildTriagMesh(30);
+  MeshHierarchy mh(base_mesh, std::make_shared<mesh::hybrid2d::MeshFactory>(2));
+  auto marker = [](const mesh::Mesh &mesh, const mesh::Entity &edge) {
+    return (mesh.Index(edge) % 3 == 0) || (mesh.Index(edge) % 7 == 0);
+  };
+  // The sequential version calls the marker once per edge in the order of
+  // Mesh::Entities()
+  std::vector<const mesh::Entity *> visited;
+  mh.MarkEdges([&](const mesh::Mesh &mesh, const mesh::Entity &edge) {
+    visited.push_back(&edge);
+    return marker(mesh, edge);
+  });
+  ASSERT_EQ(visited.size(), base_mesh->Size(1));
+  base::size_type k = 0;
+  for (const mesh::Entity &edge : base_mesh->Entities(1)) {
+    EXPECT_EQ(visited[k++], &edge);
+  }
+  for (const mesh::Entity &edge : base_mesh->Entities(1)) {
+    EXPECT_EQ(mh.EdgeMarked(base_mesh->Index(edge)), marker(*base_mesh, edge));
+  }
+  // The concurrent version yields the same flags
+  mh.MarkEdges([](const mesh::Mesh & /*mesh*/,
+                  const mesh::Entity & /*edge*/) { return false; });
+  mh.MarkEdgesParallel(marker, 4);
+  for (const mesh::Entity &edge : base_mesh->Entities(1)) {
+    EXPECT_EQ(mh.EdgeMarked(base_mesh->Index(edge)), marker(*base_mesh, edge));
+  }
+}
+
+TEST(lf_refinement, MarkEdgesIndices) {
+  auto base_mesh = BuildTriagMesh(10);
+  MeshHierarchy mh(base_mesh, std::make_shared<mesh::hybrid2d::MeshFactory>(2));
+  mh.MarkEdges([](const mesh::Mesh & /*mesh*/,
+                  const mesh::Entity & /*edge*/) { return true; });
+  const std::vector<base::glb_idx_t> marked{3, 64, 65, 200};
+  mh.MarkEdgesByIndex(marked);
+  for (base::glb_idx_t edge_index = 0; edge_index < base_mesh->Size(1);
+       ++edge_index) {
+    EXPECT_EQ(mh.EdgeMarked(edge_index),
+              std::find(marked.begin(), marked.end(), edge_index) !=
+                  marked.end());
+  }
+  // Refinement splits the marked edges at least
+  mh.RefineMarked();
+  for (const base::glb_idx_t edge_index : marked) {
+    EXPECT_EQ(mh.EdgeChildInfos(0)[edge_index].child_edge_idx.size(), 2);
+  }
+  checkFatherChildRelations(mh, 0);
+}
+
+TEST(lf_refinement, MarkEdgesEstimator) {
+  auto base_mesh = BuildTriagMesh(10);
+  MeshHierarchy mh(base_mesh, std::make_shared<mesh::hybrid2d::MeshFactory>(2));
+  const base::size_type no_cells = base_mesh->Size(0);
+
+  // Maximum strategy with indicators increasing with the cell index
+  Eigen::VectorXd eta = Eigen::VectorXd::LinSpaced(no_cells, 1.0, no_cells);
+  mh.MarkEdges(eta, MarkingStrategy::kMaximum, 0.9);
+  std::vector<base::glb_idx_t> cells;
+  for (base::glb_idx_t cell_index = 0; cell_index < no_cells; ++cell_index) {
+    if (eta[cell_index] >= 0.9 * no_cells) {
+      cells.push_back(cell_index);
+    }
+  }
+  CheckMarkedCells(mh, cells);
+
+  // Doerfler strategy with equal indicators: ties are broken by the index
+  eta.setOnes();
+  mh.MarkEdges(eta, MarkingStrategy::kDoerfler, 0.25);
+  cells.resize(no_cells / 4);
+  std::iota(cells.begin(), cells.end(), 0);
+  CheckMarkedCells(mh, cells);
+
+  // Doerfler strategy with a single large indicator
+  eta[17] = 100.0;
+  mh.MarkEdges(eta, MarkingStrategy::kDoerfler, 0.5);
+  CheckMarkedCells(mh, {17});
+  mh.RefineMarked();
+  checkFatherChildRelations(mh, 0);
+}
+
+}  // namespace lf::refinement::test
@@ -0,0 +1,107 @@
+/**
+ * @file
+ * @brief Check that multithreaded refinement yields the same meshes as
+ *        sequential refinement
+ * @author agent
+ * @date   2026-10-19
+ * @copyright MIT License
+ */
+
+#include "refinement_test_utils.h"
+
+namespace lf::refinement::test {
+
+// Sets base::DefaultNumThreads() and restores the former value on
+// destruction, also if a test assertion returns early
+class DefaultNumThreadsGuard {
+ public:
+  explicit DefaultNumThreadsGuard(unsigned int num_threads)
+      : saved_(base::DefaultNumThreads()) {
+    base::DefaultNumThreads() = num_threads;
+  }
+  DefaultNumThreadsGuard(const DefaultNumThreadsGuard &) = delete;
+  DefaultNumThreadsGuard &operator=(const DefaultNumThreadsGuard &) = delete;
+  ~DefaultNumThreadsGuard() { base::DefaultNumThreads() = saved_; }
+
+ private:
+  unsigned int saved_;
+};
+
+// Refine a mesh three times, first regularly then locally, using a given
+// number of threads
+std::unique_ptr<MeshHierarchy> RefineWithThreads(
+    const std::shared_ptr<mesh::Mesh> &base_mesh, unsigned int num_threads) {
+  const DefaultNumThreadsGuard guard(num_threads);
+  auto mh = std::make_unique<MeshHierarchy>(
+      base_mesh, std::make_shared<mesh::hybrid2d::MeshFactory>(2));
+  mh->RefineRegular();
+  for (int step = 0; step < 2; ++step) {
+    // Refine edges in a disk
+    mh->MarkEdges([](const mesh::Mesh & /*mesh*/, const mesh::Entity &edge) {
+      const Eigen::MatrixXd mp = edge.Geometry()->Global(
+          (Eigen::MatrixXd(1, 1) << 0.5).finished());
+      return (mp - Eigen::Vector2d(0.4, 0.6)).norm() < 0.3;
+    });
+    mh->RefineMarked();
+  }
+  return mh;
+}
+
+// Compare meshes and parent information on all levels entity by entity
+void CheckSameHierarchies(const MeshHierarchy &mh_seq,
+                          const MeshHierarchy &mh_par) {
+  ASSERT_EQ(mh_seq.NumLevels(), mh_par.NumLevels());
+  for (base::size_type level = 1; level < mh_seq.NumLevels(); ++level) {
+    const mesh::Mesh &mesh_seq(*mh_seq.getMesh(level));
+    const mesh::Mesh &mesh_par(*mh_par.getMesh(level));
+    for (base::dim_t codim = 0; codim <= 2; ++codim) {
+      ASSERT_EQ(mesh_seq.Size(codim), mesh_par.Size(codim));
+      const std::vector<ParentInfo> &pi_seq(mh_seq.ParentInfos(level, codim));
+      const std::vector<ParentInfo> &pi_par(mh_par.ParentInfos(level, codim));
+      for (base::glb_idx_t idx = 0; idx < mesh_seq.Size(codim); ++idx) {
+        const mesh::Entity &e_seq(*mesh_seq.EntityByIndex(codim, idx));
+        const mesh::Entity &e_par(*mesh_par.EntityByIndex(codim, idx));
+        ASSERT_EQ(e_seq.RefEl(), e_par.RefEl());
+        EXPECT_EQ(e_seq.Geometry()->Global(e_seq.RefEl().NodeCoords()),
+                  e_par.Geometry()->Global(e_par.RefEl().NodeCoords()))
+            << "level " << level << ", codim " << codim << ", index " << idx;
+        if (codim < 2) {
+          auto nodes_seq = e_seq.SubEntities(2 - codim);
+          auto nodes_par = e_par.SubEntities(2 - codim);
+          for (int k = 0; k < e_seq.RefEl().NumNodes(); ++k) {
+            EXPECT_EQ(mesh_seq.Index(nodes_seq[k]),
+                      mesh_par.Index(nodes_par[k]));
+          }
+        }
+        EXPECT_EQ(pi_seq[idx].parent_index, pi_par[idx].parent_index);
+        EXPECT_EQ(pi_seq[idx].child_number, pi_par[idx].child_number);
+      }
+    }
+  }
+}
+
+TEST(lf_refinement, ParallelRefinementTria) {
+  mesh::hybrid2d::TPTriagMeshBuilder builder(
+      std::make_shared<mesh::hybrid2d::MeshFactory>(2));
+  builder.setBottomLeftCorner(Eigen::Vector2d{0.0, 0.0})
+      .setTopRightCorner(Eigen::Vector2d{1.0, 1.0})
+      .setNoXCells(40)
+      .setNoYCells(40);
+  const std::shared_ptr<mesh::Mesh> base_mesh = builder.Build();
+  CheckSameHierarchies(*RefineWithThreads(base_mesh, 1),
+                       *RefineWithThreads(base_mesh, 4));
+}
+
+TEST(lf_refinement, ParallelRefinementQuad) {
+  mesh::hybrid2d::TPQuadMeshBuilder builder(
+      std::make_shared<mesh::hybrid2d::MeshFactory>(2));
+  builder.setBottomLeftCorner(Eigen::Vector2d{0.0, 0.0})
+      .setTopRightCorner(Eigen::Vector2d{1.0, 1.0})
+      .setNoXCells(40)
+      .setNoYCells(40);
+  const std::shared_ptr<mesh::Mesh> base_mesh = builder.Build();
+  CheckSameHierarchies(*RefineWithThreads(base_mesh, 1),
+                       *RefineWithThreads(base_mesh, 4));
+}
+
+}  // namespace lf::refinement::test
@@ -3,6 +3,8 @@
  */
 
 #include <iostream>
+#include <typeinfo>
+#include "lf/geometry/geometry.h"
 #include "lf/io/io.h"
 #include "lf/mesh/test_utils/check_mesh_completeness.h"
 #include "lf/mesh/test_utils/test_meshes.h"
@@ -408,4 +410,202 @@ TEST(LocRefTest, MixedRefinement) {
   WriteMatlab(multi_mesh, "mixedref");
 }  // end mixed refinement test
 
+// Wraps the geometry of a straight cell, so that MeshHierarchy cannot
+// recognize it as straight and refines it by the generic algorithm based on
+// lf::geometry::Geometry::ChildGeometry()
+class OpaqueGeometry : public lf::geometry::Geometry {
+ public:
+  explicit OpaqueGeometry(std::unique_ptr<lf::geometry::Geometry> geo)
+      : geo_(std::move(geo)) {}
+  dim_t DimLocal() const override { return geo_->DimLocal(); }
+  dim_t DimGlobal() const override { return geo_->DimGlobal(); }
+  lf::base::RefEl RefEl() const override { return geo_->RefEl(); }
+  Eigen::MatrixXd Global(const Eigen::MatrixXd &local) const override {
+    return geo_->Global(local);
+  }
+  Eigen::MatrixXd Jacobian(const Eigen::MatrixXd &local) const override {
+    return geo_->Jacobian(local);
+  }
+  Eigen::MatrixXd JacobianInverseGramian(
+      const Eigen::MatrixXd &local) const override {
+    return geo_->JacobianInverseGramian(local);
+  }
+  Eigen::VectorXd IntegrationElement(
+      const Eigen::MatrixXd &local) const override {
+    return geo_->IntegrationElement(local);
+  }
+  std::unique_ptr<lf::geometry::Geometry> SubGeometry(dim_t codim,
+                                                      dim_t i) const override {
+    return geo_->SubGeometry(codim, i);
+  }
+  std::vector<std::unique_ptr<lf::geometry::Geometry>> ChildGeometry(
+      const lf::geometry::RefinementPattern &ref_pat,
+      dim_t codim) const override {
+    return geo_->ChildGeometry(ref_pat, codim);
+  }
+  bool isAffine() const override { return geo_->isAffine(); }
+
+ private:
+  std::unique_ptr<lf::geometry::Geometry> geo_;
+};
+
+// Copy of a mesh with TriaO1, QuadO1 and Parallelogram cells, optionally
+// wrapped in an OpaqueGeometry. The cells keep their type of geometry. Copies
+// with and without wrapping are numbered identically.
+std::shared_ptr<lf::mesh::Mesh> CopyStraightMesh(const lf::mesh::Mesh &mesh,
+                                                 bool opaque) {
+  lf::mesh::hybrid2d::MeshFactory factory(2);
+  for (lf::base::glb_idx_t idx = 0; idx < mesh.Size(2); ++idx) {
+    const lf::mesh::Entity &node(*mesh.EntityByIndex(2, idx));
+    factory.AddPoint(node.Geometry()->Global(Eigen::MatrixXd::Zero(0, 1)));
+  }
+  for (lf::base::glb_idx_t idx = 0; idx < mesh.Size(0); ++idx) {
+    const lf::mesh::Entity &cell(*mesh.EntityByIndex(0, idx));
+    const lf::base::RefEl ref_el(cell.RefEl());
+    const Eigen::MatrixXd vertices(
+        cell.Geometry()->Global(ref_el.NodeCoords()));
+    std::vector<lf::base::size_type> nodes;
+    for (const lf::mesh::Entity &node : cell.SubEntities(2)) {
+      nodes.push_back(mesh.Index(node));
+    }
+    std::unique_ptr<lf::geometry::Geometry> geo;
+    if (ref_el == lf::base::RefEl::kTria()) {
+      geo = std::make_unique<lf::geometry::TriaO1>(vertices);
+    } else if (dynamic_cast<const lf::geometry::Parallelogram *>(
+                   cell.Geometry()) != nullptr) {
+      geo = std::make_unique<lf::geometry::Parallelogram>(vertices);
+    } else {
+      geo = std::make_unique<lf::geometry::QuadO1>(vertices);
+    }
+    if (opaque) {
+      geo = std::make_unique<OpaqueGeometry>(std::move(geo));
+    }
+    factory.AddEntity(ref_el, nodes, std::move(geo));
+  }
+  return factory.Build();
+}
+
+// Regular refinement of a mesh with straight cells is done by a combinatorial
+// fast path. It must produce the same child entities, numbered in the same
+// way, located at the same positions (up to roundoff) and described by the
+// same type of geometry, as the generic refinement
+void CheckStraightRegularRefinement(const lf::mesh::Mesh &mesh) {
+  MeshHierarchy mh_fast(CopyStraightMesh(mesh, false),
+                        std::make_shared<lf::mesh::hybrid2d::MeshFactory>(2));
+  MeshHierarchy mh_gen(CopyStraightMesh(mesh, true),
+                       std::make_shared<lf::mesh::hybrid2d::MeshFactory>(2));
+  mh_fast.RefineRegular();
+  mh_gen.RefineRegular();
+  const lf::mesh::Mesh &coarse(*mh_fast.getMesh(0));
+
+  for (lf::base::size_type n = 0; n < coarse.Size(2); ++n) {
+    EXPECT_EQ(mh_fast.PointChildInfos(0)[n].child_point_idx,
+              mh_gen.PointChildInfos(0)[n].child_point_idx);
+  }
+  for (lf::base::size_type n = 0; n < coarse.Size(1); ++n) {
+    EXPECT_EQ(mh_fast.EdgeChildInfos(0)[n].child_edge_idx,
+              mh_gen.EdgeChildInfos(0)[n].child_edge_idx);
+    EXPECT_EQ(mh_fast.EdgeChildInfos(0)[n].child_point_idx,
+              mh_gen.EdgeChildInfos(0)[n].child_point_idx);
+  }
+  for (lf::base::size_type n = 0; n < coarse.Size(0); ++n) {
+    const CellChildInfo &cci_fast(mh_fast.CellChildInfos(0)[n]);
+    const CellChildInfo &cci_gen(mh_gen.CellChildInfos(0)[n]);
+    EXPECT_EQ(cci_fast.ref_pat_, cci_gen.ref_pat_);
+    EXPECT_EQ(cci_fast.child_cell_idx, cci_gen.child_cell_idx);
+    EXPECT_EQ(cci_fast.child_edge_idx, cci_gen.child_edge_idx);
+    EXPECT_EQ(cci_fast.child_point_idx, cci_gen.child_point_idx);
+  }
+  const lf::mesh::Mesh &fine_fast(*mh_fast.getMesh(1));
+  const lf::mesh::Mesh &fine_gen(*mh_gen.getMesh(1));
+  for (lf::base::dim_t codim = 0; codim <= 2; ++codim) {
+    ASSERT_EQ(fine_fast.Size(codim), fine_gen.Size(codim));
+    for (lf::base::glb_idx_t idx = 0; idx < fine_fast.Size(codim); ++idx) {
+      const lf::mesh::Entity &e_fast(*fine_fast.EntityByIndex(codim, idx));
+      const lf::mesh::Entity &e_gen(*fine_gen.EntityByIndex(codim, idx));
+      ASSERT_EQ(e_fast.RefEl(), e_gen.RefEl());
+      const lf::geometry::Geometry &geo_fast(*e_fast.Geometry());
+      const lf::geometry::Geometry &geo_gen(*e_gen.Geometry());
+      EXPECT_EQ(typeid(geo_fast), typeid(geo_gen))
+          << "codim " << codim << ", index " << idx;
+      EXPECT_EQ(geo_fast.isAffine(), geo_gen.isAffine())
+          << "codim " << codim << ", index " << idx;
+      // Child connectivity: same nodes in the same order
+      if (codim < 2) {
+        auto nodes_fast = e_fast.SubEntities(2 - codim);
+        auto nodes_gen = e_gen.SubEntities(2 - codim);
+        for (lf::base::size_type k = 0; k < e_fast.RefEl().NumNodes(); ++k) {
+          EXPECT_EQ(fine_fast.Index(nodes_fast[k]),
+                    fine_gen.Index(nodes_gen[k]))
+              << "codim " << codim << ", index " << idx << ", node " << k;
+        }
+      }
+      // Child coordinates
+      const Eigen::MatrixXd ref_coords(e_fast.RefEl().NodeCoords());
+      const Eigen::MatrixXd x_fast(e_fast.Geometry()->Global(ref_coords));
+      const Eigen::MatrixXd x_gen(e_gen.Geometry()->Global(ref_coords));
+      for (Eigen::Index j = 0; j < x_fast.cols(); ++j) {
+        for (Eigen::Index i = 0; i < x_fast.rows(); ++i) {
+          EXPECT_NEAR(x_fast(i, j), x_gen(i, j), 1.0E-12)
+              << "codim " << codim << ", index " << idx << ", node " << j;
+        }
+      }
+    }
+  }
+  checkFatherChildRelations(mh_fast, 0);
+}
+
+TEST(RegRefTest, StraightTriaRefinement) {
+  lf::mesh::hybrid2d::TPTriagMeshBuilder builder(
+      std::make_shared<lf::mesh::hybrid2d::MeshFactory>(2));
+  builder.setBottomLeftCorner(Eigen::Vector2d{0.0, 0.0})
+      .setTopRightCorner(Eigen::Vector2d{2.0, 1.0})
+      .setNoXCells(7)
+      .setNoYCells(5);
+  CheckStraightRegularRefinement(*builder.Build());
+}
+
+TEST(RegRefTest, StraightQuadRefinement) {
+  lf::mesh::hybrid2d::TPQuadMeshBuilder builder(
+      std::make_shared<lf::mesh::hybrid2d::MeshFactory>(2));
+  builder.setBottomLeftCorner(Eigen::Vector2d{0.0, 0.0})
+      .setTopRightCorner(Eigen::Vector2d{2.0, 1.0})
+      .setNoXCells(7)
+      .setNoYCells(5);
+  CheckStraightRegularRefinement(*builder.Build());
+}
+
+TEST(RegRefTest, StraightParallelogramRefinement) {
+  // 3x2 sheared parallelograms
+  lf::mesh::hybrid2d::MeshFactory factory(2);
+  for (int j = 0; j <= 2; ++j) {
+    for (int i = 0; i <= 3; ++i) {
+      factory.AddPoint(Eigen::Vector2d{i + 0.5 * j, 0.75 * j});
+    }
+  }
+  for (lf::base::size_type j = 0; j < 2; ++j) {
+    for (lf::base::size_type i = 0; i < 3; ++i) {
+      const lf::base::size_type n0 = 4 * j + i;
+      const double x0 = i + 0.5 * j;
+      const double y0 = 0.75 * j;
+      Eigen::Matrix<double, 2, 4> coords;
+      coords << x0, x0 + 1.0, x0 + 1.5, x0 + 0.5, y0, y0, y0 + 0.75,
+          y0 + 0.75;
+      factory.AddEntity(
+          lf::base::RefEl::kQuad(),
+          std::vector<lf::base::size_type>{n0, n0 + 1, n0 + 5, n0 + 4},
+          std::make_unique<lf::geometry::Parallelogram>(coords));
+    }
+  }
+  CheckStraightRegularRefinement(*factory.Build());
+}
+
+TEST(RegRefTest, StraightHybridRefinement) {
+  // Triangles and general quadrilaterals, and a mesh with parallelograms
+  for (int selector : {0, 1}) {
+    CheckStraightRegularRefinement(
+        *lf::mesh::test_utils::GenerateHybrid2DTestMesh(selector));
+  }
+}
+
 }  // namespace lf::refinement::test